@@ -7,11 +7,12 @@
 #   ./build.sh neo4j              # Build only Neo4j
 #   ./build.sh neo4j janusgraph   # Build Neo4j and JanusGraph
 #   ./build.sh sqlg               # Build only SQLG
+#   ./build.sh null               # Build the null/CSR reference image (serves "null" and "csr")
 
 set -e
 
 # All available databases
-ALL_DATABASES=("neo4j" "janusgraph" "arangodb" "orientdb" "aster" "sqlg")
+ALL_DATABASES=("neo4j" "janusgraph" "arangodb" "orientdb" "aster" "sqlg" "null")
 
 # If no arguments provided, build all databases
 if [ $# -eq 0 ]; then
@@ -66,6 +67,13 @@ build_database() {
             echo "=========================================="
             docker build -t bench-sqlg -f ./docker/sqlg/Dockerfile .
             ;;
+        null|csr)
+            echo
+            echo "=========================================="
+            echo "Building null/CSR reference image..."
+            echo "=========================================="
+            docker build -t bench-null -f ./docker/null/Dockerfile .
+            ;;
         *)
             echo "Unknown database: $db"
             echo "Available databases: ${ALL_DATABASES[*]}"
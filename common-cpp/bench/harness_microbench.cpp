@@ -0,0 +1,200 @@
+/**
+ * Microbenchmarks of the harness's own code paths, to quantify how much of a
+ * reported latency is harness rather than database: the operation timer, the
+ * NodeIdMapping lookup and parameter conversion done before every task, the
+ * parallel CSV reader behind LOAD_GRAPH, and a full dispatcher task run on the
+ * null and CSR reference executors (see null_benchmark_executor.hpp).
+ *
+ * Build and run (Google Benchmark is fetched by CMake):
+ *   cmake -S common-cpp -B build -DGRAPHBENCH_BUILD_MICROBENCHMARKS=ON
+ *   cmake --build build --target harness_microbench
+ *   ./build/harness_microbench --benchmark_counters_tabular=true
+ *
+ * The datasets are generated (rmat, see synthetic_graph.hpp): a CSV copy for the
+ * reader and a small synthetic.json dataset for the dispatcher, in a temporary
+ * directory that is removed on exit.
+ */
+#include <graphbench/string_key_mapping.hpp>
+#include <graphbench/null_benchmark_executor.hpp>
+#include <graphbench/workload_dispatcher.hpp>
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+using namespace graphbench;
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr int DATASET_SCALE = 16;        // 64K vertices, 1M edges
+constexpr int DISPATCH_SCALE = 12;       // Graph loaded by each dispatcher iteration
+constexpr int QUERY_COUNT = 10000;       // IDs per parsed or dispatched task
+
+/** Generated CSV dataset and workload files, removed on exit */
+class MicrobenchData {
+public:
+    MicrobenchData() : root_(fs::temp_directory_path() / ("graphbench-microbench-" + std::to_string(getpid()))) {
+        fs::create_directories(datasetDir());
+        fs::create_directories(workloadDir());
+        fs::create_directories(syntheticDir());
+
+        SyntheticGraph graph({{"generator", "rmat"}, {"scale", DATASET_SCALE}});
+        nodeCount_ = graph.nodeCount();
+        std::ofstream nodes(datasetDir() / "nodes.csv");
+        nodes << "node_id\n";
+        for (size_t node = 0; node < nodeCount_; node++) {
+            nodes << node << "\n";
+        }
+        std::ofstream edges(datasetDir() / "edges.csv");
+        edges << "src,dst\n";
+        graph.readEdges(false, [&edges](const CsvBatch& batch) {
+            for (size_t row = 0; row < batch.rows; row++) {
+                edges << batch.id(row, 0) << "," << batch.id(row, 1) << "\n";
+            }
+        });
+
+        std::ofstream(syntheticDir() / SyntheticGraph::SPEC_FILE)
+            << json({{"generator", "rmat"}, {"scale", DISPATCH_SCALE}}).dump();
+        writeTask("00_load.json", {{"task_type", "LOAD_GRAPH"}, {"parameters", json::object()}});
+        writeTask("01_nbrs.json", {
+            {"task_type", "GET_NBRS"},
+            {"ops_count", QUERY_COUNT},
+            {"batch_sizes", {1}},
+            {"parameters", {{"direction", "OUT"}, {"ids", queryIds(size_t(1) << DISPATCH_SCALE)}}}
+        });
+    }
+
+    ~MicrobenchData() {
+        std::error_code ignored;
+        fs::remove_all(root_, ignored);
+    }
+
+    fs::path datasetDir() const { return root_ / "dataset"; }
+    fs::path syntheticDir() const { return root_ / "synthetic"; }
+    fs::path workloadDir() const { return root_ / "workload"; }
+    size_t nodeCount() const { return nodeCount_; }
+
+    /** QUERY_COUNT uniformly drawn origin IDs below nodes, the same on every call */
+    static json queryIds(size_t nodes) {
+        std::mt19937_64 rng(42);
+        std::uniform_int_distribution<int64_t> pick(0, static_cast<int64_t>(nodes) - 1);
+        json ids = json::array();
+        for (int i = 0; i < QUERY_COUNT; i++) {
+            ids.push_back(pick(rng));
+        }
+        return ids;
+    }
+
+private:
+    fs::path root_;
+    size_t nodeCount_ = 0;
+
+    void writeTask(const std::string& name, const json& task) const {
+        std::ofstream(workloadDir() / name) << task.dump();
+    }
+};
+
+MicrobenchData& data() {
+    static MicrobenchData instance;
+    return instance;
+}
+
+} // namespace
+
+// One CycleClock read: each timed operation costs one
+static void BM_CycleClockRead(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(CycleClock::now());
+    }
+}
+BENCHMARK(BM_CycleClockRead);
+
+// Recording one latency into the active histogram, as every executor does per operation
+static void BM_LatencyRecord(benchmark::State& state) {
+    LatencyHistogram histogram;
+    LatencyRecorder::Scope scope(&histogram);
+    uint64_t value = 1;
+    for (auto _ : state) {
+        LatencyRecorder::record(value);
+        value = value * 6364136223846793005ULL + 1442695040888963407ULL;
+    }
+}
+BENCHMARK(BM_LatencyRecord);
+
+// Origin -> system ID lookup of a dense mapping, in random order
+static void BM_NodeIdMappingGet(benchmark::State& state) {
+    size_t nodes = static_cast<size_t>(state.range(0));
+    NodeIdMapping<int64_t> mapping(nodes, -1);
+    for (size_t node = 0; node < nodes; node++) {
+        mapping.set(static_cast<int64_t>(node), static_cast<int64_t>(node) * 3);
+    }
+    std::mt19937_64 rng(7);
+    std::uniform_int_distribution<int64_t> pick(0, static_cast<int64_t>(nodes) - 1);
+    std::vector<int64_t> ids(4096);
+    for (int64_t& id : ids) {
+        id = pick(rng);
+    }
+    size_t next = 0;
+    for (auto _ : state) {
+        bool found = false;
+        benchmark::DoNotOptimize(mapping.get_or_default(ids[next++ & 4095], &found));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_NodeIdMappingGet)->Arg(1 << 16)->Arg(1 << 24);
+
+// Conversion of a JSON "ids" array to system IDs before a task runs
+static void BM_ParameterParserGetNbrs(benchmark::State& state) {
+    NullBenchmarkExecutor executor(NullBenchmarkExecutor::Storage::NONE);
+    executor.loadGraph(data().datasetDir().string());
+    ParameterParser<NullBenchmarkExecutor> parser(&executor);
+    json parameters = {{"direction", "OUT"}, {"ids", MicrobenchData::queryIds(data().nodeCount())}};
+    for (auto _ : state) {
+        auto params = parser.parseGetNbrsParameters(parameters);
+        benchmark::DoNotOptimize(params.systemIds.data());
+    }
+    state.SetItemsProcessed(state.iterations() * QUERY_COUNT);
+}
+BENCHMARK(BM_ParameterParserGetNbrs);
+
+// Parallel memory-mapped read of edges.csv, with the given number of threads
+static void BM_ParallelCsvReaderEdges(benchmark::State& state) {
+    std::string path = (data().datasetDir() / "edges.csv").string();
+    ParallelCsvReader reader(static_cast<int>(state.range(0)));
+    int64_t rows = 0;
+    for (auto _ : state) {
+        rows = 0;
+        reader.read(path, 2, false, [&rows](const CsvBatch& batch) { rows += static_cast<int64_t>(batch.rows); });
+    }
+    state.SetItemsProcessed(state.iterations() * rows);
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(fs::file_size(path)));
+}
+BENCHMARK(BM_ParallelCsvReaderEdges)->Arg(1)->Arg(4)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+// A whole GET_NBRS task through the dispatcher (parse, restore, timed loop, report),
+// per operation, on a small generated graph that is loaded in every iteration; only
+// the task's own duration is counted. Storage NONE gives the harness floor, CSR adds
+// the neighbor reads.
+static void BM_DispatcherGetNbrs(benchmark::State& state) {
+    auto storage = state.range(0) ? NullBenchmarkExecutor::Storage::CSR : NullBenchmarkExecutor::Storage::NONE;
+    NullBenchmarkExecutor executor(storage);
+    WorkloadDispatcher<NullBenchmarkExecutor> dispatcher(&executor, data().syntheticDir().string());
+    double latencyUs = 0;
+    for (auto _ : state) {
+        json report = dispatcher.executeBenchmark(data().workloadDir().string());
+        const json& task = report["results"][1];
+        state.SetIterationTime(task.value("durationSeconds", 0.0));
+        latencyUs = task["batch_results"][0].value("latency_us", 0.0);
+    }
+    state.SetItemsProcessed(state.iterations() * QUERY_COUNT);
+    state.counters["timed_latency_us"] = latencyUs;  // What the report shows
+    state.SetLabel(storage == NullBenchmarkExecutor::Storage::CSR ? "csr" : "null");
+}
+BENCHMARK(BM_DispatcherGetNbrs)->Arg(0)->Arg(1)->UseManualTime()->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
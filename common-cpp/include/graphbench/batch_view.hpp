@@ -0,0 +1,48 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace graphbench {
+
+/**
+ * Non-owning view of a contiguous run of pre-converted workload items (pointer
+ * plus length), the C++17 stand-in for std::span.
+ *
+ * Parameters are parsed once into flat vectors of system IDs; executors,
+ * client slices and batches all take views into those vectors, so splitting a
+ * task across clients or into batches never copies items. A view is valid as
+ * long as the vector it was taken from is neither resized nor destroyed.
+ */
+template<typename T>
+class BatchView {
+public:
+    using value_type = T;
+    using const_iterator = const T*;
+
+    BatchView() = default;
+    BatchView(const T* data, size_t size) : data_(data), size_(size) {}
+    BatchView(const std::vector<T>& items) : data_(items.data()), size_(items.size()) {}
+
+    const T* data() const { return data_; }
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    const T& operator[](size_t index) const { return data_[index]; }
+    const T& front() const { return data_[0]; }
+    const T* begin() const { return data_; }
+    const T* end() const { return data_ + size_; }
+
+    /** Sub-view of up to count items starting at offset (clamped to the view) */
+    BatchView slice(size_t offset, size_t count) const {
+        offset = std::min(offset, size_);
+        return BatchView(data_ + offset, std::min(count, size_ - offset));
+    }
+
+private:
+    const T* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+} // namespace graphbench
@@ -7,8 +7,13 @@
 #include <functional>
 #include <chrono>
 #include <any>
+#include <optional>
 #include <filesystem>
 #include <graphbench/benchmark_utils.hpp>
+#include <graphbench/engine_stats.hpp>
+#include <graphbench/restore_strategy.hpp>
+#include <graphbench/traversal.hpp>
+#include <graphbench/batch_view.hpp>
 
 namespace graphbench {
 
@@ -16,12 +21,19 @@ namespace fs = std::filesystem;
 
 /**
  * CRTP base class for structural benchmark executors.
- * Handles graph structural operations: addVertex, removeVertex, addEdge, removeEdge, getNbrs.
+ * Handles graph structural operations: addVertex, removeVertex, addEdge, removeEdge, getNbrs,
+ * and the multi-hop traversals kHop, bfs and shortestPath.
  * Uses static polymorphism for zero-overhead abstraction.
+ *
+ * SystemId is the executor's native vertex handle. Workload parameters are parsed
+ * into flat arrays of it, so the timed operation loops never unbox IDs; operations
+ * take BatchViews into those arrays, so no call copies its items.
  */
-template<typename Derived>
+template<typename Derived, typename SystemId>
 class BenchmarkExecutor {
 public:
+    using SystemIdType = SystemId;
+
     // Core operations - must be implemented by derived class
     void initDatabase() {
         static_cast<Derived*>(this)->initDatabaseImpl();
@@ -39,49 +51,79 @@ public:
         return static_cast<Derived*>(this)->addVertexImpl(count, batchSize);
     }
 
-    std::vector<double> removeVertex(const std::vector<std::any>& systemIds, int batchSize) {
+    std::vector<double> removeVertex(BatchView<SystemId> systemIds, int batchSize) {
         return static_cast<Derived*>(this)->removeVertexImpl(systemIds, batchSize);
     }
 
     std::vector<double> addEdge(const std::string& label,
-                                const std::vector<std::pair<std::any, std::any>>& pairs,
+                                BatchView<std::pair<SystemId, SystemId>> pairs,
                                 int batchSize) {
         return static_cast<Derived*>(this)->addEdgeImpl(label, pairs, batchSize);
     }
 
     std::vector<double> removeEdge(const std::string& label,
-                                   const std::vector<std::pair<std::any, std::any>>& pairs,
+                                   BatchView<std::pair<SystemId, SystemId>> pairs,
                                    int batchSize) {
         return static_cast<Derived*>(this)->removeEdgeImpl(label, pairs, batchSize);
     }
 
     std::vector<double> getNbrs(const std::string& direction,
-                                const std::vector<std::any>& systemIds,
+                                BatchView<SystemId> systemIds,
                                 int batchSize) {
         return static_cast<Derived*>(this)->getNbrsImpl(direction, systemIds, batchSize);
     }
 
+    /**
+     * Count the distinct vertices within depth hops of each start vertex.
+     * Traversals report their visited counts through TraversalRecorder.
+     */
+    std::vector<double> kHop(const std::string& direction, int depth,
+                             BatchView<SystemId> systemIds,
+                             int batchSize) {
+        return static_cast<Derived*>(this)->kHopImpl(direction, depth, systemIds, batchSize);
+    }
+
+    /**
+     * Breadth-first reachability from each start vertex, bounded by maxDepth
+     * hops (0 = until the frontier is empty).
+     */
+    std::vector<double> bfs(const std::string& direction, int maxDepth,
+                            BatchView<SystemId> systemIds,
+                            int batchSize) {
+        return static_cast<Derived*>(this)->bfsImpl(direction, maxDepth, systemIds, batchSize);
+    }
+
+    /**
+     * Unweighted shortest path (hop count) for each (src, dst) pair, searching at most
+     * maxDepth hops (0 = unbounded).
+     */
+    std::vector<double> shortestPath(const std::string& direction, int maxDepth,
+                                     BatchView<std::pair<SystemId, SystemId>> pairs,
+                                     int batchSize) {
+        return static_cast<Derived*>(this)->shortestPathImpl(direction, maxDepth, pairs, batchSize);
+    }
+
     // Default methods with batch size = 1
     std::vector<double> addVertex(int count) {
         return addVertex(count, 1);
     }
 
-    std::vector<double> removeVertex(const std::vector<std::any>& systemIds) {
+    std::vector<double> removeVertex(BatchView<SystemId> systemIds) {
         return removeVertex(systemIds, 1);
     }
 
     std::vector<double> addEdge(const std::string& label,
-                                const std::vector<std::pair<std::any, std::any>>& pairs) {
+                                BatchView<std::pair<SystemId, SystemId>> pairs) {
         return addEdge(label, pairs, 1);
     }
 
     std::vector<double> removeEdge(const std::string& label,
-                                   const std::vector<std::pair<std::any, std::any>>& pairs) {
+                                   BatchView<std::pair<SystemId, SystemId>> pairs) {
         return removeEdge(label, pairs, 1);
     }
 
     std::vector<double> getNbrs(const std::string& direction,
-                                const std::vector<std::any>& systemIds) {
+                                BatchView<SystemId> systemIds) {
         return getNbrs(direction, systemIds, 1);
     }
 
@@ -105,29 +147,45 @@ public:
         static_cast<Derived*>(this)->openDatabaseImpl();
     }
 
-    void snapGraph() {
+    /**
+     * Snapshot the loaded graph; restoreGraph() returns the database to this state
+     * before every batch size. Executors whose data does not live in their database
+     * directory (client/server systems) override snapGraphImpl() and
+     * restoreGraphImpl(); the defaults replicate the database directory.
+     */
+    RestoreStats snapGraph() {
+        return static_cast<Derived*>(this)->snapGraphImpl();
+    }
+
+    RestoreStats restoreGraph() {
+        return static_cast<Derived*>(this)->restoreGraphImpl();
+    }
+
+    /**
+     * Default snapshot: copy the closed database directory using the RESTORE_STRATEGY layer.
+     */
+    RestoreStats snapGraphImpl() {
         // Close the database
         closeDatabase();
 
-        // Delete old snapshot if exists
-        fs::path snapshotPath(getSnapshotPath());
-        if (fs::exists(snapshotPath)) {
-            BenchmarkUtils::deleteDirectory(snapshotPath);
-        }
-
-        // Copy database to snapshot location
         fs::path dbPath(getDatabasePath());
         if (!fs::exists(dbPath)) {
             throw std::runtime_error("Database directory does not exist: " + dbPath.string());
         }
 
-        BenchmarkUtils::copyDirectory(dbPath, snapshotPath);
+        // Replaces any old snapshot
+        RestoreStats stats = RestoreStrategy::replicate(dbPath, fs::path(getSnapshotPath()),
+                                                        RestoreStrategy::modeFromEnv());
 
         // Reopen the database
         openDatabase();
+        return stats;
     }
 
-    void restoreGraph() {
+    /**
+     * Default restore: replace the database directory with the snapshot using the RESTORE_STRATEGY layer.
+     */
+    RestoreStats restoreGraphImpl() {
         // Send progress callback if available
         auto* derived = static_cast<Derived*>(this);
         if (derived->getProgressCallback()) {
@@ -137,27 +195,63 @@ public:
         // Close the database
         closeDatabase();
 
-        // Delete current database directory
-        fs::path dbPath(getDatabasePath());
-        if (fs::exists(dbPath)) {
-            BenchmarkUtils::deleteDirectory(dbPath);
-        }
-
-        // Copy snapshot back to database location
         fs::path snapshotPath(getSnapshotPath());
         if (!fs::exists(snapshotPath)) {
             throw std::runtime_error("Snapshot does not exist at: " + snapshotPath.string());
         }
 
-        BenchmarkUtils::copyDirectory(snapshotPath, dbPath);
+        // Replaces the current database directory
+        RestoreStats stats = RestoreStrategy::replicate(snapshotPath, fs::path(getDatabasePath()),
+                                                        RestoreStrategy::modeFromEnv());
 
         // Reopen the database
         openDatabase();
 
         // Send completion callback if available
         if (derived->getProgressCallback()) {
-            derived->getProgressCallback()->sendLogMessage("Database restored from snapshot", "INFO");
+            derived->getProgressCallback()->sendLogMessage(
+                "Database restored from snapshot (" + stats.strategy + ", " +
+                std::to_string(stats.seconds) + "s, " + std::to_string(stats.bytesCopied) + " bytes copied)",
+                "INFO");
         }
+        return stats;
+    }
+
+    /**
+     * Snapshot of the engine's cumulative internal counters. The dispatcher records
+     * the change over every batch size run; executors without such counters keep
+     * the default, which reports none.
+     */
+    EngineCounters engineStats() {
+        return static_cast<Derived*>(this)->engineStatsImpl();
+    }
+
+    EngineCounters engineStatsImpl() {
+        return {};
+    }
+
+    /**
+     * Empty the engine's own caches (block cache, buffer pool) before a cold run.
+     * @return Whether the executor has such a cache and reset it
+     */
+    bool resetEngineCache() {
+        return static_cast<Derived*>(this)->resetEngineCacheImpl();
+    }
+
+    bool resetEngineCacheImpl() {
+        return false;
+    }
+
+    /**
+     * Read the loaded graph once, untimed, so a warm run starts with populated caches.
+     * @return Whether the executor supports pre-warming
+     */
+    bool prewarmCache() {
+        return static_cast<Derived*>(this)->prewarmCacheImpl();
+    }
+
+    bool prewarmCacheImpl() {
+        return false;
     }
 
     int getErrorCount() const {
@@ -168,7 +262,10 @@ public:
         static_cast<Derived*>(this)->resetErrorCountImpl();
     }
 
-    std::any getSystemId(int64_t originId) const {
+    /**
+     * Map an origin (CSV) ID to the system ID, or std::nullopt if the vertex was not loaded.
+     */
+    std::optional<SystemId> getSystemId(int64_t originId) const {
         return static_cast<const Derived*>(this)->getSystemIdImpl(originId);
     }
 
@@ -0,0 +1,261 @@
+#pragma once
+
+#include <graphbench/thread_budget.hpp>
+#include <nlohmann/json.hpp>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace graphbench {
+
+using json = nlohmann::json;
+
+/**
+ * One benchmark run submitted through the job API.
+ *
+ * Progress is kept as NDJSON lines: one "subtask" line per finished batch size, one
+ * "task" line per finished workload file, a "metadata" line, and a final "done"
+ * line with the job status. Stream readers replay the lines from any offset, so a
+ * reader that reconnects (or attaches late) still sees everything, and the results
+ * of the finished tasks survive a run that fails halfway.
+ */
+class BenchmarkJob {
+public:
+    BenchmarkJob(std::string id, std::string datasetName, std::string datasetPath)
+        : id_(std::move(id)), datasetName_(std::move(datasetName)), datasetPath_(std::move(datasetPath)),
+          submittedAt_(std::chrono::system_clock::now()) {}
+
+    const std::string& id() const { return id_; }
+    const std::string& datasetName() const { return datasetName_; }
+    const std::string& datasetPath() const { return datasetPath_; }
+
+    void markRunning() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        status_ = "running";
+        changed_.notify_all();
+    }
+
+    /** Append one NDJSON line (called by the dispatcher's result listener) */
+    void append(const json& line) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        lines_.push_back(line.dump() + "\n");
+        changed_.notify_all();
+    }
+
+    void complete(json response) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        response_ = std::move(response);
+        finishLocked("completed", "");
+    }
+
+    void fail(const std::string& error) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        finishLocked("failed", error);
+    }
+
+    bool finished() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return finished_;
+    }
+
+    /**
+     * Copy the lines from offset on into out, waiting up to timeout for new ones.
+     * @return false once the job has finished and out holds its last line
+     */
+    bool readLines(size_t offset, std::vector<std::string>& out, std::chrono::milliseconds timeout) const {
+        std::unique_lock<std::mutex> lock(mutex_);
+        changed_.wait_for(lock, timeout, [&]() { return finished_ || lines_.size() > offset; });
+        for (size_t i = offset; i < lines_.size(); i++) {
+            out.push_back(lines_[i]);
+        }
+        return !finished_;
+    }
+
+    /** Block until the job has finished */
+    void waitFinished() const {
+        std::unique_lock<std::mutex> lock(mutex_);
+        changed_.wait(lock, [this]() { return finished_; });
+    }
+
+    /** Final response of a completed job (the /execute body) */
+    json response() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return response_;
+    }
+
+    std::string error() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return error_;
+    }
+
+    /**
+     * Job state for polling; includes the final response once completed if requested.
+     */
+    json statusJson(bool includeResponse) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        json status = {
+            {"job_id", id_},
+            {"status", status_},
+            {"dataset_name", datasetName_},
+            {"lines", lines_.size()},
+            {"submitted_at", secondsSinceEpoch(submittedAt_)}
+        };
+        if (!error_.empty()) {
+            status["error"] = error_;
+        }
+        if (includeResponse && status_ == "completed") {
+            status["response"] = response_;
+        }
+        return status;
+    }
+
+private:
+    std::string id_;
+    std::string datasetName_;
+    std::string datasetPath_;
+    std::chrono::system_clock::time_point submittedAt_;
+
+    mutable std::mutex mutex_;
+    mutable std::condition_variable changed_;
+    std::string status_ = "queued";  // queued, running, completed, failed
+    std::vector<std::string> lines_;
+    json response_;
+    std::string error_;
+    bool finished_ = false;
+
+    void finishLocked(const std::string& status, const std::string& error) {
+        status_ = status;
+        error_ = error;
+        json done = {{"type", "done"}, {"status", status}};
+        if (!error.empty()) {
+            done["error"] = error;
+        }
+        lines_.push_back(done.dump() + "\n");
+        finished_ = true;
+        changed_.notify_all();
+    }
+
+    static double secondsSinceEpoch(std::chrono::system_clock::time_point time) {
+        return std::chrono::duration<double>(time.time_since_epoch()).count();
+    }
+};
+
+/**
+ * FIFO of benchmark jobs run by one worker thread on the benchmark CPUs of the
+ * ThreadBudget. All executors of a server share one database directory, so jobs
+ * run one at a time; any number of sessions can be submitted and observed
+ * concurrently. The most recent MAX_FINISHED_JOBS finished jobs are kept for
+ * polling and replay.
+ */
+class BenchmarkJobQueue {
+public:
+    using RunFunction = std::function<json(BenchmarkJob&)>;
+
+    BenchmarkJobQueue(ThreadBudget budget, RunFunction run)
+        : budget_(std::move(budget)), run_(std::move(run)) {
+        worker_ = std::thread([this]() { workerLoop(); });
+    }
+
+    ~BenchmarkJobQueue() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        wakeup_.notify_all();
+        worker_.join();
+    }
+
+    BenchmarkJobQueue(const BenchmarkJobQueue&) = delete;
+    BenchmarkJobQueue& operator=(const BenchmarkJobQueue&) = delete;
+
+    std::shared_ptr<BenchmarkJob> submit(const std::string& datasetName, const std::string& datasetPath) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto job = std::make_shared<BenchmarkJob>("job-" + std::to_string(++lastJobNumber_), datasetName, datasetPath);
+        jobs_[job->id()] = job;
+        order_.push_back(job->id());
+        pending_.push_back(job);
+        evictFinishedLocked();
+        wakeup_.notify_all();
+        return job;
+    }
+
+    std::shared_ptr<BenchmarkJob> find(const std::string& id) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = jobs_.find(id);
+        return it != jobs_.end() ? it->second : nullptr;
+    }
+
+    json listJson() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        json list = json::array();
+        for (const std::string& id : order_) {
+            list.push_back(jobs_.at(id)->statusJson(false));
+        }
+        return list;
+    }
+
+private:
+    static constexpr size_t MAX_FINISHED_JOBS = 16;
+
+    ThreadBudget budget_;
+    RunFunction run_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable wakeup_;
+    std::map<std::string, std::shared_ptr<BenchmarkJob>> jobs_;
+    std::deque<std::string> order_;                      // Submission order of jobs_
+    std::deque<std::shared_ptr<BenchmarkJob>> pending_;
+    uint64_t lastJobNumber_ = 0;
+    bool stopping_ = false;
+    std::thread worker_;
+
+    void workerLoop() {
+        budget_.pinToBenchmarkCpus();
+        while (true) {
+            std::shared_ptr<BenchmarkJob> job;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                wakeup_.wait(lock, [this]() { return stopping_ || !pending_.empty(); });
+                if (pending_.empty()) {
+                    return;
+                }
+                job = pending_.front();
+                pending_.pop_front();
+            }
+
+            job->markRunning();
+            try {
+                job->complete(run_(*job));
+            } catch (const std::exception& e) {
+                std::cerr << "Job " << job->id() << " failed: " << e.what() << std::endl;
+                job->fail(e.what());
+            }
+        }
+    }
+
+    void evictFinishedLocked() {
+        size_t finished = 0;
+        for (const std::string& id : order_) {
+            finished += jobs_.at(id)->finished() ? 1 : 0;
+        }
+        for (auto it = order_.begin(); it != order_.end() && finished > MAX_FINISHED_JOBS;) {
+            if (jobs_.at(*it)->finished()) {
+                jobs_.erase(*it);
+                it = order_.erase(it);
+                finished--;
+            } else {
+                ++it;
+            }
+        }
+    }
+};
+
+} // namespace graphbench
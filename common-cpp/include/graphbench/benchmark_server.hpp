@@ -4,10 +4,15 @@
 #include <nlohmann/json.hpp>
 #include <graphbench/workload_dispatcher.hpp>
 #include <graphbench/benchmark_utils.hpp>
+#include <graphbench/benchmark_jobs.hpp>
+#include <graphbench/thread_budget.hpp>
 #include <iostream>
 #include <memory>
 #include <string>
 #include <functional>
+#include <chrono>
+#include <stdexcept>
+#include <vector>
 
 namespace graphbench {
 
@@ -40,29 +45,49 @@ public:
     /**
      * Start the HTTP server.
      * Blocks until server is stopped.
+     *
+     * Endpoints:
+     *   GET  /health                 Liveness, API list and thread budget
+     *   POST /execute                Run a benchmark and return all results at the end
+     *   POST /jobs                   Queue a benchmark job, returns its job_id (202)
+     *   GET  /jobs                   Status of the current and recent jobs
+     *   GET  /jobs/{id}              Status of one job, with the full results once completed
+     *   GET  /jobs/{id}/stream       NDJSON result lines (chunked), from ?from=N on, until "done"
+     *
+     * Both ways of running go through the same job queue, so benchmarks always run
+     * on the job worker (benchmark CPUs) and never on an HTTP handler thread.
      */
     void start() {
+        ThreadBudget budget = ThreadBudget::fromEnv();
+        BenchmarkJobQueue jobs(budget, [this](BenchmarkJob& job) {
+            return executeBenchmark(job);
+        });
+
+        // Handler threads are created by listen() and inherit the HTTP CPUs
+        budget.pinToHttpCpus();
         httplib::Server server;
+        int httpThreads = budget.httpThreads();
+        server.new_task_queue = [httpThreads]() { return new httplib::ThreadPool(httpThreads); };
 
         // Health check endpoint
-        server.Get("/health", [](const httplib::Request&, httplib::Response& res) {
-            json response = {{"status", "ok"}};
+        server.Get("/health", [&budget](const httplib::Request&, httplib::Response& res) {
+            json response = {
+                {"status", "ok"},
+                {"api", {"execute", "jobs"}},
+                {"thread_budget", budget.toJson()}
+            };
             res.set_content(response.dump(), "application/json");
         });
 
         // Execute benchmark endpoint
-        server.Post("/execute", [this](const httplib::Request& req, httplib::Response& res) {
+        server.Post("/execute", [&jobs](const httplib::Request& req, httplib::Response& res) {
             try {
-                json request = json::parse(req.body);
-                std::string datasetName = request.at("dataset_name").get<std::string>();
-                std::string datasetPath = request.at("dataset_path").get<std::string>();
-
-                std::cout << "Executing benchmark for dataset: " << datasetName << std::endl;
-
-                // Execute full benchmark workflow
-                json results = executeBenchmark(datasetPath);
-
-                res.set_content(results.dump(), "application/json");
+                auto job = submitJob(jobs, req);
+                job->waitFinished();
+                if (!job->error().empty()) {
+                    throw std::runtime_error(job->error());
+                }
+                res.set_content(job->response().dump(), "application/json");
             } catch (const std::exception& e) {
                 std::cerr << "Error: " << e.what() << std::endl;
                 json error = {{"error", e.what()}};
@@ -71,26 +96,98 @@ public:
             }
         });
 
-        std::cout << "Starting " << databaseName_ << " Benchmark Server on port " << port_ << std::endl;
+        server.Post("/jobs", [&jobs](const httplib::Request& req, httplib::Response& res) {
+            try {
+                auto job = submitJob(jobs, req);
+                json response = job->statusJson(false);
+                response["stream"] = "/jobs/" + job->id() + "/stream";
+                res.status = 202;
+                res.set_content(response.dump(), "application/json");
+            } catch (const std::exception& e) {
+                json error = {{"error", e.what()}};
+                res.status = 400;
+                res.set_content(error.dump(), "application/json");
+            }
+        });
+
+        server.Get("/jobs", [&jobs](const httplib::Request&, httplib::Response& res) {
+            res.set_content(jobs.listJson().dump(), "application/json");
+        });
+
+        server.Get(R"(/jobs/([^/]+))", [&jobs](const httplib::Request& req, httplib::Response& res) {
+            auto job = jobs.find(req.matches[1]);
+            if (!job) {
+                res.status = 404;
+                res.set_content(json({{"error", "Unknown job"}}).dump(), "application/json");
+                return;
+            }
+            res.set_content(job->statusJson(true).dump(), "application/json");
+        });
+
+        server.Get(R"(/jobs/([^/]+)/stream)", [&jobs](const httplib::Request& req, httplib::Response& res) {
+            auto job = jobs.find(req.matches[1]);
+            if (!job) {
+                res.status = 404;
+                res.set_content(json({{"error", "Unknown job"}}).dump(), "application/json");
+                return;
+            }
+            size_t from = req.has_param("from") ? std::stoul(req.get_param_value("from")) : 0;
+            res.set_chunked_content_provider("application/x-ndjson",
+                [job, next = from](size_t, httplib::DataSink& sink) mutable {
+                    std::vector<std::string> lines;
+                    bool more = job->readLines(next, lines, std::chrono::milliseconds(STREAM_POLL_MS));
+                    for (const std::string& line : lines) {
+                        if (!sink.write(line.data(), line.size())) {
+                            return false;
+                        }
+                        next++;
+                    }
+                    if (!more) {
+                        sink.done();
+                    }
+                    return true;
+                });
+        });
+
+        std::cout << "Starting " << databaseName_ << " Benchmark Server on port " << port_
+                  << " (thread budget " << budget.toJson().dump() << ")" << std::endl;
         server.listen("0.0.0.0", port_);
     }
 
 private:
+    // How long a stream handler waits for new lines before httplib polls it again
+    static constexpr int STREAM_POLL_MS = 1000;
+
     int port_;
     std::string databaseName_;
     ExecutorFactory executorFactory_;
 
+    static std::shared_ptr<BenchmarkJob> submitJob(BenchmarkJobQueue& jobs, const httplib::Request& req) {
+        json request = json::parse(req.body);
+        std::string datasetName = request.at("dataset_name").get<std::string>();
+        std::string datasetPath = request.at("dataset_path").get<std::string>();
+        auto job = jobs.submit(datasetName, datasetPath);
+        std::cout << "Queued " << job->id() << " for dataset: " << datasetName << std::endl;
+        return job;
+    }
+
     /**
-     * Execute full benchmark workflow.
-     * Creates executor, uses WorkloadDispatcher to execute all workload files.
+     * Execute full benchmark workflow of a job.
+     * Creates executor, uses WorkloadDispatcher to execute all workload files and
+     * appends each result to the job as soon as it is complete.
      */
-    json executeBenchmark(const std::string& datasetPath) {
+    json executeBenchmark(BenchmarkJob& job) {
+        std::cout << "Executing benchmark for dataset: " << job.datasetName() << std::endl;
+
         // Create executor instance
         auto executor = executorFactory_();
 
         // Use WorkloadDispatcher to execute benchmark
         std::string workloadDir = "/data/workloads";
-        WorkloadDispatcher<Executor> dispatcher(executor.get(), datasetPath);
+        WorkloadDispatcher<Executor> dispatcher(executor.get(), job.datasetPath());
+        dispatcher.setResultListener([&job](const json& line) {
+            job.append(line);
+        });
         return dispatcher.executeBenchmark(workloadDir);
     }
 };
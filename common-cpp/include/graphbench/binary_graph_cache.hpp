@@ -0,0 +1,763 @@
+#pragma once
+
+#include <graphbench/benchmark_utils.hpp>
+#include <graphbench/number_format.hpp>
+#include <graphbench/parallel_csv_reader.hpp>
+#include <graphbench/property_type.hpp>
+#include <nlohmann/json.hpp>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace graphbench {
+
+using json = nlohmann::json;
+namespace fs = std::filesystem;
+
+/**
+ * Pre-converted binary form of a dataset directory (nodes.csv, edges.csv, type_meta.json),
+ * read through a memory mapping with no text parsing.
+ *
+ * File layout (native byte order, every section 8-byte aligned):
+ *   Header                     counts, source stamps, section offsets
+ *   int64[nodeCount]           node IDs in nodes.csv order
+ *   uint64[nodeCount + 1]      CSR offsets, indexed by source node ID
+ *   int64[edgeCount]           CSR neighbors (destination IDs grouped by source, file order within a source)
+ *   property columns           one block per column, node columns in row order, edge columns in CSR order
+ *   catalog                    JSON with the CSV headers and the column layout
+ *
+ * Property columns are typed according to type_meta.json: int64, double and bool
+ * columns store fixed-width values plus a one-byte validity flag per row. A column
+ * is kept as raw strings (uint64 offsets + bytes, exactly as they appear in the CSV)
+ * when any of its values would not format back to the same text, so loaders see
+ * identical property strings whether they read the CSV or the cache.
+ *
+ * The cache is keyed by size, mtime and a sampled FNV-1a hash (head, middle and
+ * tail) of each source file; open() ignores a stale cache.
+ *
+ * Building the cache is a separate step (prepare(), or convert() directly), which the
+ * workload dispatcher runs before the LOAD_GRAPH timer starts, so a conversion is never
+ * part of a measured load. The converter streams both CSV files twice (once to count
+ * and lay out the sections, once to fill them) into a mapped output file, so it holds
+ * O(nodes) state instead of the edge table.
+ *
+ * Environment:
+ *   GRAPH_CACHE      auto (default): use a current cache if one exists, never build one,
+ *                    build: build the cache in prepare() when it is missing or stale,
+ *                    rebuild: rebuild it in prepare() even if it is current,
+ *                    off: always read the CSV files
+ *   GRAPH_CACHE_DIR  directory for cache files (default: the temp directory). A
+ *                    graph.gbin inside the dataset directory is also used, but never written
+ */
+class BinaryGraphCache {
+public:
+    using BatchCallback = ParallelCsvReader::BatchCallback;
+
+    static constexpr uint32_t FORMAT_VERSION = 1;
+    static constexpr size_t BATCH_ROWS = 64 * 1024;
+
+    BinaryGraphCache(const BinaryGraphCache&) = delete;
+    BinaryGraphCache& operator=(const BinaryGraphCache&) = delete;
+
+    /**
+     * Open the current cache of a dataset.
+     * Returns nullptr when the cache is disabled, missing or stale; callers then read the CSV files.
+     */
+    static std::unique_ptr<BinaryGraphCache> open(const std::string& datasetDir) {
+        if (BenchmarkUtils::getEnv("GRAPH_CACHE", "auto") == "off") {
+            return nullptr;
+        }
+
+        SourceKey key;
+        try {
+            key = sourceKey(datasetDir);
+        } catch (const std::exception& e) {
+            std::cerr << "Warning: Graph cache disabled: " << e.what() << std::endl;
+            return nullptr;
+        }
+
+        for (const auto& path : cacheCandidates(datasetDir)) {
+            if (auto cache = tryOpen(path, key)) {
+                return cache;
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * Build the cache of a dataset when GRAPH_CACHE is build (and the cache is missing
+     * or stale) or rebuild. Returns the conversion time in seconds, 0 when nothing was built.
+     * A failed conversion is logged and later loads read the CSV files.
+     */
+    static double prepare(const std::string& datasetDir) {
+        std::string mode = BenchmarkUtils::getEnv("GRAPH_CACHE", "auto");
+        if ((mode != "build" && mode != "rebuild") || !fs::exists(fs::path(datasetDir) / "nodes.csv")) {
+            return 0.0;
+        }
+
+        try {
+            SourceKey key = sourceKey(datasetDir);
+            if (mode == "build") {
+                for (const auto& path : cacheCandidates(datasetDir)) {
+                    if (tryOpen(path, key)) {
+                        return 0.0;
+                    }
+                }
+            }
+
+            auto start = std::chrono::steady_clock::now();
+            convert(datasetDir, outputPath(datasetDir), key);
+            return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        } catch (const std::exception& e) {
+            std::cerr << "Warning: Failed to build graph cache for " << datasetDir << ": " << e.what() << std::endl;
+            return 0.0;
+        }
+    }
+
+    size_t nodeCount() const { return static_cast<size_t>(header().nodeCount); }
+    size_t edgeCount() const { return static_cast<size_t>(header().edgeCount); }
+    const std::string& path() const { return file_->path(); }
+
+    /**
+     * Deliver all nodes as CsvBatch objects (one ID column) and return the nodes.csv headers.
+     */
+    std::vector<std::string> readNodes(bool withProperties, const BatchCallback& callback) const {
+        const int64_t* nodeIds = section<int64_t>(header().nodeIdsOffset);
+        size_t rows = nodeCount();
+        for (size_t begin = 0; begin < rows; begin += BATCH_ROWS) {
+            size_t end = std::min(rows, begin + BATCH_ROWS);
+            CsvBatch batch = makeBatch(1, withProperties ? nodeColumns_.size() : 0, end - begin);
+            batch.ids.assign(nodeIds + begin, nodeIds + end);
+            fillProperties(batch, nodeColumns_, begin);
+            batch.headers = &nodeHeaders_;
+            callback(batch);
+        }
+        return nodeHeaders_;
+    }
+
+    /**
+     * Deliver all edges as CsvBatch objects (src, dst) in CSR order and return the edges.csv headers.
+     */
+    std::vector<std::string> readEdges(bool withProperties, const BatchCallback& callback) const {
+        const uint64_t* offsets = section<uint64_t>(header().csrOffsetsOffset);
+        const int64_t* neighbors = section<int64_t>(header().csrNeighborsOffset);
+        size_t rows = edgeCount();
+        size_t source = 0;
+        for (size_t begin = 0; begin < rows; begin += BATCH_ROWS) {
+            size_t end = std::min(rows, begin + BATCH_ROWS);
+            CsvBatch batch = makeBatch(2, withProperties ? edgeColumns_.size() : 0, end - begin);
+            batch.ids.resize(2 * batch.rows);
+            for (size_t edge = begin; edge < end; edge++) {
+                while (offsets[source + 1] <= edge) {
+                    source++;
+                }
+                batch.ids[2 * (edge - begin)] = static_cast<int64_t>(source);
+                batch.ids[2 * (edge - begin) + 1] = neighbors[edge];
+            }
+            fillProperties(batch, edgeColumns_, begin);
+            batch.headers = &edgeHeaders_;
+            callback(batch);
+        }
+        return edgeHeaders_;
+    }
+
+    /**
+     * Convert a dataset directory into a cache file at output.
+     * Written to a temporary file and renamed, so concurrent readers never see a partial cache.
+     */
+    static void convert(const std::string& datasetDir, const fs::path& output) {
+        convert(datasetDir, output, sourceKey(datasetDir));
+    }
+
+private:
+    enum class Encoding { STRING, INT64, DOUBLE, BOOL };
+
+    struct SourceStamp {
+        uint64_t size = 0;
+        int64_t mtimeNs = 0;
+        uint64_t sampleHash = 0;
+
+        bool operator==(const SourceStamp& other) const {
+            return size == other.size && mtimeNs == other.mtimeNs && sampleHash == other.sampleHash;
+        }
+    };
+
+    struct SourceKey {
+        SourceStamp nodes;
+        SourceStamp edges;
+        SourceStamp typeMeta;  // All zero when type_meta.json does not exist
+    };
+
+    struct Header {
+        char magic[8];
+        uint32_t version;
+        uint32_t reserved;
+        uint64_t nodeCount;
+        uint64_t edgeCount;
+        SourceKey key;
+        uint64_t nodeIdsOffset;
+        uint64_t csrOffsetsOffset;
+        uint64_t csrNeighborsOffset;
+        uint64_t catalogOffset;
+        uint64_t catalogLength;
+    };
+
+    struct Column {
+        Encoding encoding = Encoding::STRING;
+        uint64_t valuesOffset = 0;    // INT64/DOUBLE/BOOL values, or STRING offsets (rows + 1)
+        uint64_t validityOffset = 0;  // INT64/DOUBLE/BOOL: one byte per row, 0 = missing
+        uint64_t dataOffset = 0;      // STRING: concatenated raw values
+    };
+
+    static constexpr char MAGIC[8] = {'G', 'B', 'G', 'R', 'A', 'P', 'H', '1'};
+    static constexpr size_t SAMPLE_BYTES = 64 * 1024;
+    static constexpr size_t MAX_FORMATTED_BYTES = SHORTEST_FORMAT_BYTES;  // Longest int64/double/bool text
+
+    std::unique_ptr<MappedFile> file_;
+    std::vector<std::string> nodeHeaders_;
+    std::vector<std::string> edgeHeaders_;
+    std::vector<Column> nodeColumns_;
+    std::vector<Column> edgeColumns_;
+
+    explicit BinaryGraphCache(std::unique_ptr<MappedFile> file) : file_(std::move(file)) {}
+
+    const Header& header() const { return *reinterpret_cast<const Header*>(file_->data()); }
+
+    template<typename T>
+    const T* section(uint64_t offset) const {
+        return reinterpret_cast<const T*>(file_->data() + offset);
+    }
+
+    static CsvBatch makeBatch(size_t idColumns, size_t propertyColumns, size_t rows) {
+        CsvBatch batch;
+        batch.rows = rows;
+        batch.idColumns = idColumns;
+        batch.propertyColumns = propertyColumns;
+        return batch;
+    }
+
+    /**
+     * Fill batch.properties for rows [firstRow, firstRow + batch.rows).
+     * String columns are views into the mapping; typed columns are formatted into
+     * batch storage, which is reserved up front so the views stay valid.
+     */
+    void fillProperties(CsvBatch& batch, const std::vector<Column>& columns, size_t firstRow) const {
+        if (batch.propertyColumns == 0) {
+            return;
+        }
+        size_t typedColumns = std::count_if(columns.begin(), columns.end(),
+                                            [](const Column& c) { return c.encoding != Encoding::STRING; });
+        batch.storage.reserve(batch.rows * typedColumns * MAX_FORMATTED_BYTES);
+        batch.properties.resize(batch.rows * batch.propertyColumns);
+
+        for (size_t column = 0; column < columns.size(); column++) {
+            const Column& col = columns[column];
+            for (size_t row = 0; row < batch.rows; row++) {
+                batch.properties[row * batch.propertyColumns + column] = value(batch, col, firstRow + row);
+            }
+        }
+    }
+
+    std::string_view value(CsvBatch& batch, const Column& col, size_t row) const {
+        if (col.encoding == Encoding::STRING) {
+            const uint64_t* offsets = section<uint64_t>(col.valuesOffset);
+            return std::string_view(file_->data() + col.dataOffset + offsets[row], offsets[row + 1] - offsets[row]);
+        }
+        if (!section<uint8_t>(col.validityOffset)[row]) {
+            return {};
+        }
+        char buffer[MAX_FORMATTED_BYTES];
+        size_t length = 0;
+        switch (col.encoding) {
+            case Encoding::INT64:
+                length = std::to_chars(buffer, buffer + sizeof(buffer), section<int64_t>(col.valuesOffset)[row]).ptr - buffer;
+                break;
+            case Encoding::DOUBLE:
+                length = formatShortest(buffer, section<double>(col.valuesOffset)[row]);
+                break;
+            case Encoding::BOOL:
+                length = section<uint8_t>(col.valuesOffset)[row] ? 4 : 5;
+                std::memcpy(buffer, length == 4 ? "true" : "false", length);
+                break;
+            case Encoding::STRING:
+                break;
+        }
+        size_t position = batch.storage.size();
+        batch.storage.append(buffer, length);
+        return std::string_view(batch.storage.data() + position, length);
+    }
+
+    // --- Cache location and validation ---
+
+    static std::vector<fs::path> cacheCandidates(const std::string& datasetDir) {
+        fs::path absolute = fs::absolute(datasetDir).lexically_normal();
+        std::string name = absolute.filename().empty() ? absolute.parent_path().filename().string()
+                                                       : absolute.filename().string();
+        char suffix[17];
+        std::snprintf(suffix, sizeof(suffix), "%016llx", static_cast<unsigned long long>(
+            fnv1a(absolute.string().data(), absolute.string().size(), FNV_OFFSET)));
+        std::string fileName = name + "-" + suffix + ".gbin";
+
+        return {absolute / "graph.gbin", cacheDirectory() / fileName};
+    }
+
+    /** Where prepare() writes the cache: never into the dataset directory, which may be read-only or shared */
+    static fs::path outputPath(const std::string& datasetDir) {
+        return cacheCandidates(datasetDir).back();
+    }
+
+    static fs::path cacheDirectory() {
+        std::string cacheDir = BenchmarkUtils::getEnv("GRAPH_CACHE_DIR", "");
+        return cacheDir.empty() ? fs::temp_directory_path() / "graphbench-cache" : fs::path(cacheDir);
+    }
+
+    static std::unique_ptr<BinaryGraphCache> tryOpen(const fs::path& path, const SourceKey& key) {
+        std::error_code ec;
+        if (!fs::is_regular_file(path, ec)) {
+            return nullptr;
+        }
+        try {
+            auto file = std::make_unique<MappedFile>(path.string());
+            if (file->size() < sizeof(Header)) {
+                return nullptr;
+            }
+            const Header& h = *reinterpret_cast<const Header*>(file->data());
+            if (std::memcmp(h.magic, MAGIC, sizeof(MAGIC)) != 0 || h.version != FORMAT_VERSION ||
+                !(h.key.nodes == key.nodes) || !(h.key.edges == key.edges) || !(h.key.typeMeta == key.typeMeta) ||
+                h.catalogOffset + h.catalogLength > file->size()) {
+                return nullptr;
+            }
+
+            std::unique_ptr<BinaryGraphCache> cache(new BinaryGraphCache(std::move(file)));
+            json catalog = json::parse(cache->file_->data() + h.catalogOffset,
+                                       cache->file_->data() + h.catalogOffset + h.catalogLength);
+            cache->nodeHeaders_ = catalog["node_headers"].get<std::vector<std::string>>();
+            cache->edgeHeaders_ = catalog["edge_headers"].get<std::vector<std::string>>();
+            cache->nodeColumns_ = parseColumns(catalog["node_columns"]);
+            cache->edgeColumns_ = parseColumns(catalog["edge_columns"]);
+            return cache;
+        } catch (const std::exception& e) {
+            std::cerr << "Warning: Ignoring unreadable graph cache " << path << ": " << e.what() << std::endl;
+            return nullptr;
+        }
+    }
+
+    static SourceKey sourceKey(const std::string& datasetDir) {
+        SourceKey key;
+        key.nodes = stamp(fs::path(datasetDir) / "nodes.csv");
+        key.edges = stamp(fs::path(datasetDir) / "edges.csv");
+        fs::path typeMetaPath = fs::path(datasetDir) / "type_meta.json";
+        if (fs::exists(typeMetaPath)) {
+            key.typeMeta = stamp(typeMetaPath);
+        }
+        return key;
+    }
+
+    static constexpr uint64_t FNV_OFFSET = 14695981039346656037ULL;
+
+    static uint64_t fnv1a(const char* data, size_t length, uint64_t hash) {
+        for (size_t i = 0; i < length; i++) {
+            hash ^= static_cast<unsigned char>(data[i]);
+            hash *= 1099511628211ULL;
+        }
+        return hash;
+    }
+
+    /**
+     * Size, mtime and a hash of the first, middle and last SAMPLE_BYTES of a file.
+     */
+    static SourceStamp stamp(const fs::path& path) {
+        int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            throw std::runtime_error("Failed to open " + path.string() + ": " + std::strerror(errno));
+        }
+        struct stat st;
+        if (::fstat(fd, &st) != 0) {
+            ::close(fd);
+            throw std::runtime_error("Failed to stat " + path.string() + ": " + std::strerror(errno));
+        }
+
+        SourceStamp result;
+        result.size = static_cast<uint64_t>(st.st_size);
+        result.mtimeNs = static_cast<int64_t>(st.st_mtim.tv_sec) * 1000000000LL + st.st_mtim.tv_nsec;
+
+        uint64_t hash = FNV_OFFSET;
+        std::vector<char> buffer(SAMPLE_BYTES);
+        uint64_t middle = result.size > SAMPLE_BYTES ? (result.size - SAMPLE_BYTES) / 2 : 0;
+        uint64_t tail = result.size > SAMPLE_BYTES ? result.size - SAMPLE_BYTES : 0;
+        for (uint64_t offset : {uint64_t{0}, middle, tail}) {
+            ssize_t n = ::pread(fd, buffer.data(), buffer.size(), static_cast<off_t>(offset));
+            if (n > 0) {
+                hash = fnv1a(buffer.data(), static_cast<size_t>(n), hash);
+            }
+        }
+        ::close(fd);
+        result.sampleHash = hash;
+        return result;
+    }
+
+    // --- Conversion ---
+
+    static const char* encodingName(Encoding encoding) {
+        switch (encoding) {
+            case Encoding::INT64: return "int64";
+            case Encoding::DOUBLE: return "double";
+            case Encoding::BOOL: return "bool";
+            case Encoding::STRING: return "string";
+        }
+        return "string";
+    }
+
+    static std::vector<Column> parseColumns(const json& columns) {
+        std::vector<Column> result;
+        for (const auto& entry : columns) {
+            Column col;
+            std::string encoding = entry["encoding"].get<std::string>();
+            col.encoding = encoding == "int64" ? Encoding::INT64
+                         : encoding == "double" ? Encoding::DOUBLE
+                         : encoding == "bool" ? Encoding::BOOL
+                         : Encoding::STRING;
+            col.valuesOffset = entry["values"].get<uint64_t>();
+            col.validityOffset = entry.value("validity", uint64_t{0});
+            col.dataOffset = entry.value("data", uint64_t{0});
+            result.push_back(col);
+        }
+        return result;
+    }
+
+    static Encoding encodingFor(PropertyType type) {
+        switch (type) {
+            case PropertyType::INTEGER:
+            case PropertyType::LONG:
+                return Encoding::INT64;
+            case PropertyType::FLOAT:
+            case PropertyType::DOUBLE:
+                return Encoding::DOUBLE;
+            case PropertyType::BOOLEAN:
+                return Encoding::BOOL;
+            case PropertyType::STRING:
+                break;
+        }
+        return Encoding::STRING;
+    }
+
+    /**
+     * Parse a raw value for a typed encoding. Fails unless formatting the parsed value
+     * reproduces the raw text exactly (e.g. "007" or "1.50" stay strings).
+     */
+    static bool roundTrips(std::string_view raw, int64_t* parsed) {
+        auto [ptr, ec] = std::from_chars(raw.data(), raw.data() + raw.size(), *parsed);
+        if (ec != std::errc() || ptr != raw.data() + raw.size()) {
+            return false;
+        }
+        char buffer[MAX_FORMATTED_BYTES];
+        auto formatted = std::to_chars(buffer, buffer + sizeof(buffer), *parsed);
+        return std::string_view(buffer, formatted.ptr - buffer) == raw;
+    }
+
+    static bool roundTrips(std::string_view raw, double* parsed) {
+        if (!parseFloating(raw, parsed)) {
+            return false;
+        }
+        char buffer[MAX_FORMATTED_BYTES];
+        return std::string_view(buffer, formatShortest(buffer, *parsed)) == raw;
+    }
+
+    static bool fits(std::string_view raw, Encoding encoding) {
+        int64_t intValue;
+        double doubleValue;
+        switch (encoding) {
+            case Encoding::INT64: return roundTrips(raw, &intValue);
+            case Encoding::DOUBLE: return roundTrips(raw, &doubleValue);
+            case Encoding::BOOL: return raw == "true" || raw == "false";
+            case Encoding::STRING: break;
+        }
+        return true;
+    }
+
+    static size_t valueWidth(Encoding encoding) {
+        return encoding == Encoding::BOOL ? 1 : 8;
+    }
+
+    /**
+     * Layout of one property column, collected in the counting pass.
+     * The encoding starts as the type_meta.json type and falls back to STRING
+     * on the first value that does not round-trip.
+     */
+    struct ColumnPlan {
+        Encoding encoding = Encoding::STRING;
+        uint64_t bytes = 0;  // Total raw bytes, the data size of a STRING column
+        Column column;
+
+        void count(std::string_view raw) {
+            bytes += raw.size();
+            if (!raw.empty() && encoding != Encoding::STRING && !fits(raw, encoding)) {
+                encoding = Encoding::STRING;
+            }
+        }
+
+        json place(uint64_t rows, const std::function<uint64_t(uint64_t)>& allocate) {
+            json entry = {{"encoding", encodingName(encoding)}};
+            if (encoding == Encoding::STRING) {
+                column.valuesOffset = allocate((rows + 1) * sizeof(uint64_t));
+                column.dataOffset = allocate(bytes);
+                entry["data"] = column.dataOffset;
+            } else {
+                column.valuesOffset = allocate(rows * valueWidth(encoding));
+                column.validityOffset = allocate(rows);
+                entry["validity"] = column.validityOffset;
+            }
+            column.encoding = encoding;
+            entry["values"] = column.valuesOffset;
+            return entry;
+        }
+    };
+
+    /**
+     * Writable shared mapping of the output file, sized up front. Sections that are
+     * not written stay zero (a sparse hole), which is also an unset validity byte.
+     */
+    class OutputMapping {
+    public:
+        OutputMapping(const fs::path& path, uint64_t size) : size_(size) {
+            fd_ = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+            if (fd_ < 0) {
+                throw std::runtime_error("Cannot create " + path.string() + ": " + std::strerror(errno));
+            }
+            if (::ftruncate(fd_, static_cast<off_t>(size_)) != 0) {
+                ::close(fd_);
+                throw std::runtime_error("Cannot size " + path.string() + ": " + std::strerror(errno));
+            }
+            void* mapped = ::mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+            if (mapped == MAP_FAILED) {
+                ::close(fd_);
+                throw std::runtime_error("Failed to mmap " + path.string() + ": " + std::strerror(errno));
+            }
+            data_ = static_cast<char*>(mapped);
+        }
+
+        ~OutputMapping() {
+            ::munmap(data_, size_);
+            ::close(fd_);
+        }
+
+        OutputMapping(const OutputMapping&) = delete;
+        OutputMapping& operator=(const OutputMapping&) = delete;
+
+        template<typename T>
+        T* at(uint64_t offset) { return reinterpret_cast<T*>(data_ + offset); }
+
+        void sync() {
+            if (::msync(data_, size_, MS_SYNC) != 0) {
+                throw std::runtime_error(std::string("Write error: ") + std::strerror(errno));
+            }
+        }
+
+    private:
+        int fd_ = -1;
+        char* data_ = nullptr;
+        uint64_t size_ = 0;
+    };
+
+    /**
+     * Store the value of row in a typed column (STRING columns are handled by the caller).
+     */
+    static void storeTyped(OutputMapping& out, const Column& col, uint64_t row, std::string_view raw) {
+        if (raw.empty()) {
+            return;
+        }
+        out.at<uint8_t>(col.validityOffset)[row] = 1;
+        if (col.encoding == Encoding::INT64) {
+            std::from_chars(raw.data(), raw.data() + raw.size(), out.at<int64_t>(col.valuesOffset)[row]);
+        } else if (col.encoding == Encoding::DOUBLE) {
+            parseFloating(raw, &out.at<double>(col.valuesOffset)[row]);
+        } else {
+            out.at<uint8_t>(col.valuesOffset)[row] = raw == "true";
+        }
+    }
+
+    static std::vector<ColumnPlan> initialPlans(const std::vector<std::string>& headers, size_t idColumns,
+                                                const std::map<std::string, PropertyType>& types) {
+        std::vector<ColumnPlan> plans(headers.size() > idColumns ? headers.size() - idColumns : 0);
+        for (size_t column = 0; column < plans.size(); column++) {
+            auto it = types.find(headers[idColumns + column]);
+            plans[column].encoding = encodingFor(it != types.end() ? it->second : PropertyType::STRING);
+        }
+        return plans;
+    }
+
+    static void convert(const std::string& datasetDir, const fs::path& output, const SourceKey& key) {
+        std::string nodesPath = (fs::path(datasetDir) / "nodes.csv").string();
+        std::string edgesPath = (fs::path(datasetDir) / "edges.csv").string();
+        auto typeMaps = readPropertyTypeMeta(datasetDir);
+        ParallelCsvReader reader;
+
+        // Counting pass: row counts, column encodings and sizes, out-degrees
+        std::vector<std::string> nodeHeaders = ParallelCsvReader::readHeader(nodesPath);
+        std::vector<std::string> edgeHeaders = ParallelCsvReader::readHeader(edgesPath);
+        std::vector<ColumnPlan> nodePlans = initialPlans(nodeHeaders, 1, typeMaps.first);
+        std::vector<ColumnPlan> edgePlans = initialPlans(edgeHeaders, 2, typeMaps.second);
+
+        uint64_t nodeCount = 0;
+        reader.read(nodesPath, 1, true, [&](const CsvBatch& batch) {
+            nodeCount += batch.rows;
+            for (size_t row = 0; row < batch.rows; row++) {
+                for (size_t column = 0; column < batch.propertyColumns; column++) {
+                    nodePlans[column].count(batch.property(row, column));
+                }
+            }
+        });
+
+        // CSR requires source IDs in [0, nodeCount). Per source and column, the raw
+        // bytes of its values, so string columns can be filled in CSR order.
+        std::vector<uint64_t> degrees(nodeCount + 1, 0);
+        std::vector<std::vector<uint64_t>> sourceBytes(edgePlans.size(), std::vector<uint64_t>(nodeCount + 1, 0));
+        uint64_t edgeCount = 0;
+        auto checkSource = [nodeCount](int64_t src) {
+            if (src < 0 || static_cast<uint64_t>(src) >= nodeCount) {
+                throw std::runtime_error("Edge source " + std::to_string(src) +
+                                         " is outside the node ID range [0, " + std::to_string(nodeCount) + ")");
+            }
+        };
+        reader.read(edgesPath, 2, true, [&](const CsvBatch& batch) {
+            edgeCount += batch.rows;
+            for (size_t row = 0; row < batch.rows; row++) {
+                int64_t src = batch.id(row, 0);
+                checkSource(src);
+                degrees[src + 1]++;
+                for (size_t column = 0; column < batch.propertyColumns; column++) {
+                    std::string_view raw = batch.property(row, column);
+                    edgePlans[column].count(raw);
+                    sourceBytes[column][src + 1] += raw.size();
+                }
+            }
+        });
+
+        // Layout; the catalog only depends on it, so the file size is known before any data is written
+        uint64_t cursor = sizeof(Header);
+        auto allocate = [&cursor](uint64_t bytes) {
+            cursor = (cursor + 7) & ~uint64_t{7};
+            uint64_t start = cursor;
+            cursor += bytes;
+            return start;
+        };
+        Header h{};
+        std::memcpy(h.magic, MAGIC, sizeof(MAGIC));
+        h.version = FORMAT_VERSION;
+        h.nodeCount = nodeCount;
+        h.edgeCount = edgeCount;
+        h.key = key;
+        h.nodeIdsOffset = allocate(nodeCount * sizeof(int64_t));
+        h.csrOffsetsOffset = allocate((nodeCount + 1) * sizeof(uint64_t));
+        h.csrNeighborsOffset = allocate(edgeCount * sizeof(int64_t));
+
+        json catalog = {{"node_headers", nodeHeaders}, {"edge_headers", edgeHeaders},
+                        {"node_columns", json::array()}, {"edge_columns", json::array()}};
+        for (ColumnPlan& plan : nodePlans) {
+            catalog["node_columns"].push_back(plan.place(nodeCount, allocate));
+        }
+        for (ColumnPlan& plan : edgePlans) {
+            catalog["edge_columns"].push_back(plan.place(edgeCount, allocate));
+        }
+        std::string catalogText = catalog.dump();
+        h.catalogOffset = allocate(catalogText.size());
+        h.catalogLength = catalogText.size();
+
+        fs::create_directories(output.parent_path());
+        fs::path temporary = output;
+        temporary += ".tmp." + std::to_string(::getpid());
+
+        try {
+            OutputMapping out(temporary, cursor);
+            std::memcpy(out.at<char>(0), &h, sizeof(h));
+            std::memcpy(out.at<char>(h.catalogOffset), catalogText.data(), catalogText.size());
+
+            // Nodes in file order
+            uint64_t nodeRow = 0;
+            std::vector<uint64_t> nodeData(nodePlans.size(), 0);
+            reader.read(nodesPath, 1, true, [&](const CsvBatch& batch) {
+                if (nodeRow + batch.rows > nodeCount) {
+                    throw std::runtime_error("nodes.csv changed during conversion");
+                }
+                for (size_t row = 0; row < batch.rows; row++, nodeRow++) {
+                    out.at<int64_t>(h.nodeIdsOffset)[nodeRow] = batch.id(row);
+                    for (size_t column = 0; column < batch.propertyColumns; column++) {
+                        const Column& col = nodePlans[column].column;
+                        std::string_view raw = batch.property(row, column);
+                        if (col.encoding != Encoding::STRING) {
+                            storeTyped(out, col, nodeRow, raw);
+                            continue;
+                        }
+                        std::memcpy(out.at<char>(col.dataOffset) + nodeData[column], raw.data(), raw.size());
+                        nodeData[column] += raw.size();
+                        out.at<uint64_t>(col.valuesOffset)[nodeRow + 1] = nodeData[column];
+                    }
+                }
+            });
+
+            // CSR offsets; degrees becomes the per-source write cursor, sourceBytes the
+            // per-source start of each string column's data
+            uint64_t* csrOffsets = out.at<uint64_t>(h.csrOffsetsOffset);
+            for (uint64_t i = 0; i < nodeCount; i++) {
+                degrees[i + 1] += degrees[i];
+                for (auto& bytes : sourceBytes) {
+                    bytes[i + 1] += bytes[i];
+                }
+            }
+            std::copy(degrees.begin(), degrees.end(), csrOffsets);
+
+            // Edges scattered into CSR order (stable, so file order is kept within each source)
+            reader.read(edgesPath, 2, true, [&](const CsvBatch& batch) {
+                for (size_t row = 0; row < batch.rows; row++) {
+                    int64_t src = batch.id(row, 0);
+                    checkSource(src);
+                    uint64_t position = degrees[src]++;
+                    if (position >= csrOffsets[src + 1]) {
+                        throw std::runtime_error("edges.csv changed during conversion");
+                    }
+                    out.at<int64_t>(h.csrNeighborsOffset)[position] = batch.id(row, 1);
+                    for (size_t column = 0; column < batch.propertyColumns; column++) {
+                        const Column& col = edgePlans[column].column;
+                        std::string_view raw = batch.property(row, column);
+                        if (col.encoding != Encoding::STRING) {
+                            storeTyped(out, col, position, raw);
+                            continue;
+                        }
+                        uint64_t& start = sourceBytes[column][src];
+                        std::memcpy(out.at<char>(col.dataOffset) + start, raw.data(), raw.size());
+                        start += raw.size();
+                        out.at<uint64_t>(col.valuesOffset)[position + 1] = start;
+                    }
+                }
+            });
+            out.sync();
+        } catch (...) {
+            std::error_code ec;
+            fs::remove(temporary, ec);
+            throw;
+        }
+        fs::rename(temporary, output);
+
+        std::cerr << "Built graph cache " << output << " (" << nodeCount << " nodes, "
+                  << edgeCount << " edges)" << std::endl;
+    }
+};
+
+} // namespace graphbench
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <nlohmann/json.hpp>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+
+namespace graphbench {
+
+using json = nlohmann::json;
+namespace fs = std::filesystem;
+
+/**
+ * Read-only view of an int64 array in a binary parameter file.
+ * Pairs are stored interleaved (src0, dst0, src1, dst1, ...), so an array of
+ * width 2 holds count pairs in 2 * count values.
+ */
+struct ParameterArray {
+    const int64_t* data = nullptr;
+    size_t count = 0;
+    size_t width = 1;
+
+    int64_t at(size_t entry, size_t column = 0) const { return data[entry * width + column]; }
+};
+
+/**
+ * Binary sidecar of a workload file, written by the workload compiler.
+ *
+ * Large ID arrays ("ids", "pairs") are moved out of the JSON into one file of
+ * little-endian int64 values, and the JSON keeps a reference in their place:
+ *
+ *   "pairs": {"$binary": {"offset": 16, "count": 1000000, "width": 2}}
+ *
+ * The workload names the sidecar in "parameters_file". The file starts with the
+ * 8-byte magic "GBPARAM1" and an 8-byte value count; offsets are in bytes from
+ * the start of the file. It is mmapped, so the parser converts the IDs to system
+ * IDs straight from the page cache instead of building a JSON DOM of them.
+ */
+class ParameterFile {
+public:
+    static constexpr char MAGIC[8] = {'G', 'B', 'P', 'A', 'R', 'A', 'M', '1'};
+    static constexpr size_t HEADER_SIZE = 16;
+
+    explicit ParameterFile(const fs::path& path) {
+        int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            throw std::runtime_error("Cannot open parameter file: " + path.string());
+        }
+        struct stat st;
+        if (::fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < HEADER_SIZE) {
+            ::close(fd);
+            throw std::runtime_error("Invalid parameter file: " + path.string());
+        }
+        size_ = static_cast<size_t>(st.st_size);
+        void* mapped = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (mapped == MAP_FAILED) {
+            throw std::runtime_error("Cannot map parameter file: " + path.string());
+        }
+        data_ = static_cast<const char*>(mapped);
+        // Parameters are read front to back once
+        ::madvise(mapped, size_, MADV_SEQUENTIAL);
+
+        uint64_t values = 0;
+        std::memcpy(&values, data_ + sizeof(MAGIC), sizeof(values));
+        if (std::memcmp(data_, MAGIC, sizeof(MAGIC)) != 0 || HEADER_SIZE + values * sizeof(int64_t) != size_) {
+            ::munmap(mapped, size_);
+            throw std::runtime_error("Invalid parameter file: " + path.string());
+        }
+    }
+
+    ~ParameterFile() {
+        ::munmap(const_cast<char*>(data_), size_);
+    }
+
+    ParameterFile(const ParameterFile&) = delete;
+    ParameterFile& operator=(const ParameterFile&) = delete;
+
+    /** Whether a parameter value is a reference into a parameter file */
+    static bool isReference(const json& value) {
+        return value.is_object() && value.contains("$binary");
+    }
+
+    /** Resolve a reference; width must match the layout the parser expects */
+    ParameterArray array(const json& reference, size_t width) const {
+        const json& ref = reference.at("$binary");
+        size_t offset = ref.at("offset").get<size_t>();
+        size_t count = ref.at("count").get<size_t>();
+        if (ref.value("width", size_t(1)) != width) {
+            throw std::runtime_error("Binary parameter has width " + ref.at("width").dump() +
+                                     ", expected " + std::to_string(width));
+        }
+        if (offset % sizeof(int64_t) != 0 || offset < HEADER_SIZE ||
+            offset + count * width * sizeof(int64_t) > size_) {
+            throw std::runtime_error("Binary parameter out of range: " + ref.dump());
+        }
+        return {reinterpret_cast<const int64_t*>(data_ + offset), count, width};
+    }
+
+private:
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+} // namespace graphbench
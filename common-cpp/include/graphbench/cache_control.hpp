@@ -0,0 +1,71 @@
+#pragma once
+
+#include <nlohmann/json.hpp>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+namespace graphbench {
+
+using json = nlohmann::json;
+
+/**
+ * Cache state a task's measured runs start from (workload "cache_mode"):
+ *
+ *   as_is  whatever the restore and earlier runs left behind (default)
+ *   cold   after each restore, reset the engine's own cache and drop the OS page cache
+ *   warm   after each restore, read the loaded graph once through the executor
+ *
+ * The preparation runs after the restore and before any warmup, so warmup_ops
+ * then warms exactly the cache state selected here.
+ */
+enum class CacheMode { AS_IS, COLD, WARM };
+
+struct CacheControl {
+    static CacheMode modeFromWorkload(const json& workload) {
+        std::string name = workload.value("cache_mode", std::string("as_is"));
+        if (name == "as_is") {
+            return CacheMode::AS_IS;
+        }
+        if (name == "cold") {
+            return CacheMode::COLD;
+        }
+        if (name == "warm") {
+            return CacheMode::WARM;
+        }
+        throw std::runtime_error("Unknown cache_mode: " + name + " (expected as_is, cold or warm)");
+    }
+
+    static const char* name(CacheMode mode) {
+        switch (mode) {
+            case CacheMode::COLD: return "cold";
+            case CacheMode::WARM: return "warm";
+            default: return "as_is";
+        }
+    }
+
+    /**
+     * Write back dirty pages and drop the kernel's page cache, dentries and inodes.
+     * The page cache is shared by the whole host, so this needs a privileged
+     * container (/proc/sys writable); it also evicts the pages of a database
+     * server running in another container.
+     * @return Empty on success, otherwise why the caches could not be dropped
+     */
+    static std::string dropPageCache() {
+        ::sync();
+        std::ofstream dropCaches("/proc/sys/vm/drop_caches");
+        if (!dropCaches) {
+            return std::string("/proc/sys/vm/drop_caches: ") + std::strerror(errno);
+        }
+        dropCaches << "3" << std::flush;
+        if (!dropCaches) {
+            return std::string("writing /proc/sys/vm/drop_caches: ") + std::strerror(errno);
+        }
+        return "";
+    }
+};
+
+} // namespace graphbench
@@ -0,0 +1,158 @@
+#pragma once
+
+#include <graphbench/latency_histogram.hpp>
+#include <graphbench/batch_view.hpp>
+#include <pthread.h>
+#include <sched.h>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace graphbench {
+
+/**
+ * Runs the same workload on N client threads, each pinned to its own core.
+ * Every worker records per-operation latencies into a private histogram (via
+ * LatencyRecorder), which are merged after all workers have joined, so there
+ * is no shared state on the hot path.
+ */
+class ConcurrentDriver {
+public:
+    struct Result {
+        LatencyHistogram histogram;
+        std::vector<double> latencies;  // Per-batch latencies of all workers, in thread order
+        double wallSeconds = 0.0;       // From the common start signal until the last worker finished
+    };
+
+    explicit ConcurrentDriver(int threads) : threads_(threads < 1 ? 1 : threads) {}
+
+    int threads() const { return threads_; }
+
+    /**
+     * Split items into contiguous, near-equal slices (one per thread), as views into items.
+     */
+    template<typename T>
+    static std::vector<BatchView<T>> partition(const std::vector<T>& items, int parts) {
+        std::vector<BatchView<T>> slices(parts);
+        BatchView<T> all(items);
+        size_t base = items.size() / parts;
+        size_t extra = items.size() % parts;
+        size_t offset = 0;
+        for (int i = 0; i < parts; i++) {
+            size_t length = base + (static_cast<size_t>(i) < extra ? 1 : 0);
+            slices[i] = all.slice(offset, length);
+            offset += length;
+        }
+        return slices;
+    }
+
+    /**
+     * Split a count into near-equal shares (one per thread).
+     */
+    static std::vector<int> partitionCount(int count, int parts) {
+        std::vector<int> shares(parts, count / parts);
+        for (int i = 0; i < count % parts; i++) {
+            shares[i]++;
+        }
+        return shares;
+    }
+
+    /**
+     * Execute work(threadIndex) on every worker thread and wait for all of them.
+     * Workers are released together once all of them are pinned and ready.
+     * The first exception thrown by a worker is rethrown after join.
+     *
+     * @param work Callable returning the per-batch latencies produced by that worker
+     */
+    template<typename Func>
+    Result run(Func work) {
+        std::vector<std::unique_ptr<LatencyHistogram>> histograms;
+        std::vector<std::vector<double>> latencies(threads_);
+        std::vector<std::exception_ptr> errors(threads_);
+        for (int i = 0; i < threads_; i++) {
+            histograms.push_back(std::make_unique<LatencyHistogram>());
+        }
+
+        std::vector<int> cpus = allowedCpus();
+        std::atomic<int> ready{0};
+        std::atomic<bool> go{false};
+
+        std::vector<std::thread> workers;
+        workers.reserve(threads_);
+        for (int i = 0; i < threads_; i++) {
+            workers.emplace_back([&, i]() {
+                if (!cpus.empty()) {
+                    pinCurrentThread(cpus[i % cpus.size()]);
+                }
+                ready.fetch_add(1);
+                while (!go.load(std::memory_order_acquire)) {
+                    std::this_thread::yield();
+                }
+                try {
+                    LatencyRecorder::Scope recorderScope(histograms[i].get());
+                    latencies[i] = work(i);
+                } catch (...) {
+                    errors[i] = std::current_exception();
+                }
+            });
+        }
+
+        while (ready.load() < threads_) {
+            std::this_thread::yield();
+        }
+        auto startTime = std::chrono::steady_clock::now();
+        go.store(true, std::memory_order_release);
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        auto endTime = std::chrono::steady_clock::now();
+
+        for (const auto& error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+
+        Result result;
+        result.wallSeconds = std::chrono::duration<double>(endTime - startTime).count();
+        for (int i = 0; i < threads_; i++) {
+            result.histogram.merge(*histograms[i]);
+            result.latencies.insert(result.latencies.end(), latencies[i].begin(), latencies[i].end());
+        }
+        return result;
+    }
+
+    /**
+     * CPUs the calling thread may run on (respects container cpusets and any
+     * affinity the caller set, e.g. the ThreadBudget benchmark CPUs).
+     */
+    static std::vector<int> allowedCpus() {
+        std::vector<int> cpus;
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        if (sched_getaffinity(0, sizeof(set), &set) != 0) {
+            return cpus;
+        }
+        for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+            if (CPU_ISSET(cpu, &set)) {
+                cpus.push_back(cpu);
+            }
+        }
+        return cpus;
+    }
+
+private:
+    int threads_;
+
+    static void pinCurrentThread(int cpu) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu, &set);
+        pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    }
+};
+
+} // namespace graphbench
@@ -0,0 +1,189 @@
+#pragma once
+
+#include <graphbench/benchmark_utils.hpp>
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#include <x86intrin.h>
+#endif
+
+namespace graphbench {
+
+using json = nlohmann::json;
+
+/**
+ * Low-overhead timestamp source for per-operation latencies.
+ *
+ * Reads the CPU timestamp counter directly (rdtscp on x86-64, cntvct_el0 on
+ * AArch64) instead of going through std::chrono and the vDSO, which for in-process
+ * reads costs about as much as the operation being timed. The tick rate is
+ * calibrated once against steady_clock; the same step measures the cost of one
+ * now() call so results can be overhead-corrected.
+ *
+ * TIMER_SOURCE selects the source: auto (default: the counter when it is
+ * invariant/constant-rate, else steady_clock), tsc, or chrono. Until calibrate()
+ * has run, now() reads steady_clock and ticks are nanoseconds.
+ */
+class CycleClock {
+public:
+    struct Calibration {
+        std::string source = "steady_clock";  // "rdtscp", "cntvct" or "steady_clock"
+        double ticksPerNs = 1.0;
+        double overheadNs = 0.0;              // Median cost of one now() call
+        double chronoOverheadNs = 0.0;        // Same, for steady_clock::now() (for comparison)
+        double calibrationMs = 0.0;
+
+        json toJson() const {
+            return {
+                {"source", source},
+                {"ticks_per_ns", ticksPerNs},
+                {"overhead_ns", overheadNs},
+                {"steady_clock_overhead_ns", chronoOverheadNs},
+                {"calibration_ms", calibrationMs}
+            };
+        }
+    };
+
+    /**
+     * Current timestamp in ticks of the active source.
+     */
+    static inline uint64_t now() {
+        if (counterActive_) {
+            return readCounter();
+        }
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    /** Convert a tick difference to nanoseconds */
+    static inline uint64_t toNs(uint64_t ticks) {
+        return static_cast<uint64_t>(static_cast<double>(ticks) * nsPerTick_);
+    }
+
+    /** Convert a duration in nanoseconds to ticks */
+    static inline uint64_t fromNs(double ns) {
+        return static_cast<uint64_t>(ns / nsPerTick_);
+    }
+
+    /** Convert a tick difference to microseconds */
+    static inline double toUs(uint64_t ticks) {
+        return static_cast<double>(ticks) * nsPerTick_ / 1000.0;
+    }
+
+    /**
+     * Select the source and calibrate it (once; later calls return the first result).
+     * Must run before client threads start timing operations.
+     */
+    static const Calibration& calibrate() {
+        static const Calibration calibration = runCalibration();
+        return calibration;
+    }
+
+private:
+    static inline bool counterActive_ = false;
+    static inline double nsPerTick_ = 1.0;
+
+    static constexpr int CALIBRATION_SPIN_MS = 20;
+    static constexpr int OVERHEAD_SAMPLES = 10001;
+
+    static inline uint64_t readCounter() {
+#if defined(__x86_64__) || defined(__i386__)
+        unsigned int aux;
+        return __rdtscp(&aux);
+#elif defined(__aarch64__)
+        uint64_t value;
+        asm volatile("isb; mrs %0, cntvct_el0" : "=r"(value) :: "memory");
+        return value;
+#else
+        return 0;
+#endif
+    }
+
+    /** Whether the counter ticks at a constant rate independent of frequency scaling and sleep */
+    static bool counterUsable() {
+#if defined(__x86_64__) || defined(__i386__)
+        unsigned int eax, ebx, ecx, edx;
+        if (!__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx)) {
+            return false;
+        }
+        return (edx & (1u << 8)) != 0;  // Invariant TSC
+#elif defined(__aarch64__)
+        return true;  // The generic timer runs at the constant cntfrq_el0 rate
+#else
+        return false;
+#endif
+    }
+
+    static std::string counterName() {
+#if defined(__aarch64__)
+        return "cntvct";
+#else
+        return "rdtscp";
+#endif
+    }
+
+    static double nowSteadyNs() {
+        return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    /** Median of back-to-back differences of a clock read, in that clock's units */
+    template<typename Read>
+    static double medianReadCost(Read read) {
+        std::vector<double> deltas;
+        deltas.reserve(OVERHEAD_SAMPLES);
+        double previous = read();
+        for (int i = 0; i < OVERHEAD_SAMPLES; i++) {
+            double current = read();
+            deltas.push_back(current - previous);
+            previous = current;
+        }
+        std::nth_element(deltas.begin(), deltas.begin() + deltas.size() / 2, deltas.end());
+        return deltas[deltas.size() / 2];
+    }
+
+    static Calibration runCalibration() {
+        auto started = std::chrono::steady_clock::now();
+        Calibration result;
+        result.chronoOverheadNs = medianReadCost(nowSteadyNs);
+
+        std::string mode = BenchmarkUtils::getEnv("TIMER_SOURCE", "auto");
+        bool useCounter = mode == "tsc" || (mode == "auto" && counterUsable());
+#if !defined(__x86_64__) && !defined(__i386__) && !defined(__aarch64__)
+        useCounter = false;
+#endif
+
+        if (useCounter) {
+            double startNs = nowSteadyNs();
+            uint64_t startTicks = readCounter();
+            double elapsedNs = 0.0;
+            while (elapsedNs < CALIBRATION_SPIN_MS * 1e6) {
+                elapsedNs = nowSteadyNs() - startNs;
+            }
+            uint64_t ticks = readCounter() - startTicks;
+            double ticksPerNs = static_cast<double>(ticks) / elapsedNs;
+
+            if (ticksPerNs > 0.0) {
+                result.source = counterName();
+                result.ticksPerNs = ticksPerNs;
+                result.overheadNs = medianReadCost([]() { return static_cast<double>(readCounter()); }) / ticksPerNs;
+                nsPerTick_ = 1.0 / ticksPerNs;
+                counterActive_ = true;
+            }
+        }
+        if (!counterActive_) {
+            result.overheadNs = result.chronoOverheadNs;
+        }
+
+        result.calibrationMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - started).count();
+        return result;
+    }
+};
+
+} // namespace graphbench
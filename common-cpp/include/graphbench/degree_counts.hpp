@@ -0,0 +1,80 @@
+#pragma once
+
+#include <graphbench/parallel_csv_reader.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace graphbench {
+
+/**
+ * Out- and in-degree of every origin vertex ID, counted from the edges a loader
+ * delivers during LOAD_GRAPH (see VertexSampler's "degree" distribution).
+ */
+struct DegreeCounts {
+    std::vector<uint32_t> out;
+    std::vector<uint32_t> in;
+
+    /** Count the (src, dst) rows of an edge batch; negative IDs are ignored */
+    void record(const CsvBatch& batch) {
+        for (size_t row = 0; row < batch.rows; row++) {
+            increment(out, batch.id(row, 0));
+            increment(in, batch.id(row, 1));
+        }
+    }
+
+    /** Pad or cut both arrays to vertices 0 .. n-1 */
+    void resize(size_t n) {
+        out.resize(n, 0);
+        in.resize(n, 0);
+    }
+
+private:
+    static void increment(std::vector<uint32_t>& degrees, int64_t id) {
+        if (id < 0) {
+            return;
+        }
+        if (static_cast<uint64_t>(id) >= degrees.size()) {
+            degrees.resize(static_cast<size_t>(id) + 1, 0);
+        }
+        degrees[static_cast<size_t>(id)]++;
+    }
+};
+
+/**
+ * Sink for the edges visited by LOAD_GRAPH, the load-time counterpart of
+ * TraversalRecorder. The dispatcher installs one DegreeCounts around the load and
+ * loaders report every edge batch they receive, so degree sampling never scans
+ * the edge file again. Not thread-local: loaders receive their batches on the
+ * thread that reads the file, which need not be the dispatcher's.
+ */
+class DegreeRecorder {
+public:
+    class Scope {
+    public:
+        explicit Scope(DegreeCounts* counts) : previous_(active()) {
+            active() = counts;
+        }
+        ~Scope() {
+            active() = previous_;
+        }
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        DegreeCounts* previous_;
+    };
+
+    static void recordEdges(const CsvBatch& batch) {
+        if (DegreeCounts* counts = active()) {
+            counts->record(batch);
+        }
+    }
+
+private:
+    static DegreeCounts*& active() {
+        static DegreeCounts* counts = nullptr;
+        return counts;
+    }
+};
+
+} // namespace graphbench
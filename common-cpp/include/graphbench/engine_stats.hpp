@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstdlib>
+#include <iterator>
+#include <map>
+#include <sstream>
+#include <string>
+
+namespace graphbench {
+
+/**
+ * Cumulative engine-internal counters of an executor, by name (RocksDB tickers for
+ * Aster, server metrics for ArangoDB). Empty when the executor reports none.
+ */
+using EngineCounters = std::map<std::string, double>;
+
+/**
+ * Helpers for the engine statistics the dispatcher records around every batch
+ * size run: one snapshot after the restore, one after the run, and their
+ * difference as "engine_stats" of the batch result.
+ */
+struct EngineStats {
+    /**
+     * Counters that changed between two snapshots (after - before), over the names
+     * of both. A counter missing from one snapshot counts as 0 there, so counters
+     * created during the run (lazily registered RocksDB tickers or Prometheus
+     * series) are reported with their full value. Unchanged counters are left out.
+     */
+    static EngineCounters delta(const EngineCounters& before, const EngineCounters& after) {
+        EngineCounters changed = after;
+        for (const auto& [name, value] : before) {
+            changed[name] -= value;
+        }
+        for (auto it = changed.begin(); it != changed.end();) {
+            it = it->second == 0 ? changed.erase(it) : std::next(it);
+        }
+        return changed;
+    }
+
+    /**
+     * Counter samples of a Prometheus text exposition (e.g. /_admin/metrics/v2).
+     * Only metrics declared "# TYPE <name> counter" are kept, since gauge and
+     * histogram deltas are not meaningful; labelled samples keep their labels in the
+     * name ("arangodb_foo_total{role=\"SINGLE\"}").
+     */
+    static EngineCounters parsePrometheusCounters(const std::string& text) {
+        EngineCounters counters;
+        std::string counterName;  // Family of the last "# TYPE ... counter" line
+        std::istringstream lines(text);
+        std::string line;
+        while (std::getline(lines, line)) {
+            if (line.empty()) {
+                continue;
+            }
+            if (line[0] == '#') {
+                std::istringstream comment(line);
+                std::string hash, keyword, name, type;
+                comment >> hash >> keyword >> name >> type;
+                if (keyword == "TYPE") {
+                    counterName = type == "counter" ? name : "";
+                }
+                continue;
+            }
+            size_t nameEnd = line.find_first_of("{ ");
+            if (counterName.empty() || line.compare(0, nameEnd, counterName) != 0) {
+                continue;
+            }
+            // The sample name runs to the closing brace of its labels, if any
+            size_t valueStart = line[nameEnd] == '{' ? line.find('}', nameEnd) : nameEnd;
+            if (valueStart == std::string::npos) {
+                continue;
+            }
+            valueStart = line[valueStart] == '}' ? valueStart + 1 : valueStart;
+            char* end = nullptr;
+            double value = std::strtod(line.c_str() + valueStart, &end);
+            if (end != line.c_str() + valueStart) {
+                counters[line.substr(0, valueStart)] = value;
+            }
+        }
+        return counters;
+    }
+};
+
+} // namespace graphbench
@@ -0,0 +1,217 @@
+#pragma once
+
+#include <nlohmann/json.hpp>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <algorithm>
+
+namespace graphbench {
+
+using json = nlohmann::json;
+
+/**
+ * Fixed-bucket log-linear latency histogram (HDR-style).
+ *
+ * Values are recorded in nanoseconds. The first SUB_BUCKET_COUNT values are
+ * stored exactly; above that every power of two is split into SUB_BUCKET_COUNT
+ * linear sub-buckets, which bounds the relative error to 1 / SUB_BUCKET_COUNT.
+ * All storage is inline, so recording never allocates or locks.
+ */
+class LatencyHistogram {
+public:
+    static constexpr int SUB_BUCKET_BITS = 7;
+    static constexpr uint64_t SUB_BUCKET_COUNT = uint64_t(1) << SUB_BUCKET_BITS;
+    static constexpr int MAX_VALUE_BITS = 40;  // ~18 minutes in nanoseconds
+    static constexpr uint64_t MAX_VALUE = (uint64_t(1) << MAX_VALUE_BITS) - 1;
+    static constexpr size_t BUCKET_COUNT = (MAX_VALUE_BITS - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT;
+
+    LatencyHistogram() { reset(); }
+
+    /**
+     * Record a single value in nanoseconds.
+     */
+    void record(uint64_t valueNs) {
+        record(valueNs, 1);
+    }
+
+    /**
+     * Record the same value @p count times (e.g. a batch latency amortized per operation).
+     */
+    void record(uint64_t valueNs, uint64_t count) {
+        if (count == 0) {
+            return;
+        }
+        uint64_t value = std::min(valueNs, MAX_VALUE);
+        counts_[bucketIndex(value)] += count;
+        totalCount_ += count;
+        sum_ += static_cast<double>(value) * count;
+        min_ = std::min(min_, value);
+        max_ = std::max(max_, value);
+    }
+
+    /**
+     * Add all values recorded in another histogram.
+     */
+    void merge(const LatencyHistogram& other) {
+        if (other.totalCount_ == 0) {
+            return;
+        }
+        for (size_t i = 0; i < BUCKET_COUNT; i++) {
+            counts_[i] += other.counts_[i];
+        }
+        totalCount_ += other.totalCount_;
+        sum_ += other.sum_;
+        min_ = std::min(min_, other.min_);
+        max_ = std::max(max_, other.max_);
+    }
+
+    void reset() {
+        counts_.fill(0);
+        totalCount_ = 0;
+        sum_ = 0.0;
+        min_ = std::numeric_limits<uint64_t>::max();
+        max_ = 0;
+    }
+
+    uint64_t count() const { return totalCount_; }
+    uint64_t minNs() const { return totalCount_ ? min_ : 0; }
+    uint64_t maxNs() const { return max_; }
+    double meanNs() const { return totalCount_ ? sum_ / totalCount_ : 0.0; }
+
+    /**
+     * Value at the given percentile (0-100), in nanoseconds.
+     * Returns the midpoint of the bucket holding the requested rank, clamped to the observed range.
+     */
+    uint64_t valueAtPercentile(double percentile) const {
+        if (totalCount_ == 0) {
+            return 0;
+        }
+        double clamped = std::min(std::max(percentile, 0.0), 100.0);
+        uint64_t rank = static_cast<uint64_t>(clamped / 100.0 * totalCount_ + 0.5);
+        rank = std::max<uint64_t>(rank, 1);
+
+        uint64_t seen = 0;
+        for (size_t i = 0; i < BUCKET_COUNT; i++) {
+            seen += counts_[i];
+            if (seen >= rank) {
+                uint64_t mid = bucketLowerBound(i) + (bucketWidth(i) - 1) / 2;
+                return std::min(std::max(mid, min_), max_);
+            }
+        }
+        return max_;
+    }
+
+    /**
+     * Percentile table in microseconds, suitable for a batch_results entry.
+     */
+    json percentilesJson() const {
+        return {
+            {"count", totalCount_},
+            {"min_us", minNs() / 1000.0},
+            {"mean_us", meanNs() / 1000.0},
+            {"p50_us", valueAtPercentile(50.0) / 1000.0},
+            {"p90_us", valueAtPercentile(90.0) / 1000.0},
+            {"p99_us", valueAtPercentile(99.0) / 1000.0},
+            {"p999_us", valueAtPercentile(99.9) / 1000.0},
+            {"max_us", maxNs() / 1000.0}
+        };
+    }
+
+    /**
+     * Non-empty buckets as [lower_us, upper_us, count] triples.
+     */
+    json bucketsJson() const {
+        json buckets = json::array();
+        for (size_t i = 0; i < BUCKET_COUNT; i++) {
+            if (counts_[i] == 0) {
+                continue;
+            }
+            uint64_t lower = bucketLowerBound(i);
+            uint64_t upper = lower + bucketWidth(i);
+            buckets.push_back({lower / 1000.0, upper / 1000.0, counts_[i]});
+        }
+        return buckets;
+    }
+
+private:
+    std::array<uint64_t, BUCKET_COUNT> counts_;
+    uint64_t totalCount_;
+    double sum_;
+    uint64_t min_;
+    uint64_t max_;
+
+    static int highestBit(uint64_t value) {
+        return 63 - __builtin_clzll(value);
+    }
+
+    static size_t bucketIndex(uint64_t value) {
+        if (value < SUB_BUCKET_COUNT) {
+            return static_cast<size_t>(value);
+        }
+        int shift = highestBit(value) - SUB_BUCKET_BITS;
+        uint64_t subBucket = (value >> shift) - SUB_BUCKET_COUNT;
+        return static_cast<size_t>((shift + 1) * SUB_BUCKET_COUNT + subBucket);
+    }
+
+    static uint64_t bucketLowerBound(size_t index) {
+        if (index < SUB_BUCKET_COUNT) {
+            return index;
+        }
+        uint64_t group = index >> SUB_BUCKET_BITS;
+        uint64_t subBucket = index & (SUB_BUCKET_COUNT - 1);
+        return (SUB_BUCKET_COUNT + subBucket) << (group - 1);
+    }
+
+    static uint64_t bucketWidth(size_t index) {
+        if (index < SUB_BUCKET_COUNT) {
+            return 1;
+        }
+        uint64_t group = index >> SUB_BUCKET_BITS;
+        return uint64_t(1) << (group - 1);
+    }
+};
+
+/**
+ * Thread-local sink for per-operation latencies.
+ * The dispatcher installs a histogram around a timed region with LatencyRecorder::Scope;
+ * executors call LatencyRecorder::record() from their batch helpers. Recording is a
+ * thread-local pointer load plus a bucket increment, and a no-op when no scope is active.
+ */
+class LatencyRecorder {
+public:
+    class Scope {
+    public:
+        explicit Scope(LatencyHistogram* histogram) : previous_(active()) {
+            active() = histogram;
+        }
+        ~Scope() {
+            active() = previous_;
+        }
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        LatencyHistogram* previous_;
+    };
+
+    static void record(uint64_t valueNs) {
+        if (LatencyHistogram* histogram = active()) {
+            histogram->record(valueNs);
+        }
+    }
+
+    static void record(uint64_t valueNs, uint64_t count) {
+        if (LatencyHistogram* histogram = active()) {
+            histogram->record(valueNs, count);
+        }
+    }
+
+private:
+    static LatencyHistogram*& active() {
+        static thread_local LatencyHistogram* histogram = nullptr;
+        return histogram;
+    }
+};
+
+} // namespace graphbench
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <atomic>
+#include <optional>
+#include <utility>
+
+namespace graphbench {
+
+/**
+ * Unbounded lock-free multi-producer, single-consumer FIFO (Vyukov's intrusive
+ * node queue). push() is one atomic exchange and never blocks; pop() may only be
+ * called from the single consumer thread. Elements come out in the order their
+ * push() exchanges happened, so events of one producer stay in order.
+ *
+ * A pop() racing with a push() that has exchanged the head but not yet linked its
+ * node returns nothing; the element is returned by a later pop().
+ */
+template<typename T>
+class MpscQueue {
+public:
+    MpscQueue() : head_(new Node()), tail_(head_.load(std::memory_order_relaxed)) {}
+
+    ~MpscQueue() {
+        while (pop()) {
+        }
+        delete tail_;
+    }
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    void push(T value) {
+        Node* node = new Node(std::move(value));
+        Node* previous = head_.exchange(node, std::memory_order_acq_rel);
+        previous->next.store(node, std::memory_order_release);
+    }
+
+    /** Consumer only */
+    std::optional<T> pop() {
+        Node* tail = tail_;
+        Node* next = tail->next.load(std::memory_order_acquire);
+        if (!next) {
+            return std::nullopt;
+        }
+        std::optional<T> value(std::move(next->value));
+        tail_ = next;  // next becomes the new stub
+        delete tail;
+        return value;
+    }
+
+private:
+    struct Node {
+        std::atomic<Node*> next{nullptr};
+        T value;
+
+        Node() = default;
+        explicit Node(T v) : value(std::move(v)) {}
+    };
+
+    std::atomic<Node*> head_;  // Last pushed node (producers)
+    Node* tail_;               // Stub before the oldest element (consumer)
+};
+
+} // namespace graphbench
@@ -1,20 +1,48 @@
 #pragma once
 
+#include <cstdint>
 #include <vector>
 #include <stdexcept>
 #include <string>
 #include <fstream>
 #include <limits>
 #include <memory>
+#include <graphbench/parallel_csv_reader.hpp>
+#include <graphbench/synthetic_graph.hpp>
 
 namespace graphbench {
 
 // Forward declaration
 class ProgressCallback;
 
+/**
+ * One bit per CSV node ID, set once the node is loaded.
+ * Lets mappings check for loaded nodes with a bit test instead of comparing the
+ * stored value against a sentinel (a string compare for string keys).
+ */
+class LoadedMask {
+public:
+    explicit LoadedMask(size_t node_count = 0) : words_((node_count + 63) / 64, 0), size_(node_count) {}
+
+    void set(size_t index) { words_[index >> 6] |= uint64_t(1) << (index & 63); }
+
+    /** Whether index is in range and loaded */
+    bool test(int64_t node_id) const {
+        size_t index = static_cast<size_t>(node_id);
+        return node_id >= 0 && index < size_ && (words_[index >> 6] >> (index & 63) & 1);
+    }
+
+    size_t size() const { return size_; }
+
+private:
+    std::vector<uint64_t> words_;
+    size_t size_;
+};
+
 /**
  * Manages mapping from CSV node IDs (0-indexed sequential) to database-internal node IDs.
- * Uses std::vector for O(1) access with minimal memory overhead.
+ * Uses std::vector for O(1) access with minimal memory overhead, and a LoadedMask
+ * to tell loaded entries from unset ones.
  */
 template<typename T>
 class NodeIdMapping {
@@ -27,7 +55,8 @@ public:
      * @param progress_callback Callback for error reporting (optional)
      */
     NodeIdMapping(size_t node_count, const T& unset_value, ProgressCallback* progress_callback = nullptr)
-        : unset_value_(unset_value), node_ids_(node_count, unset_value), progress_callback_(progress_callback) {}
+        : unset_value_(unset_value), node_ids_(node_count, unset_value), loaded_(node_count),
+          progress_callback_(progress_callback) {}
 
     /**
      * Set the internal ID for a given node.
@@ -46,6 +75,7 @@ public:
             throw std::runtime_error(errorMsg);
         }
         node_ids_[index] = internal_id;
+        loaded_.set(index);
     }
 
     /**
@@ -68,9 +98,7 @@ public:
             throw std::runtime_error(errorMsg);
         }
 
-        const T& internal_id = node_ids_[index];
-
-        if (internal_id == unset_value_) {
+        if (!loaded_.test(node_id)) {
             std::string errorMsg = "Invalid " + context + " node ID " + std::to_string(node_id) +
                                    ": node not loaded yet";
             if (progress_callback_) {
@@ -79,7 +107,7 @@ public:
             throw std::runtime_error(errorMsg);
         }
 
-        return internal_id;
+        return node_ids_[index];
     }
 
     /**
@@ -92,18 +120,12 @@ public:
      * @return Database-internal node ID, or unset_value if invalid/not loaded
      */
     T get_or_default(int64_t node_id, bool* found = nullptr) const {
-        size_t index = static_cast<size_t>(node_id);
-        if (node_id < 0 || index >= node_ids_.size()) {
-            if (found) *found = false;
-            return unset_value_;
-        }
-        const T& internal_id = node_ids_[index];
-        if (internal_id == unset_value_) {
+        if (!loaded_.test(node_id)) {
             if (found) *found = false;
             return unset_value_;
         }
         if (found) *found = true;
-        return internal_id;
+        return node_ids_[static_cast<size_t>(node_id)];
     }
 
     /**
@@ -121,32 +143,20 @@ public:
     }
 
     /**
-     * Count nodes from nodes.csv file.
+     * Count nodes from nodes.csv file (newline scan over the memory-mapped file),
+     * or from the specification of a synthetic dataset (see SyntheticGraph).
      *
      * @param dataset_path Path to dataset directory containing nodes.csv
      * @return Number of nodes (excluding header)
      */
     static size_t count_nodes_from_csv(const std::string& dataset_path) {
-        std::string nodes_file = dataset_path + "/nodes.csv";
-        std::ifstream file(nodes_file);
-        if (!file.is_open()) {
-            throw std::runtime_error("Failed to open nodes.csv: " + nodes_file);
-        }
-
-        std::string line;
-        std::getline(file, line); // Skip header
-
-        size_t count = 0;
-        while (std::getline(file, line)) {
-            count++;
-        }
-
-        return count;
+        return SyntheticGraph::countNodes(dataset_path);
     }
 
 private:
     T unset_value_;
     std::vector<T> node_ids_;
+    LoadedMask loaded_;
     ProgressCallback* progress_callback_;
 };
 
@@ -228,21 +238,7 @@ public:
     }
 
     static size_t count_nodes_from_csv(const std::string& dataset_path) {
-        std::string nodes_file = dataset_path + "/nodes.csv";
-        std::ifstream file(nodes_file);
-        if (!file.is_open()) {
-            throw std::runtime_error("Failed to open nodes.csv: " + nodes_file);
-        }
-
-        std::string line;
-        std::getline(file, line); // Skip header
-
-        size_t count = 0;
-        while (std::getline(file, line)) {
-            count++;
-        }
-
-        return count;
+        return SyntheticGraph::countNodes(dataset_path);
     }
 
 private:
@@ -0,0 +1,620 @@
+#pragma once
+
+#include <graphbench/benchmark_executor.hpp>
+#include <graphbench/progress_callback.hpp>
+#include <graphbench/csv_graph_reader.hpp>
+#include <graphbench/degree_counts.hpp>
+#include <graphbench/latency_histogram.hpp>
+#include <graphbench/cycle_clock.hpp>
+#include <graphbench/traversal.hpp>
+#include <string>
+#include <vector>
+#include <map>
+#include <any>
+#include <optional>
+#include <algorithm>
+#include <memory>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <stdexcept>
+#include <utility>
+
+namespace graphbench {
+
+/**
+ * Reference executor without a database, to tell the harness's share of a reported
+ * latency from the engine's. Registered as "null" and "csr" by docker/null.
+ *
+ *   NONE  every operation returns at once, so its latencies are the harness floor:
+ *         the clock reads, batch loop and LatencyRecorder call around each operation,
+ *         which every executor pays as well (the plot scripts subtract them with
+ *         --subtract-floor). LOAD_GRAPH still reads the dataset and only counts it,
+ *         so its duration is the cost of the reader.
+ *   CSR   the loaded graph as in-memory CSR arrays (out and in adjacency), read
+ *         without any indirection: the speed-of-light baseline for GET_NBRS and the
+ *         traversals. Updates after the load go to a delta (added vertices and
+ *         edges, removed vertices and edges) behind a shared mutex, which reads
+ *         only take once there is one; restoreGraph() drops the delta, so there is
+ *         no snapshot to write or copy.
+ *
+ * System IDs are the origin IDs, so neither mode pays for an ID mapping. The CSR is
+ * built in two passes over the edges (degree count, then placement), so no edge list
+ * is buffered while loading.
+ */
+class NullBenchmarkExecutor : public BenchmarkExecutor<NullBenchmarkExecutor, int64_t> {
+public:
+    enum class Storage { NONE, CSR };
+
+    explicit NullBenchmarkExecutor(Storage storage)
+        : storage_(storage),
+          progressCallback_(nullptr),
+          errorCount_(0) {}
+
+    virtual ~NullBenchmarkExecutor() = default;
+
+    // Implementation methods for CRTP
+    void initDatabaseImpl() {
+        clearGraph();
+        if (progressCallback_) {
+            progressCallback_->sendLogMessage(getDatabaseNameImpl() + " executor initialized", "INFO");
+        }
+    }
+
+    void shutdownImpl() {
+        clearGraph();
+        if (progressCallback_) {
+            progressCallback_->sendLogMessage(getDatabaseNameImpl() + " executor shutdown", "INFO");
+        }
+    }
+
+    std::map<std::string, std::any> loadGraphImpl(const std::string& datasetPath) {
+        auto start = std::chrono::high_resolution_clock::now();
+        clearGraph();
+
+        // Node IDs come first; vertices are the origin IDs 0 .. max ID
+        std::vector<int64_t> nodeIds;
+        auto collectNodes = [&nodeIds](const CsvBatch& batch) {
+            for (size_t row = 0; row < batch.rows; row++) {
+                nodeIds.push_back(batch.id(row));
+            }
+        };
+        int64_t edgeCount = 0;
+        auto countEdges = [this, &nodeIds, &edgeCount](const CsvBatch& batch) {
+            if (vertexCount_ == 0 && !nodeIds.empty()) {
+                addNodes(nodeIds);
+            }
+            DegreeRecorder::recordEdges(batch);
+            for (size_t row = 0; row < batch.rows; row++) {
+                int64_t src = batch.id(row, 0);
+                int64_t dst = batch.id(row, 1);
+                if (!isBaseVertex(src) || !isBaseVertex(dst)) {
+                    continue;
+                }
+                edgeCount++;
+                if (storage_ == Storage::CSR) {
+                    outOffsets_[src + 1]++;
+                    inOffsets_[dst + 1]++;
+                }
+            }
+        };
+        CsvGraphReader::readBatches(datasetPath, false, collectNodes, countEdges);
+        if (vertexCount_ == 0 && !nodeIds.empty()) {
+            addNodes(nodeIds);  // A graph without edges
+        }
+        int64_t nodeCount = static_cast<int64_t>(nodeIds.size());
+        std::vector<int64_t>().swap(nodeIds);
+
+        if (storage_ == Storage::CSR) {
+            // Second pass: place each edge at its source's (and destination's) cursor
+            for (int64_t vertex = 0; vertex < vertexCount_; vertex++) {
+                outOffsets_[vertex + 1] += outOffsets_[vertex];
+                inOffsets_[vertex + 1] += inOffsets_[vertex];
+            }
+            outTargets_.resize(static_cast<size_t>(edgeCount));
+            inSources_.resize(static_cast<size_t>(edgeCount));
+            std::vector<uint64_t> outCursor(outOffsets_.begin(), outOffsets_.end() - 1);
+            std::vector<uint64_t> inCursor(inOffsets_.begin(), inOffsets_.end() - 1);
+            auto placeEdges = [&](const CsvBatch& batch) {
+                for (size_t row = 0; row < batch.rows; row++) {
+                    int64_t src = batch.id(row, 0);
+                    int64_t dst = batch.id(row, 1);
+                    if (isBaseVertex(src) && isBaseVertex(dst)) {
+                        outTargets_[outCursor[src]++] = dst;
+                        inSources_[inCursor[dst]++] = src;
+                    }
+                }
+            };
+            CsvGraphReader::readBatches(datasetPath, false, [](const CsvBatch&) {}, placeEdges);
+        }
+        nextVertexId_ = vertexCount_;
+
+        double durationSeconds = std::chrono::duration<double>(
+            std::chrono::high_resolution_clock::now() - start).count();
+        if (progressCallback_) {
+            progressCallback_->sendLogMessage("Loaded " + std::to_string(nodeCount) + " nodes and " +
+                                              std::to_string(edgeCount) + " edges", "INFO");
+        }
+
+        std::map<std::string, std::any> result;
+        result["nodes"] = static_cast<int>(nodeCount);
+        result["edges"] = static_cast<int>(edgeCount);
+        result["duration_seconds"] = durationSeconds;
+        result["load_mode"] = std::string(storage_ == Storage::CSR ? "csr" : "count-only");
+        return result;
+    }
+
+    // Helper function: execute operation in batches (count-based)
+    // Same timing loop as the database executors, so the NONE latencies are their floor.
+    template<typename Operation>
+    std::vector<double> executeBatchOperation(int count, int batchSize, Operation op) {
+        std::vector<double> latencies;
+        int processed = 0;
+
+        while (processed < count) {
+            int batchCount = std::min(batchSize, count - processed);
+
+            uint64_t start = CycleClock::now();
+            uint64_t opStart = start;
+
+            for (int i = 0; i < batchCount; i++) {
+                try {
+                    op();
+                } catch (const std::exception& e) {
+                    errorCount_++;
+                }
+                uint64_t opEnd = CycleClock::now();
+                LatencyRecorder::record(CycleClock::toNs(opEnd - opStart));
+                opStart = opEnd;
+            }
+
+            double totalLatency = CycleClock::toUs(opStart - start);
+            double perOpLatency = totalLatency / batchCount;
+            latencies.push_back(perOpLatency);
+
+            processed += batchCount;
+        }
+
+        return latencies;
+    }
+
+    // Helper function: execute operation in batches (item-based)
+    // Measures latency per item; each item is also recorded into the active LatencyRecorder.
+    template<typename Container, typename Operation>
+    std::vector<double> executeBatchOperation(const Container& items, int batchSize, Operation op) {
+        std::vector<double> latencies;
+        size_t processed = 0;
+
+        while (processed < items.size()) {
+            size_t batchCount = std::min(static_cast<size_t>(batchSize), items.size() - processed);
+
+            uint64_t start = CycleClock::now();
+            uint64_t opStart = start;
+
+            for (size_t i = 0; i < batchCount; i++) {
+                try {
+                    op(items[processed + i]);
+                } catch (const std::exception& e) {
+                    errorCount_++;
+                }
+                uint64_t opEnd = CycleClock::now();
+                LatencyRecorder::record(CycleClock::toNs(opEnd - opStart));
+                opStart = opEnd;
+            }
+
+            double totalLatency = CycleClock::toUs(opStart - start);
+            double perOpLatency = totalLatency / batchCount;
+            latencies.push_back(perOpLatency);
+
+            processed += batchCount;
+        }
+
+        return latencies;
+    }
+
+    std::vector<double> addVertexImpl(int count, int batchSize) {
+        return executeBatchOperation(count, batchSize, [this]() {
+            nextVertexId_++;
+            if (storage_ == Storage::CSR) {
+                hasDelta_.store(true, std::memory_order_release);
+            }
+        });
+    }
+
+    std::vector<double> removeVertexImpl(BatchView<int64_t> systemIds, int batchSize) {
+        return executeBatchOperation(systemIds, batchSize, [this](int64_t vertex) {
+            if (storage_ == Storage::NONE) {
+                return;
+            }
+            std::unique_lock<std::shared_mutex> lock(deltaMutex_);
+            if (!exists(vertex) || !delta_.removedVertices.insert(vertex).second) {
+                errorCount_++;
+                return;
+            }
+            delta_.out.erase(vertex);
+            delta_.in.erase(vertex);
+            hasDelta_.store(true, std::memory_order_release);
+        });
+    }
+
+    std::vector<double> addEdgeImpl(const std::string& /*label*/,
+                                    BatchView<std::pair<int64_t, int64_t>> pairs,
+                                    int batchSize) {
+        return executeBatchOperation(pairs, batchSize, [this](const std::pair<int64_t, int64_t>& pair) {
+            if (storage_ == Storage::NONE) {
+                return;
+            }
+            std::unique_lock<std::shared_mutex> lock(deltaMutex_);
+            if (!exists(pair.first) || !exists(pair.second)) {
+                errorCount_++;
+                return;
+            }
+            delta_.out[pair.first].push_back(pair.second);
+            delta_.in[pair.second].push_back(pair.first);
+            hasDelta_.store(true, std::memory_order_release);
+        });
+    }
+
+    std::vector<double> removeEdgeImpl(const std::string& /*label*/,
+                                       BatchView<std::pair<int64_t, int64_t>> pairs,
+                                       int batchSize) {
+        return executeBatchOperation(pairs, batchSize, [this](const std::pair<int64_t, int64_t>& pair) {
+            if (storage_ == Storage::NONE) {
+                return;
+            }
+            std::unique_lock<std::shared_mutex> lock(deltaMutex_);
+            // Removes every parallel edge, loaded or added
+            eraseValue(delta_.out, pair.first, pair.second);
+            eraseValue(delta_.in, pair.second, pair.first);
+            delta_.removedEdges.insert(edgeKey(pair.first, pair.second));
+            hasDelta_.store(true, std::memory_order_release);
+        });
+    }
+
+    std::vector<double> getNbrsImpl(const std::string& direction,
+                                    BatchView<int64_t> systemIds,
+                                    int batchSize) {
+        bool out = direction != "IN" && direction != "INCOMING";
+        bool in = direction != "OUT" && direction != "OUTGOING";
+        return executeBatchOperation(systemIds, batchSize, [this, out, in](int64_t vertex) {
+            if (storage_ == Storage::NONE) {
+                return;
+            }
+            // Touch every neighbor of the requested direction
+            bool found = forEachNeighbor(vertex, out, in, [](int64_t neighbor) {
+                volatile int64_t touched = neighbor;
+                (void)touched;
+                return true;
+            });
+            if (!found) {
+                errorCount_++;
+            }
+        });
+    }
+
+    // Traversals are level-synchronous BFS over the CSR, like the harness-side
+    // traversals of Aster. Visited counts go to the active TraversalRecorder.
+    std::vector<double> kHopImpl(const std::string& direction, int depth,
+                                 BatchView<int64_t> systemIds,
+                                 int batchSize) {
+        return executeBatchOperation(systemIds, batchSize, [this, &direction, depth](int64_t start) {
+            TraversalRecorder::recordQuery(traverse(start, direction, depth, std::nullopt).visited);
+        });
+    }
+
+    std::vector<double> bfsImpl(const std::string& direction, int maxDepth,
+                                BatchView<int64_t> systemIds,
+                                int batchSize) {
+        return executeBatchOperation(systemIds, batchSize, [this, &direction, maxDepth](int64_t start) {
+            TraversalRecorder::recordQuery(traverse(start, direction, maxDepth, std::nullopt).visited);
+        });
+    }
+
+    std::vector<double> shortestPathImpl(const std::string& direction, int maxDepth,
+                                         BatchView<std::pair<int64_t, int64_t>> pairs,
+                                         int batchSize) {
+        return executeBatchOperation(pairs, batchSize, [this, &direction, maxDepth](const std::pair<int64_t, int64_t>& pair) {
+            TraversalResult found = traverse(pair.first, direction, maxDepth, pair.second);
+            TraversalRecorder::recordQuery(found.visited);
+            TraversalRecorder::recordPath(found.targetDepth >= 0, static_cast<uint64_t>(std::max(found.targetDepth, 0)));
+        });
+    }
+
+    std::string getDatabaseNameImpl() const {
+        return storage_ == Storage::CSR ? "In-memory CSR" : "Null";
+    }
+
+    // The graph lives in memory only: there is no database directory or snapshot
+    std::string getDatabasePathImpl() const {
+        return "";
+    }
+
+    std::string getSnapshotPathImpl() const {
+        return "";
+    }
+
+    void closeDatabaseImpl() {}
+
+    void openDatabaseImpl() {}
+
+    /** The loaded graph is never modified, so the snapshot is the graph itself */
+    RestoreStats snapGraphImpl() {
+        RestoreStats stats;
+        stats.strategy = "in-memory";
+        return stats;
+    }
+
+    /** Drop the delta of the previous batch size run */
+    RestoreStats restoreGraphImpl() {
+        auto start = std::chrono::high_resolution_clock::now();
+        RestoreStats stats;
+        stats.strategy = "in-memory";
+        {
+            std::unique_lock<std::shared_mutex> lock(deltaMutex_);
+            stats.itemsReverted = static_cast<uint64_t>(nextVertexId_.load() - vertexCount_) +
+                                  delta_.removedVertices.size() + delta_.removedEdges.size();
+            for (const auto& [vertex, neighbors] : delta_.out) {
+                stats.itemsReverted += neighbors.size();
+            }
+            delta_ = Delta();
+            nextVertexId_ = vertexCount_;
+            hasDelta_.store(false, std::memory_order_release);
+        }
+        stats.seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+        return stats;
+    }
+
+    /** Read both adjacency arrays once, so a warm run starts with them in the CPU caches and TLB */
+    bool prewarmCacheImpl() {
+        if (storage_ == Storage::NONE) {
+            return false;
+        }
+        int64_t sum = 0;
+        for (int64_t neighbor : outTargets_) {
+            sum += neighbor;
+        }
+        for (int64_t neighbor : inSources_) {
+            sum += neighbor;
+        }
+        volatile int64_t touched = sum;
+        (void)touched;
+        return true;
+    }
+
+    int getErrorCountImpl() const {
+        return errorCount_;
+    }
+
+    void resetErrorCountImpl() {
+        errorCount_ = 0;
+    }
+
+    std::optional<int64_t> getSystemIdImpl(int64_t originId) const {
+        if (isBaseVertex(originId)) {
+            return originId;
+        }
+        return std::nullopt;
+    }
+
+    ProgressCallback* getProgressCallback() {
+        return progressCallback_.get();
+    }
+
+    void setProgressCallback(std::unique_ptr<ProgressCallback> callback) {
+        progressCallback_ = std::move(callback);
+    }
+
+private:
+    // Updates since the load, reverted by restoreGraph()
+    struct Delta {
+        std::unordered_map<int64_t, std::vector<int64_t>> out;  // Added edges by source
+        std::unordered_map<int64_t, std::vector<int64_t>> in;   // Added edges by destination
+        std::unordered_set<int64_t> removedVertices;
+        std::unordered_set<uint64_t> removedEdges;              // Loaded edges, by edgeKey()
+    };
+
+    Storage storage_;
+    std::unique_ptr<ProgressCallback> progressCallback_;
+    std::atomic<int> errorCount_;            // Shared by concurrent client threads
+
+    int64_t vertexCount_ = 0;                // Max loaded origin ID + 1
+    std::vector<bool> loaded_;               // Origin IDs present in the dataset
+    std::vector<uint64_t> outOffsets_;       // CSR: vertexCount_ + 1 offsets into outTargets_
+    std::vector<int64_t> outTargets_;
+    std::vector<uint64_t> inOffsets_;        // CSR: vertexCount_ + 1 offsets into inSources_
+    std::vector<int64_t> inSources_;
+
+    std::atomic<int64_t> nextVertexId_{0};   // Added vertices are vertexCount_ .. nextVertexId_ - 1
+    std::atomic<bool> hasDelta_{false};      // Reads skip the lock while the graph is as loaded
+    mutable std::shared_mutex deltaMutex_;
+    Delta delta_;
+
+    struct TraversalResult {
+        uint64_t visited = 0;  // Distinct vertices reached, excluding the start
+        int targetDepth = -1;  // Hops to the target, -1 if not reached
+    };
+
+    // Reused per client thread so traversals do not allocate in the timed loop
+    struct TraversalState {
+        VisitedBitmap visited;
+        std::vector<int64_t> frontier;
+        std::vector<int64_t> next;
+    };
+
+    static TraversalState& traversalState() {
+        static thread_local TraversalState state;
+        return state;
+    }
+
+    static uint64_t edgeKey(int64_t src, int64_t dst) {
+        // Unique for IDs below 2^32, a hash beyond
+        return (static_cast<uint64_t>(src) << 32) ^ static_cast<uint64_t>(dst);
+    }
+
+    static void eraseValue(std::unordered_map<int64_t, std::vector<int64_t>>& lists, int64_t key, int64_t value) {
+        auto it = lists.find(key);
+        if (it != lists.end()) {
+            it->second.erase(std::remove(it->second.begin(), it->second.end(), value), it->second.end());
+        }
+    }
+
+    void clearGraph() {
+        vertexCount_ = 0;
+        std::vector<bool>().swap(loaded_);
+        std::vector<uint64_t>().swap(outOffsets_);
+        std::vector<int64_t>().swap(outTargets_);
+        std::vector<uint64_t>().swap(inOffsets_);
+        std::vector<int64_t>().swap(inSources_);
+        delta_ = Delta();
+        nextVertexId_ = 0;
+        hasDelta_ = false;
+    }
+
+    void addNodes(const std::vector<int64_t>& nodeIds) {
+        int64_t maxId = -1;
+        for (int64_t id : nodeIds) {
+            maxId = std::max(maxId, id);
+        }
+        vertexCount_ = maxId + 1;
+        loaded_.assign(static_cast<size_t>(vertexCount_), false);
+        for (int64_t id : nodeIds) {
+            if (id >= 0) {
+                loaded_[id] = true;
+            }
+        }
+        if (storage_ == Storage::CSR) {
+            outOffsets_.assign(static_cast<size_t>(vertexCount_) + 1, 0);
+            inOffsets_.assign(static_cast<size_t>(vertexCount_) + 1, 0);
+        }
+    }
+
+    bool isBaseVertex(int64_t vertex) const {
+        return vertex >= 0 && vertex < vertexCount_ && loaded_[vertex];
+    }
+
+    // Caller holds deltaMutex_ (or there is no delta)
+    bool exists(int64_t vertex) const {
+        bool present = isBaseVertex(vertex) || (vertex >= vertexCount_ && vertex < nextVertexId_.load());
+        return present && !delta_.removedVertices.count(vertex);
+    }
+
+    /**
+     * Call visit(neighbor) for the neighbors of vertex in the given directions until
+     * it returns false.
+     * @return Whether the vertex exists
+     */
+    template<typename Visit>
+    bool forEachNeighbor(int64_t vertex, bool out, bool in, Visit&& visit) const {
+        if (!hasDelta_.load(std::memory_order_acquire)) {
+            if (!isBaseVertex(vertex)) {
+                return false;
+            }
+            for (uint64_t j = outOffsets_[vertex]; out && j < outOffsets_[vertex + 1]; j++) {
+                if (!visit(outTargets_[j])) {
+                    return true;
+                }
+            }
+            for (uint64_t j = inOffsets_[vertex]; in && j < inOffsets_[vertex + 1]; j++) {
+                if (!visit(inSources_[j])) {
+                    return true;
+                }
+            }
+            return true;
+        }
+
+        std::shared_lock<std::shared_mutex> lock(deltaMutex_);
+        if (!exists(vertex)) {
+            return false;
+        }
+        auto live = [this](int64_t neighbor, int64_t src, int64_t dst) {
+            return !delta_.removedVertices.count(neighbor) && !delta_.removedEdges.count(edgeKey(src, dst));
+        };
+        if (isBaseVertex(vertex)) {
+            for (uint64_t j = outOffsets_[vertex]; out && j < outOffsets_[vertex + 1]; j++) {
+                if (live(outTargets_[j], vertex, outTargets_[j]) && !visit(outTargets_[j])) {
+                    return true;
+                }
+            }
+            for (uint64_t j = inOffsets_[vertex]; in && j < inOffsets_[vertex + 1]; j++) {
+                if (live(inSources_[j], inSources_[j], vertex) && !visit(inSources_[j])) {
+                    return true;
+                }
+            }
+        }
+        auto visitAdded = [&](const std::unordered_map<int64_t, std::vector<int64_t>>& lists) {
+            auto it = lists.find(vertex);
+            if (it == lists.end()) {
+                return true;
+            }
+            for (int64_t neighbor : it->second) {
+                if (!delta_.removedVertices.count(neighbor) && !visit(neighbor)) {
+                    return false;
+                }
+            }
+            return true;
+        };
+        if (out && !visitAdded(delta_.out)) {
+            return true;
+        }
+        if (in) {
+            visitAdded(delta_.in);
+        }
+        return true;
+    }
+
+    /**
+     * Level-synchronous BFS from start over at most maxDepth levels (0 = until the
+     * frontier is empty), stopping as soon as target is reached. Does nothing in
+     * NONE mode.
+     */
+    TraversalResult traverse(int64_t start, const std::string& direction, int maxDepth,
+                             std::optional<int64_t> target) {
+        TraversalResult result;
+        if (storage_ == Storage::NONE) {
+            return result;
+        }
+        bool out = direction != "IN" && direction != "INCOMING";
+        bool in = direction != "OUT" && direction != "OUTGOING";
+
+        if (target && *target == start) {
+            result.targetDepth = 0;
+            return result;
+        }
+
+        TraversalState& state = traversalState();
+        state.visited.clear();
+        state.frontier.clear();
+        state.visited.insert(static_cast<uint64_t>(start));
+        state.frontier.push_back(start);
+
+        for (int depth = 1; !state.frontier.empty() && (maxDepth == 0 || depth <= maxDepth); depth++) {
+            state.next.clear();
+            for (int64_t vertex : state.frontier) {
+                bool found = forEachNeighbor(vertex, out, in, [&](int64_t neighbor) {
+                    if (state.visited.insert(static_cast<uint64_t>(neighbor))) {
+                        state.next.push_back(neighbor);
+                        result.visited++;
+                    }
+                    if (target && neighbor == *target) {
+                        result.targetDepth = depth;
+                        return false;
+                    }
+                    return true;
+                });
+                if (!found && vertex == start) {
+                    errorCount_++;
+                }
+                if (result.targetDepth >= 0) {
+                    return result;
+                }
+            }
+            std::swap(state.frontier, state.next);
+        }
+        return result;
+    }
+};
+
+} // namespace graphbench
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string_view>
+#include <type_traits>
+
+namespace graphbench {
+
+/** Buffer size that holds any text written by formatShortest */
+constexpr size_t SHORTEST_FORMAT_BYTES = 32;
+
+/**
+ * Parse the whole of text as a float or double. Fails on trailing characters and on
+ * text longer than SHORTEST_FORMAT_BYTES - 1, which no formatShortest output is.
+ */
+template<typename T>
+bool parseFloating(std::string_view text, T* value) {
+    static_assert(std::is_floating_point_v<T>, "parseFloating takes float or double");
+    char buffer[SHORTEST_FORMAT_BYTES];
+    if (text.empty() || text.size() >= sizeof(buffer)) {
+        return false;
+    }
+    std::memcpy(buffer, text.data(), text.size());
+    buffer[text.size()] = '\0';
+    char* end = nullptr;
+    if constexpr (std::is_same_v<T, float>) {
+        *value = std::strtof(buffer, &end);
+    } else {
+        *value = static_cast<T>(std::strtod(buffer, &end));
+    }
+    return end == buffer + text.size();
+}
+
+/**
+ * Shortest decimal text of a float or double that parses back to the same value, in
+ * the form of std::to_chars(first, last, value): fixed notation unless scientific is
+ * shorter ("100000", "0.001", "1e+20", "1e-05"). Built on snprintf/strtod because the
+ * floating-point to_chars overloads need GCC 11 and the ArangoDB image has GCC 9.
+ * buffer must hold SHORTEST_FORMAT_BYTES; returns the length written (not terminated).
+ */
+template<typename T>
+size_t formatShortest(char* buffer, T value) {
+    static_assert(std::is_floating_point_v<T>, "formatShortest takes float or double");
+    if (!std::isfinite(value)) {
+        return static_cast<size_t>(std::snprintf(buffer, SHORTEST_FORMAT_BYTES, "%g", static_cast<double>(value)));
+    }
+
+    // Fewest significant digits that round-trip, in scientific form: [-]d[.ddd]e±XX
+    char scientific[SHORTEST_FORMAT_BYTES];
+    int length = 0;
+    T parsed = 0;
+    for (int digits = 1; digits <= std::numeric_limits<T>::max_digits10; digits++) {
+        length = std::snprintf(scientific, sizeof(scientific), "%.*e", digits - 1, static_cast<double>(value));
+        if (parseFloating(std::string_view(scientific, length), &parsed) && parsed == value) {
+            break;
+        }
+    }
+
+    const char* exponentMark = static_cast<const char*>(std::memchr(scientific, 'e', length));
+    int exponent = std::atoi(exponentMark + 1);
+    bool negative = scientific[0] == '-';
+    char digits[SHORTEST_FORMAT_BYTES];
+    int digitCount = 0;
+    for (const char* c = scientific + negative; c < exponentMark; c++) {
+        if (*c != '.') {
+            digits[digitCount++] = *c;
+        }
+    }
+
+    // Fixed notation length; used when not longer than scientific
+    int fixedLength = negative + (exponent >= digitCount - 1 ? exponent + 1
+                                  : exponent >= 0            ? digitCount + 1
+                                                             : digitCount + 1 - exponent);
+    if (fixedLength > length) {
+        std::memcpy(buffer, scientific, length);
+        return static_cast<size_t>(length);
+    }
+    if (exponent >= digitCount - 1) {
+        // Integral value: all its digits, exactly as libstdc++'s to_chars writes them
+        return static_cast<size_t>(std::snprintf(buffer, SHORTEST_FORMAT_BYTES, "%.0f", static_cast<double>(value)));
+    }
+    char* out = buffer;
+    if (negative) {
+        *out++ = '-';
+    }
+    if (exponent >= 0) {
+        std::memcpy(out, digits, exponent + 1);
+        out[exponent + 1] = '.';
+        std::memcpy(out + exponent + 2, digits + exponent + 1, digitCount - exponent - 1);
+    } else {
+        *out++ = '0';
+        *out++ = '.';
+        std::memset(out, '0', -exponent - 1);
+        std::memcpy(out - exponent - 1, digits, digitCount);
+    }
+    return static_cast<size_t>(fixedLength);
+}
+
+} // namespace graphbench
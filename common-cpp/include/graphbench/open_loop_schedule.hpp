@@ -0,0 +1,143 @@
+#pragma once
+
+#include <graphbench/cycle_clock.hpp>
+#include <graphbench/latency_histogram.hpp>
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace graphbench {
+
+using json = nlohmann::json;
+
+/**
+ * Open-loop issue schedule for one timed run.
+ *
+ * Each client thread issues its operations at a fixed rate (targetOpsPerSec
+ * split evenly over the clients) on a timeline that starts when the first client
+ * starts. A batch of k operations is due k / rate seconds after the previous one,
+ * whether or not that one has returned in time. Latency is measured from the
+ * batch's intended start, so time spent queued behind a stall (e.g. a compaction)
+ * is counted instead of silently lowering the issue rate (coordinated omission).
+ * The executor's own service time is kept in a separate histogram per client.
+ */
+class OpenLoopSchedule {
+public:
+    OpenLoopSchedule(double targetOpsPerSec, int clientThreads)
+        : targetOpsPerSec_(targetOpsPerSec),
+          ticksPerOp_(CycleClock::fromNs(1e9 * std::max(clientThreads, 1) / targetOpsPerSec)),
+          clients_(std::max(clientThreads, 1)) {}
+
+    double targetOpsPerSec() const { return targetOpsPerSec_; }
+
+    /**
+     * Issue count operations of one client in batches of batchSize on this schedule.
+     * Corrected per-operation latencies go to the active LatencyRecorder (amortized
+     * over the batch, like the executors' batch helpers).
+     *
+     * @param call Function (offset, count) executing operations [offset, offset + count)
+     *             of this client; returns the executor's per-batch latencies
+     * @return Per-batch latencies in microseconds, measured from intended start
+     */
+    template<typename Call>
+    std::vector<double> run(int thread, size_t count, int batchSize, Call call) {
+        ClientState& client = clients_[thread];
+        size_t step = static_cast<size_t>(std::max(batchSize, 1));
+        uint64_t start = origin();
+        std::vector<double> latencies;
+        latencies.reserve(count / step + 1);
+
+        for (size_t offset = 0; offset < count; offset += step) {
+            size_t batchCount = std::min(step, count - offset);
+            uint64_t intended = start + static_cast<uint64_t>(offset * static_cast<double>(ticksPerOp_));
+            waitUntil(intended);
+
+            uint64_t issued = CycleClock::now();
+            if (issued > intended) {
+                uint64_t lagNs = CycleClock::toNs(issued - intended);
+                client.maxLagNs = std::max(client.maxLagNs, lagNs);
+                if (lagNs > LATE_THRESHOLD_NS) {
+                    client.lateBatches++;
+                }
+            }
+            {
+                LatencyRecorder::Scope serviceScope(&client.service);
+                call(offset, batchCount);
+            }
+            uint64_t done = CycleClock::now();
+
+            LatencyRecorder::record(CycleClock::toNs(done - intended) / batchCount, batchCount);
+            latencies.push_back(CycleClock::toUs(done - intended) / batchCount);
+            client.batches++;
+        }
+        return latencies;
+    }
+
+    /**
+     * Service time, issue lag and late batch counts of all clients.
+     */
+    json summaryJson() const {
+        LatencyHistogram service;
+        uint64_t maxLagNs = 0;
+        uint64_t lateBatches = 0;
+        uint64_t batches = 0;
+        for (const ClientState& client : clients_) {
+            service.merge(client.service);
+            maxLagNs = std::max(maxLagNs, client.maxLagNs);
+            lateBatches += client.lateBatches;
+            batches += client.batches;
+        }
+        return {
+            {"target_ops_per_sec", targetOpsPerSec_},
+            {"service_latency", service.percentilesJson()},
+            {"max_issue_lag_us", maxLagNs / 1000.0},
+            {"late_batches", lateBatches},
+            {"batches", batches}
+        };
+    }
+
+private:
+    // A batch issued more than this after its intended start counts as late
+    static constexpr uint64_t LATE_THRESHOLD_NS = 100000;
+    // Sleep instead of spinning when the next batch is further away than this
+    static constexpr uint64_t SPIN_WINDOW_NS = 200000;
+
+    struct ClientState {
+        LatencyHistogram service;
+        uint64_t maxLagNs = 0;
+        uint64_t lateBatches = 0;
+        uint64_t batches = 0;
+    };
+
+    double targetOpsPerSec_;
+    uint64_t ticksPerOp_;
+    std::vector<ClientState> clients_;
+    std::atomic<uint64_t> origin_{0};
+
+    /** Common timeline start, set by the first client to begin */
+    uint64_t origin() {
+        uint64_t expected = 0;
+        uint64_t now = CycleClock::now();
+        origin_.compare_exchange_strong(expected, now);
+        return origin_.load();
+    }
+
+    static void waitUntil(uint64_t target) {
+        while (true) {
+            uint64_t now = CycleClock::now();
+            if (now >= target) {
+                return;
+            }
+            uint64_t remainingNs = CycleClock::toNs(target - now);
+            if (remainingNs > SPIN_WINDOW_NS) {
+                std::this_thread::sleep_for(std::chrono::nanoseconds(remainingNs - SPIN_WINDOW_NS / 2));
+            }
+        }
+    }
+};
+
+} // namespace graphbench
@@ -0,0 +1,356 @@
+#pragma once
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <future>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace graphbench {
+
+/**
+ * Read-only memory mapping of a whole file (RAII).
+ */
+class MappedFile {
+public:
+    explicit MappedFile(const std::string& path) : path_(path) {
+        fd_ = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd_ < 0) {
+            throw std::runtime_error("Failed to open " + path + ": " + std::strerror(errno));
+        }
+        struct stat st;
+        if (::fstat(fd_, &st) != 0) {
+            ::close(fd_);
+            throw std::runtime_error("Failed to stat " + path + ": " + std::strerror(errno));
+        }
+        size_ = static_cast<size_t>(st.st_size);
+        if (size_ > 0) {
+            void* mapped = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd_, 0);
+            if (mapped == MAP_FAILED) {
+                ::close(fd_);
+                throw std::runtime_error("Failed to mmap " + path + ": " + std::strerror(errno));
+            }
+            data_ = static_cast<const char*>(mapped);
+            ::madvise(mapped, size_, MADV_SEQUENTIAL);
+        }
+    }
+
+    ~MappedFile() {
+        if (data_) {
+            ::munmap(const_cast<char*>(data_), size_);
+        }
+        if (fd_ >= 0) {
+            ::close(fd_);
+        }
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const char* data() const { return data_; }
+    size_t size() const { return size_; }
+    const std::string& path() const { return path_; }
+
+private:
+    std::string path_;
+    int fd_ = -1;
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+/**
+ * A run of consecutive CSV rows, stored column-wise by kind.
+ * ids holds idColumns integers per row (node_id, or src and dst); properties holds
+ * propertyColumns raw field views per row, pointing into the mapped file. An empty
+ * view means the field is missing or empty. Views stay valid until read() returns.
+ */
+struct CsvBatch {
+    size_t rows = 0;
+    size_t idColumns = 0;
+    size_t propertyColumns = 0;
+    std::vector<int64_t> ids;
+    std::vector<std::string_view> properties;
+    std::string storage;  // Backing text for views that do not point into a file (see BinaryGraphCache)
+    const std::vector<std::string>* headers = nullptr;  // Column names of the file
+
+    const std::string& propertyName(size_t column) const {
+        return (*headers)[idColumns + column];
+    }
+
+    int64_t id(size_t row, size_t column = 0) const {
+        return ids[row * idColumns + column];
+    }
+
+    std::string_view property(size_t row, size_t column) const {
+        return properties[row * propertyColumns + column];
+    }
+
+    /**
+     * Property value as a string, with CSV quote escaping ("") undone.
+     */
+    std::string propertyString(size_t row, size_t column) const {
+        std::string_view raw = property(row, column);
+        std::string value;
+        value.reserve(raw.size());
+        for (size_t i = 0; i < raw.size(); i++) {
+            value.push_back(raw[i]);
+            if (raw[i] == '"' && i + 1 < raw.size() && raw[i + 1] == '"') {
+                i++;
+            }
+        }
+        return value;
+    }
+};
+
+/**
+ * Streaming, multi-threaded reader for the dataset CSV files (nodes.csv, edges.csv).
+ *
+ * The file is memory-mapped and split into newline-aligned chunks that are parsed
+ * on worker threads (integer IDs via std::from_chars, properties as views into the
+ * mapping). Parsed chunks are handed to the callback as CsvBatch objects strictly
+ * in file order, so loaders see the same row order as a serial read, while the
+ * next chunks are already being parsed. Quoted fields may contain commas but not
+ * line breaks, since chunks are split at newlines.
+ *
+ * The number of parser threads defaults to the hardware concurrency and can be
+ * set with the LOAD_THREADS environment variable.
+ */
+class ParallelCsvReader {
+public:
+    using BatchCallback = std::function<void(const CsvBatch& batch)>;
+
+    static constexpr size_t DEFAULT_CHUNK_BYTES = 8 * 1024 * 1024;
+
+    explicit ParallelCsvReader(int threads = defaultThreads(), size_t chunkBytes = DEFAULT_CHUNK_BYTES)
+        : threads_(std::max(threads, 1)), chunkBytes_(std::max<size_t>(chunkBytes, 4096)) {}
+
+    static int defaultThreads() {
+        const char* env = std::getenv("LOAD_THREADS");
+        if (env && std::atoi(env) > 0) {
+            return std::atoi(env);
+        }
+        return std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    /**
+     * Read a CSV file whose first idColumns columns are integer IDs.
+     * Returns the header column names.
+     *
+     * @param path CSV file with a header row
+     * @param idColumns Number of leading integer ID columns (1 for nodes, 2 for edges)
+     * @param withProperties Whether to collect the remaining columns as property views
+     * @param callback Receives consecutive batches in file order
+     */
+    std::vector<std::string> read(const std::string& path, size_t idColumns, bool withProperties,
+                                  const BatchCallback& callback) const {
+        MappedFile file(path);
+        const char* data = file.data();
+        const char* end = data + file.size();
+
+        const char* bodyStart = data;
+        std::vector<std::string> headers = parseHeader(data, end, &bodyStart);
+        if (headers.size() < idColumns) {
+            throw std::runtime_error("CSV header of " + path + " has fewer than " +
+                                     std::to_string(idColumns) + " columns");
+        }
+        size_t propertyColumns = withProperties ? headers.size() - idColumns : 0;
+
+        // Newline-aligned chunk boundaries
+        std::vector<std::pair<const char*, const char*>> chunks;
+        for (const char* chunkStart = bodyStart; chunkStart < end;) {
+            const char* chunkEnd = chunkStart + std::min(chunkBytes_, static_cast<size_t>(end - chunkStart));
+            if (chunkEnd < end) {
+                const void* newline = std::memchr(chunkEnd, '\n', end - chunkEnd);
+                chunkEnd = newline ? static_cast<const char*>(newline) + 1 : end;
+            }
+            chunks.emplace_back(chunkStart, chunkEnd);
+            chunkStart = chunkEnd;
+        }
+
+        // Keep one chunk per thread in flight and deliver them in order
+        size_t window = static_cast<size_t>(threads_);
+        std::deque<std::future<CsvBatch>> inFlight;
+        size_t nextChunk = 0;
+        while (nextChunk < chunks.size() || !inFlight.empty()) {
+            while (nextChunk < chunks.size() && inFlight.size() < window) {
+                const char* chunkStart = chunks[nextChunk].first;
+                const char* chunkEnd = chunks[nextChunk].second;
+                nextChunk++;
+                size_t offset = static_cast<size_t>(chunkStart - data);
+                inFlight.push_back(std::async(std::launch::async, [=, &path]() {
+                    return parseChunk(chunkStart, chunkEnd, idColumns, propertyColumns, path, offset);
+                }));
+            }
+            CsvBatch batch = inFlight.front().get();
+            inFlight.pop_front();
+            batch.headers = &headers;
+            if (batch.rows > 0) {
+                callback(batch);
+            }
+        }
+        return headers;
+    }
+
+    /**
+     * Read only the header row of a CSV file.
+     */
+    static std::vector<std::string> readHeader(const std::string& path) {
+        std::ifstream file(path, std::ios::binary);
+        if (!file.is_open()) {
+            throw std::runtime_error("Cannot open CSV file: " + path);
+        }
+        std::string line;
+        std::getline(file, line);
+        const char* bodyStart = nullptr;
+        return parseHeader(line.data(), line.data() + line.size(), &bodyStart);
+    }
+
+    /**
+     * Count data rows (lines after the header) with a memchr scan over the mapped file.
+     */
+    static size_t countDataRows(const std::string& path) {
+        MappedFile file(path);
+        const char* p = file.data();
+        const char* end = p + file.size();
+        size_t lines = 0;
+        while (p < end) {
+            const void* newline = std::memchr(p, '\n', end - p);
+            if (!newline) {
+                lines++;  // Last line without a trailing newline
+                break;
+            }
+            lines++;
+            p = static_cast<const char*>(newline) + 1;
+        }
+        return lines > 0 ? lines - 1 : 0;
+    }
+
+private:
+    int threads_;
+    size_t chunkBytes_;
+
+    static std::string_view trim(const char* begin, const char* end) {
+        while (begin < end && (*begin == ' ' || *begin == '\t')) begin++;
+        while (end > begin && (end[-1] == ' ' || end[-1] == '\t' || end[-1] == '\r')) end--;
+        return std::string_view(begin, end - begin);
+    }
+
+    /**
+     * Return the next field of the line and advance cursor past its delimiter.
+     * A quoted field is returned without the surrounding quotes.
+     * cursor > lineEnd means the line has no more fields (an empty view is returned).
+     */
+    static std::string_view nextField(const char*& cursor, const char* lineEnd) {
+        if (cursor > lineEnd) {
+            return {};
+        }
+        if (cursor < lineEnd && *cursor == '"') {
+            const char* begin = cursor + 1;
+            const char* p = begin;
+            while (p < lineEnd) {
+                if (*p == '"') {
+                    if (p + 1 < lineEnd && p[1] == '"') {
+                        p += 2;
+                        continue;
+                    }
+                    break;
+                }
+                p++;
+            }
+            std::string_view field(begin, p - begin);
+            const void* comma = p < lineEnd ? std::memchr(p, ',', lineEnd - p) : nullptr;
+            cursor = comma ? static_cast<const char*>(comma) + 1 : lineEnd + 1;
+            return field;
+        }
+        const void* comma = std::memchr(cursor, ',', lineEnd - cursor);
+        const char* fieldEnd = comma ? static_cast<const char*>(comma) : lineEnd;
+        std::string_view field = trim(cursor, fieldEnd);
+        cursor = comma ? fieldEnd + 1 : lineEnd + 1;
+        return field;
+    }
+
+    static std::vector<std::string> parseHeader(const char* data, const char* end, const char** bodyStart) {
+        const void* newline = std::memchr(data, '\n', end - data);
+        const char* lineEnd = newline ? static_cast<const char*>(newline) : end;
+        *bodyStart = newline ? lineEnd + 1 : end;
+
+        const char* contentEnd = lineEnd;
+        if (contentEnd > data && contentEnd[-1] == '\r') {
+            contentEnd--;
+        }
+        // Skip a UTF-8 byte order mark
+        const char* cursor = data;
+        if (contentEnd - cursor >= 3 && std::memcmp(cursor, "\xEF\xBB\xBF", 3) == 0) {
+            cursor += 3;
+        }
+
+        std::vector<std::string> headers;
+        while (cursor <= contentEnd && contentEnd > data) {
+            headers.emplace_back(nextField(cursor, contentEnd));
+        }
+        return headers;
+    }
+
+    static CsvBatch parseChunk(const char* begin, const char* end, size_t idColumns, size_t propertyColumns,
+                               const std::string& path, size_t baseOffset) {
+        CsvBatch batch;
+        batch.idColumns = idColumns;
+        batch.propertyColumns = propertyColumns;
+
+        // Rough row estimate for a single reservation (edge rows are ~12-20 bytes)
+        size_t estimate = static_cast<size_t>(end - begin) / 12 + 1;
+        batch.ids.reserve(estimate * idColumns);
+        if (propertyColumns > 0) {
+            batch.properties.reserve(estimate * propertyColumns);
+        }
+
+        const char* p = begin;
+        while (p < end) {
+            const void* newline = std::memchr(p, '\n', end - p);
+            const char* lineEnd = newline ? static_cast<const char*>(newline) : end;
+            const char* contentEnd = lineEnd;
+            if (contentEnd > p && contentEnd[-1] == '\r') {
+                contentEnd--;
+            }
+
+            if (contentEnd > p) {
+                const char* cursor = p;
+                for (size_t column = 0; column < idColumns; column++) {
+                    std::string_view field = nextField(cursor, contentEnd);
+                    if (!field.empty() && field.front() == '+') {
+                        field.remove_prefix(1);
+                    }
+                    int64_t value = 0;
+                    auto [ptr, ec] = std::from_chars(field.data(), field.data() + field.size(), value);
+                    if (field.empty() || ec != std::errc() || ptr != field.data() + field.size()) {
+                        throw std::runtime_error("Invalid integer ID '" + std::string(field) + "' in " + path +
+                                                 " at byte " + std::to_string(baseOffset + (p - begin)));
+                    }
+                    batch.ids.push_back(value);
+                }
+                for (size_t column = 0; column < propertyColumns; column++) {
+                    batch.properties.push_back(nextField(cursor, contentEnd));
+                }
+                batch.rows++;
+            }
+            p = lineEnd + 1;
+        }
+        return batch;
+    }
+};
+
+} // namespace graphbench
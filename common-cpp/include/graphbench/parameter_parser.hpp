@@ -2,6 +2,14 @@
 
 #include <nlohmann/json.hpp>
 #include <graphbench/workload_parameters.hpp>
+#include <graphbench/property_schema.hpp>
+#include <graphbench/type_converter.hpp>
+#include <graphbench/binary_parameters.hpp>
+#include <graphbench/vertex_sampler.hpp>
+#include <random>
+#include <array>
+#include <algorithm>
+#include <stdexcept>
 
 namespace graphbench {
 
@@ -14,8 +22,26 @@ using json = nlohmann::json;
 template<typename Executor>
 class ParameterParser {
 public:
+    using SystemId = typename Executor::SystemIdType;
+
     explicit ParameterParser(Executor* executor) : executor_(executor) {}
 
+    /**
+     * Binary sidecar of the workload file being parsed, or nullptr. "ids" and
+     * "pairs" given as {"$binary": ...} references are read from it.
+     */
+    void setParameterFile(const ParameterFile* file) {
+        parameterFile_ = file;
+    }
+
+    /**
+     * Sampler drawing the vertices of "ids" given as {"$sample": ...} specifications,
+     * or nullptr when the caller does not support them.
+     */
+    void setVertexSampler(VertexSampler* sampler) {
+        vertexSampler_ = sampler;
+    }
+
     /**
      * Parse parameters for ADD_VERTEX task.
      */
@@ -29,23 +55,10 @@ public:
      * Parse parameters for ADD_EDGE task.
      * Pre-converts origin IDs to system IDs and filters out non-existent vertices.
      */
-    AddEdgeParameters parseAddEdgeParameters(const json& parameters) {
-        AddEdgeParameters params;
+    AddEdgeParameters<SystemId> parseAddEdgeParameters(const json& parameters) {
+        AddEdgeParameters<SystemId> params;
         params.label = parameters.at("label").get<std::string>();
-        const auto& pairs = parameters.at("pairs");
-
-        for (const auto& pair : pairs) {
-            int64_t src = pair.at("src").get<int64_t>();
-            int64_t dst = pair.at("dst").get<int64_t>();
-            std::any srcSystemId = executor_->getSystemId(src);
-            std::any dstSystemId = executor_->getSystemId(dst);
-
-            // Only add if both vertices exist
-            if (srcSystemId.has_value() && dstSystemId.has_value()) {
-                params.pairs.push_back({srcSystemId, dstSystemId});
-            }
-        }
-        params.originalCount = pairs.size();
+        params.originalCount = convertPairs(parameters.at("pairs"), params.pairs);
         return params;
     }
 
@@ -53,17 +66,9 @@ public:
      * Parse parameters for REMOVE_VERTEX task.
      * Pre-converts origin IDs to system IDs and filters out non-existent vertices.
      */
-    RemoveVertexParameters parseRemoveVertexParameters(const json& parameters) {
-        RemoveVertexParameters params;
-        auto vertexIds = parameters.at("ids").get<std::vector<int64_t>>();
-
-        for (int64_t originId : vertexIds) {
-            std::any systemId = executor_->getSystemId(originId);
-            if (systemId.has_value()) {
-                params.systemIds.push_back(systemId);
-            }
-        }
-        params.originalCount = vertexIds.size();
+    RemoveVertexParameters<SystemId> parseRemoveVertexParameters(const json& parameters) {
+        RemoveVertexParameters<SystemId> params;
+        params.originalCount = convertIds(parameters.at("ids"), params.systemIds);
         return params;
     }
 
@@ -71,47 +76,305 @@ public:
      * Parse parameters for REMOVE_EDGE task.
      * Pre-converts origin IDs to system IDs and filters out non-existent edges.
      */
-    RemoveEdgeParameters parseRemoveEdgeParameters(const json& parameters) {
-        RemoveEdgeParameters params;
+    RemoveEdgeParameters<SystemId> parseRemoveEdgeParameters(const json& parameters) {
+        RemoveEdgeParameters<SystemId> params;
         params.label = parameters.at("label").get<std::string>();
-        const auto& pairs = parameters.at("pairs");
+        params.originalCount = convertPairs(parameters.at("pairs"), params.pairs);
+        return params;
+    }
 
-        for (const auto& pair : pairs) {
-            int64_t src = pair.at("src").get<int64_t>();
-            int64_t dst = pair.at("dst").get<int64_t>();
-            std::any srcSystemId = executor_->getSystemId(src);
-            std::any dstSystemId = executor_->getSystemId(dst);
+    /**
+     * Parse parameters for GET_NBRS task.
+     * Pre-converts origin IDs to system IDs and filters out non-existent vertices.
+     */
+    GetNbrsParameters<SystemId> parseGetNbrsParameters(const json& parameters) {
+        GetNbrsParameters<SystemId> params;
+        params.direction = parameters.at("direction").get<std::string>();
+        params.originalCount = convertIds(parameters.at("ids"), params.systemIds);
+        return params;
+    }
 
-            // Only add if both vertices exist
-            if (srcSystemId.has_value() && dstSystemId.has_value()) {
-                params.pairs.push_back({srcSystemId, dstSystemId});
+    /**
+     * Parse parameters for K_HOP (depth) and BFS (max_depth) tasks.
+     * Pre-converts start vertices to system IDs and filters out non-existent vertices.
+     */
+    TraversalParameters<SystemId> parseTraversalParameters(const json& parameters, const std::string& depthKey,
+                                                           int defaultDepth) {
+        TraversalParameters<SystemId> params;
+        params.direction = parameters.value("direction", std::string("OUT"));
+        params.depth = parameters.value(depthKey, defaultDepth);
+        if (params.depth < 0) {
+            throw std::runtime_error(depthKey + " must not be negative");
+        }
+        params.originalCount = convertIds(parameters.at("ids"), params.systemIds);
+        return params;
+    }
+
+    /**
+     * Parse parameters for SHORTEST_PATH task.
+     * Pre-converts origin IDs to system IDs and filters out pairs with a non-existent end.
+     */
+    ShortestPathParameters<SystemId> parseShortestPathParameters(const json& parameters) {
+        ShortestPathParameters<SystemId> params;
+        params.direction = parameters.value("direction", std::string("OUT"));
+        params.maxDepth = parameters.value("max_depth", 0);
+        if (params.maxDepth < 0) {
+            throw std::runtime_error("max_depth must not be negative");
+        }
+        params.originalCount = convertPairs(parameters.at("pairs"), params.pairs);
+        return params;
+    }
+
+    /**
+     * Parse parameters for MIXED task.
+     * Pre-converts the per-type operation pools and interleaves them into one
+     * operation stream. Each step draws the next operation type with probability
+     * proportional to the operations of that type still remaining, which keeps
+     * the mix at the configured ratios across the whole run. The stream is
+     * reproducible for a given seed.
+     */
+    MixedParameters<SystemId> parseMixedParameters(const json& parameters) {
+        MixedParameters<SystemId> params;
+        params.label = parameters.value("label", std::string("MyEdge"));
+        params.direction = parameters.value("direction", std::string("OUT"));
+        uint64_t seed = parameters.value("seed", uint64_t(42));
+
+        int originalCount = 0;
+        if (parameters.contains("add_vertex")) {
+            params.addVertexCount = parameters.at("add_vertex").at("count").get<int>();
+            originalCount += params.addVertexCount;
+        }
+        if (parameters.contains("add_edge")) {
+            originalCount += convertPairs(parameters.at("add_edge").at("pairs"), params.addEdgePairs);
+        }
+        if (parameters.contains("remove_vertex")) {
+            originalCount += convertIds(parameters.at("remove_vertex").at("ids"), params.removeVertexIds);
+        }
+        if (parameters.contains("remove_edge")) {
+            originalCount += convertPairs(parameters.at("remove_edge").at("pairs"), params.removeEdgePairs);
+        }
+        if (parameters.contains("get_nbrs")) {
+            originalCount += convertIds(parameters.at("get_nbrs").at("ids"), params.getNbrsIds);
+        }
+        params.originalCount = originalCount;
+
+        std::array<uint32_t, MIXED_OP_TYPE_COUNT> remaining = {
+            static_cast<uint32_t>(std::max(params.addVertexCount, 0)),
+            static_cast<uint32_t>(params.addEdgePairs.size()),
+            static_cast<uint32_t>(params.removeVertexIds.size()),
+            static_cast<uint32_t>(params.removeEdgePairs.size()),
+            static_cast<uint32_t>(params.getNbrsIds.size())
+        };
+        std::array<uint32_t, MIXED_OP_TYPE_COUNT> nextIndex = {};
+        uint64_t total = 0;
+        for (uint32_t count : remaining) {
+            total += count;
+        }
+
+        std::mt19937_64 rng(seed);
+        params.ops.reserve(total);
+        while (total > 0) {
+            uint64_t pick = rng() % total;
+            size_t type = 0;
+            while (pick >= remaining[type]) {
+                pick -= remaining[type];
+                type++;
             }
+            params.ops.push_back({static_cast<MixedOpType>(type), nextIndex[type]++});
+            remaining[type]--;
+            total--;
         }
-        params.originalCount = pairs.size();
         return params;
     }
 
     /**
-     * Parse parameters for GET_NBRS task.
-     * Pre-converts origin IDs to system IDs and filters out non-existent vertices.
+     * Parse parameters for UPDATE_VERTEX_PROPERTY task.
+     * Pre-converts origin IDs to system IDs, filters out non-existent vertices and
+     * types each value by its column. All properties of one entry stay in one update.
      */
-    GetNbrsParameters parseGetNbrsParameters(const json& parameters) {
-        GetNbrsParameters params;
-        params.direction = parameters.at("direction").get<std::string>();
-        auto vertexIds = parameters.at("ids").get<std::vector<int64_t>>();
+    UpdateVertexPropertyParameters<SystemId> parseUpdateVertexPropertyParameters(const json& parameters,
+                                                                                 const PropertySchema& schema) {
+        UpdateVertexPropertyParameters<SystemId> params;
+        const auto& updates = parameters.at("updates");
 
-        for (int64_t originId : vertexIds) {
-            std::any systemId = executor_->getSystemId(originId);
-            if (systemId.has_value()) {
-                params.systemIds.push_back(systemId);
+        for (const auto& update : updates) {
+            auto systemId = executor_->getSystemId(update.at("id").get<int64_t>());
+            if (!systemId.has_value()) {
+                continue;
+            }
+            VertexUpdate<SystemId> vertexUpdate{*systemId, {}};
+            for (const auto& [key, value] : update.at("properties").items()) {
+                vertexUpdate.properties[key] = typedValue(value, schema.vertexPropertyType(key));
+            }
+            params.updates.push_back(std::move(vertexUpdate));
+        }
+        params.originalCount = updates.size();
+        return params;
+    }
+
+    /**
+     * Parse parameters for UPDATE_EDGE_PROPERTY task.
+     * Pre-converts origin IDs to system IDs, filters out non-existent vertices and
+     * types each value by its column.
+     */
+    UpdateEdgePropertyParameters<SystemId> parseUpdateEdgePropertyParameters(const json& parameters,
+                                                                             const PropertySchema& schema) {
+        UpdateEdgePropertyParameters<SystemId> params;
+        params.label = parameters.value("label", std::string("MyEdge"));
+        const auto& updates = parameters.at("updates");
+
+        for (const auto& update : updates) {
+            auto srcSystemId = executor_->getSystemId(update.at("src").get<int64_t>());
+            auto dstSystemId = executor_->getSystemId(update.at("dst").get<int64_t>());
+            if (!srcSystemId.has_value() || !dstSystemId.has_value()) {
+                continue;
+            }
+            EdgeUpdate<SystemId> edgeUpdate{*srcSystemId, *dstSystemId, {}};
+            for (const auto& [key, value] : update.at("properties").items()) {
+                edgeUpdate.properties[key] = typedValue(value, schema.edgePropertyType(key));
             }
+            params.updates.push_back(std::move(edgeUpdate));
+        }
+        params.originalCount = updates.size();
+        return params;
+    }
+
+    /**
+     * Parse parameters for GET_VERTEX_BY_PROPERTY task.
+     * Query values are typed like the stored column so equality filters match.
+     */
+    GetVertexByPropertyParameters parseGetVertexByPropertyParameters(const json& parameters,
+                                                                     const PropertySchema& schema) {
+        GetVertexByPropertyParameters params;
+        const auto& queries = parameters.at("queries");
+        for (const auto& query : queries) {
+            std::string key = query.at("key").get<std::string>();
+            PropertyType type = schema.vertexPropertyType(key);
+            params.queries.push_back({key, typedValue(query.at("value"), type)});
+        }
+        params.originalCount = queries.size();
+        return params;
+    }
+
+    /**
+     * Parse parameters for GET_EDGE_BY_PROPERTY task.
+     * Query values are typed like the stored column so equality filters match.
+     */
+    GetEdgeByPropertyParameters parseGetEdgeByPropertyParameters(const json& parameters,
+                                                                 const PropertySchema& schema) {
+        GetEdgeByPropertyParameters params;
+        const auto& queries = parameters.at("queries");
+        for (const auto& query : queries) {
+            std::string key = query.at("key").get<std::string>();
+            PropertyType type = schema.edgePropertyType(key);
+            params.queries.push_back({key, typedValue(query.at("value"), type)});
         }
-        params.originalCount = vertexIds.size();
+        params.originalCount = queries.size();
         return params;
     }
 
 private:
     Executor* executor_;
+    const ParameterFile* parameterFile_ = nullptr;
+    VertexSampler* vertexSampler_ = nullptr;
+
+    /**
+     * Convert a JSON parameter value to the C++ type of its property column.
+     * Workload files carry CSV text for most values; unparsable text stays a string.
+     */
+    static std::any typedValue(const json& value, PropertyType type) {
+        if (value.is_string()) {
+            return TypeConverter::convertFromString(value.get<std::string>(), type);
+        }
+        if (value.is_boolean()) {
+            return TypeConverter::convertQueryValue(value.get<bool>(), type);
+        }
+        if (value.is_number_integer()) {
+            return TypeConverter::convertQueryValue(value.get<int64_t>(), type);
+        }
+        if (value.is_number()) {
+            return TypeConverter::convertQueryValue(value.get<double>(), type);
+        }
+        return std::any();
+    }
+
+    /** Resolve a {"$binary": ...} reference of the given width in the current parameter file */
+    ParameterArray binaryArray(const json& reference, size_t width) const {
+        if (!parameterFile_) {
+            throw std::runtime_error("Binary parameter reference without a parameters_file");
+        }
+        return parameterFile_->array(reference, width);
+    }
+
+    /**
+     * Convert {src, dst} origin ID pairs (a JSON array or a binary reference) to system IDs,
+     * keeping only pairs whose vertices both exist.
+     * Returns the number of pairs in the input.
+     */
+    int convertPairs(const json& pairs, std::vector<std::pair<SystemId, SystemId>>& out) {
+        if (ParameterFile::isReference(pairs)) {
+            ParameterArray array = binaryArray(pairs, 2);
+            out.reserve(out.size() + array.count);
+            for (size_t i = 0; i < array.count; i++) {
+                auto srcSystemId = executor_->getSystemId(array.at(i, 0));
+                auto dstSystemId = executor_->getSystemId(array.at(i, 1));
+                if (srcSystemId.has_value() && dstSystemId.has_value()) {
+                    out.push_back({*srcSystemId, *dstSystemId});
+                }
+            }
+            return static_cast<int>(array.count);
+        }
+        out.reserve(out.size() + pairs.size());
+        for (const auto& pair : pairs) {
+            auto srcSystemId = executor_->getSystemId(pair.at("src").get<int64_t>());
+            auto dstSystemId = executor_->getSystemId(pair.at("dst").get<int64_t>());
+            if (srcSystemId.has_value() && dstSystemId.has_value()) {
+                out.push_back({*srcSystemId, *dstSystemId});
+            }
+        }
+        return pairs.size();
+    }
+
+    /**
+     * Convert origin IDs (a JSON array, a binary reference or a sampler specification) to
+     * system IDs, keeping only existing vertices.
+     * Returns the number of IDs in the input.
+     */
+    int convertIds(const json& ids, std::vector<SystemId>& out) {
+        if (VertexSampler::isSpec(ids)) {
+            if (!vertexSampler_) {
+                throw std::runtime_error("Sampled ids without a vertex sampler");
+            }
+            std::vector<int64_t> originIds = vertexSampler_->sample(ids);
+            out.reserve(out.size() + originIds.size());
+            for (int64_t id : originIds) {
+                auto systemId = executor_->getSystemId(id);
+                if (systemId.has_value()) {
+                    out.push_back(*systemId);
+                }
+            }
+            return static_cast<int>(originIds.size());
+        }
+        if (ParameterFile::isReference(ids)) {
+            ParameterArray array = binaryArray(ids, 1);
+            out.reserve(out.size() + array.count);
+            for (size_t i = 0; i < array.count; i++) {
+                auto systemId = executor_->getSystemId(array.at(i));
+                if (systemId.has_value()) {
+                    out.push_back(*systemId);
+                }
+            }
+            return static_cast<int>(array.count);
+        }
+        out.reserve(out.size() + ids.size());
+        for (const auto& id : ids) {
+            auto systemId = executor_->getSystemId(id.get<int64_t>());
+            if (systemId.has_value()) {
+                out.push_back(*systemId);
+            }
+        }
+        return ids.size();
+    }
 };
 
 } // namespace graphbench
\ No newline at end of file
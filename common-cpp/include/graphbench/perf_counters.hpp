@@ -0,0 +1,186 @@
+#pragma once
+
+#include <graphbench/benchmark_utils.hpp>
+#include <nlohmann/json.hpp>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace graphbench {
+
+using json = nlohmann::json;
+
+/** perf_event config of read misses in a hardware cache (PERF_TYPE_HW_CACHE) */
+constexpr uint64_t perfCacheReadMiss(uint64_t cache) {
+    return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+}
+
+/**
+ * Hardware and software performance counters around one measurement.
+ *
+ * Enabled with PERF_COUNTERS=on. start() opens one perf_event counter per event
+ * on the calling thread with inherit set, so client threads created afterwards
+ * (ConcurrentDriver) are counted too; their counts are folded in when they exit,
+ * which they do before stop(). Threads that already exist (RocksDB background
+ * work, HTTP handlers, the progress sender) are not counted. Hardware events only
+ * measure user space, which perf_event_paranoid = 2 permits; context switches
+ * happen in the kernel and need perf_event_paranoid <= 1.
+ *
+ * Inherited counters cannot be read as a group, so every event is its own
+ * counter. When the PMU has fewer slots than events the kernel multiplexes them;
+ * counts are then scaled by time enabled / time running and the result says so.
+ * Events the kernel or container refuses (EACCES, ENOENT, seccomp) are left out;
+ * if none can be opened the result only reports why.
+ */
+class PerfCounters {
+public:
+    static PerfCounters fromEnv() {
+        std::string value = BenchmarkUtils::getEnv("PERF_COUNTERS", "off");
+        return PerfCounters(value == "on" || value == "true" || value == "1");
+    }
+
+    explicit PerfCounters(bool enabled) : enabled_(enabled) {}
+
+    ~PerfCounters() { closeAll(); }
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    bool enabled() const { return enabled_; }
+
+    /** Open and enable the counters (no-op when disabled) */
+    void start() {
+        if (!enabled_) {
+            return;
+        }
+        closeAll();
+        error_.clear();
+        unavailable_.clear();
+        for (const Event& event : EVENTS) {
+            int fd = openCounter(event);
+            if (fd < 0) {
+                if (error_.empty()) {
+                    error_ = std::string(event.name) + ": " + std::strerror(errno);
+                }
+                unavailable_.push_back(event.name);
+                continue;
+            }
+            counters_.push_back({&event, fd});
+        }
+        if (counters_.empty() && !warned_) {
+            std::cerr << "Warning: perf counters unavailable (" << error_
+                      << "); check kernel.perf_event_paranoid and the container's seccomp profile" << std::endl;
+            warned_ = true;
+        }
+        for (const Counter& counter : counters_) {
+            ::ioctl(counter.fd, PERF_EVENT_IOC_RESET, 0);
+            ::ioctl(counter.fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+
+    /**
+     * Disable the counters and summarize them, normalized by the number of operations.
+     * @return {"available", "<event>_per_op"..., "ipc", "totals", "multiplexed", "unavailable", "error"},
+     *         or null when disabled
+     */
+    json stop(size_t ops) {
+        if (!enabled_) {
+            return nullptr;
+        }
+        for (const Counter& counter : counters_) {
+            ::ioctl(counter.fd, PERF_EVENT_IOC_DISABLE, 0);
+        }
+
+        json summary = {{"available", !counters_.empty()}};
+        if (!unavailable_.empty()) {
+            summary["unavailable"] = unavailable_;
+            summary["error"] = error_;
+        }
+        json totals = json::object();
+        bool multiplexed = false;
+        for (const Counter& counter : counters_) {
+            // PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING layout
+            uint64_t values[3] = {0, 0, 0};
+            if (::read(counter.fd, values, sizeof(values)) != static_cast<ssize_t>(sizeof(values))) {
+                continue;
+            }
+            double count = static_cast<double>(values[0]);
+            if (values[2] > 0 && values[2] < values[1]) {
+                count *= static_cast<double>(values[1]) / static_cast<double>(values[2]);
+                multiplexed = true;
+            } else if (values[2] == 0 && values[1] > 0) {
+                // Never scheduled on the PMU: no estimate
+                continue;
+            }
+            totals[counter.event->name] = count;
+            if (ops > 0) {
+                summary[std::string(counter.event->name) + "_per_op"] = count / ops;
+            }
+        }
+        if (totals.contains("cycles") && totals.contains("instructions") && totals["cycles"].get<double>() > 0) {
+            summary["ipc"] = totals["instructions"].get<double>() / totals["cycles"].get<double>();
+        }
+        summary["totals"] = totals;
+        summary["multiplexed"] = multiplexed;
+        closeAll();
+        return summary;
+    }
+
+private:
+    struct Event {
+        const char* name;
+        uint32_t type;
+        uint64_t config;
+    };
+
+    struct Counter {
+        const Event* event;
+        int fd;
+    };
+
+    static constexpr Event EVENTS[] = {
+        {"cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+        {"instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+        {"llc_misses", PERF_TYPE_HW_CACHE, perfCacheReadMiss(PERF_COUNT_HW_CACHE_LL)},
+        {"branch_misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+        {"dtlb_misses", PERF_TYPE_HW_CACHE, perfCacheReadMiss(PERF_COUNT_HW_CACHE_DTLB)},
+        {"context_switches", PERF_TYPE_SOFTWARE, PERF_COUNT_SW_CONTEXT_SWITCHES},
+    };
+
+    bool enabled_;
+    std::vector<Counter> counters_;
+    std::vector<std::string> unavailable_;  // Events that could not be opened
+    std::string error_;                     // Why the first of them failed
+    bool warned_ = false;
+
+    static int openCounter(const Event& event) {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = event.type;
+        attr.config = event.config;
+        attr.disabled = 1;
+        attr.inherit = 1;
+        attr.exclude_kernel = event.type == PERF_TYPE_SOFTWARE ? 0 : 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        // This thread and its future children, on any CPU
+        return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, PERF_FLAG_FD_CLOEXEC));
+    }
+
+    void closeAll() {
+        for (const Counter& counter : counters_) {
+            ::close(counter.fd);
+        }
+        counters_.clear();
+    }
+};
+
+} // namespace graphbench
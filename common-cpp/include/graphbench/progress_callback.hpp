@@ -1,7 +1,16 @@
 #pragma once
 
+#include <graphbench/mpsc_queue.hpp>
 #include <string>
 #include <optional>
+#include <memory>
+#include <map>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <vector>
 #include <nlohmann/json.hpp>
 #include <curl/curl.h>
 
@@ -62,21 +71,224 @@ struct ProgressEvent {
     }
 };
 
+/**
+ * Background sender for the progress events of one callback URL, shared by all
+ * ProgressCallback instances that post there so their events stay in order.
+ *
+ * Producers serialize an event, push it on a lock-free MPSC queue and return; the
+ * benchmark thread never waits on the host. One sender thread drains the queue and
+ * coalesces whatever is pending into a single POST (a JSON array when more than one
+ * event is queued) over a reused keep-alive handle. At most QUEUE_CAPACITY events
+ * wait at a time; further events are dropped and counted instead of blocking.
+ */
+class ProgressSender {
+public:
+    static std::shared_ptr<ProgressSender> forUrl(const std::string& url) {
+        static std::mutex registryMutex;
+        static std::map<std::string, std::weak_ptr<ProgressSender>> registry;
+        std::lock_guard<std::mutex> lock(registryMutex);
+        std::shared_ptr<ProgressSender> sender = registry[url].lock();
+        if (!sender) {
+            sender.reset(new ProgressSender(url));
+            registry[url] = sender;
+        }
+        return sender;
+    }
+
+    ~ProgressSender() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        wakeup_.notify_one();
+        thread_.join();
+        curl_slist_free_all(headers_);
+        curl_easy_cleanup(curl_);
+        curl_global_cleanup();
+    }
+
+    ProgressSender(const ProgressSender&) = delete;
+    ProgressSender& operator=(const ProgressSender&) = delete;
+
+    /** Queue a serialized event; drops it when QUEUE_CAPACITY events are already waiting */
+    void enqueue(std::string payload) {
+        if (pending_.fetch_add(1, std::memory_order_acq_rel) >= QUEUE_CAPACITY) {
+            pending_.fetch_sub(1, std::memory_order_acq_rel);
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        queue_.push(std::move(payload));
+        wakeup_.notify_one();
+    }
+
+    /**
+     * Wait until every queued event has been posted (or failed), at most FLUSH_TIMEOUT_MS.
+     * @return false if events were still pending at the timeout
+     */
+    bool flush() {
+        wakeup_.notify_one();
+        std::unique_lock<std::mutex> lock(mutex_);
+        return drained_.wait_for(lock, std::chrono::milliseconds(FLUSH_TIMEOUT_MS), [this]() {
+            return pending_.load(std::memory_order_acquire) == 0;
+        });
+    }
+
+    json statsJson() const {
+        return {
+            {"sent_events", sent_.load()},
+            {"failed_events", failed_.load()},
+            {"dropped_events", dropped_.load()},
+            {"requests", requests_.load()}
+        };
+    }
+
+private:
+    static constexpr int QUEUE_CAPACITY = 4096;
+    static constexpr size_t MAX_BATCH_EVENTS = 256;
+    static constexpr int IDLE_WAIT_MS = 10;          // Bounds the delay of a wakeup that raced with the wait
+    static constexpr int FLUSH_TIMEOUT_MS = 10000;
+    static constexpr long REQUEST_TIMEOUT_MS = 5000;
+    static constexpr long CONNECT_TIMEOUT_MS = 1000;
+
+    std::string url_;
+    CURL* curl_ = nullptr;
+    struct curl_slist* headers_ = nullptr;
+    std::string body_;
+
+    MpscQueue<std::string> queue_;
+    std::atomic<int> pending_{0};  // Queued or in flight
+    std::atomic<uint64_t> sent_{0};
+    std::atomic<uint64_t> failed_{0};
+    std::atomic<uint64_t> dropped_{0};
+    std::atomic<uint64_t> requests_{0};
+
+    std::mutex mutex_;
+    std::condition_variable wakeup_;
+    std::condition_variable drained_;
+    bool stopping_ = false;
+    std::thread thread_;
+
+    explicit ProgressSender(const std::string& url) : url_(url) {
+        curl_global_init(CURL_GLOBAL_DEFAULT);
+        curl_ = curl_easy_init();
+        if (curl_) {
+            headers_ = curl_slist_append(headers_, "Content-Type: application/json");
+            curl_easy_setopt(curl_, CURLOPT_URL, url_.c_str());
+            curl_easy_setopt(curl_, CURLOPT_HTTPHEADER, headers_);
+            curl_easy_setopt(curl_, CURLOPT_WRITEFUNCTION, writeCallback);
+            curl_easy_setopt(curl_, CURLOPT_TCP_KEEPALIVE, 1L);
+            curl_easy_setopt(curl_, CURLOPT_TIMEOUT_MS, REQUEST_TIMEOUT_MS);
+            curl_easy_setopt(curl_, CURLOPT_CONNECTTIMEOUT_MS, CONNECT_TIMEOUT_MS);
+            curl_easy_setopt(curl_, CURLOPT_NOSIGNAL, 1L);
+        }
+        thread_ = std::thread([this]() { run(); });
+    }
+
+    static size_t writeCallback(void* contents, size_t size, size_t nmemb, void* userp) {
+        return size * nmemb;
+    }
+
+    void run() {
+        std::vector<std::string> batch;
+        batch.reserve(MAX_BATCH_EVENTS);
+        while (true) {
+            batch.clear();
+            while (batch.size() < MAX_BATCH_EVENTS) {
+                std::optional<std::string> payload = queue_.pop();
+                if (!payload) {
+                    break;
+                }
+                batch.push_back(std::move(*payload));
+            }
+
+            if (!batch.empty()) {
+                post(batch);
+                pending_.fetch_sub(static_cast<int>(batch.size()), std::memory_order_acq_rel);
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                }
+                drained_.notify_all();
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(mutex_);
+            if (stopping_ && pending_.load(std::memory_order_acquire) == 0) {
+                return;
+            }
+            wakeup_.wait_for(lock, std::chrono::milliseconds(IDLE_WAIT_MS));
+        }
+    }
+
+    void post(const std::vector<std::string>& batch) {
+        requests_++;
+        if (!curl_) {
+            failed_ += batch.size();
+            return;
+        }
+
+        body_.clear();
+        if (batch.size() == 1) {
+            body_ = batch[0];
+        } else {
+            body_.push_back('[');
+            for (size_t i = 0; i < batch.size(); i++) {
+                if (i > 0) {
+                    body_.push_back(',');
+                }
+                body_.append(batch[i]);
+            }
+            body_.push_back(']');
+        }
+        curl_easy_setopt(curl_, CURLOPT_POSTFIELDS, body_.c_str());
+        curl_easy_setopt(curl_, CURLOPT_POSTFIELDSIZE_LARGE, static_cast<curl_off_t>(body_.size()));
+
+        CURLcode res = curl_easy_perform(curl_);
+        long httpCode = 0;
+        curl_easy_getinfo(curl_, CURLINFO_RESPONSE_CODE, &httpCode);
+        if (res != CURLE_OK || httpCode >= 400) {
+            failed_ += batch.size();
+        } else {
+            sent_ += batch.size();
+        }
+    }
+};
+
 /**
  * Handles progress callbacks and logging to the host server.
- * Similar to Java's ProgressCallback class.
+ * Similar to Java's ProgressCallback class, except that events are sent
+ * asynchronously by the shared ProgressSender of the callback URL.
  */
 class ProgressCallback {
 public:
     explicit ProgressCallback(const std::string& callbackUrl)
         : callbackUrl_(callbackUrl) {
         curl_global_init(CURL_GLOBAL_DEFAULT);
+        if (!callbackUrl_.empty()) {
+            sender_ = ProgressSender::forUrl(callbackUrl_);
+        }
     }
 
     ~ProgressCallback() {
+        sender_.reset();
         curl_global_cleanup();
     }
 
+    /**
+     * Wait until the events sent so far have reached the host (bounded wait).
+     */
+    void flush() {
+        if (sender_) {
+            sender_->flush();
+        }
+    }
+
+    /**
+     * Delivery counters of the shared sender; empty when callbacks are disabled.
+     */
+    json statsJson() const {
+        return sender_ ? sender_->statsJson() : json::object();
+    }
+
     /**
      * Send progress callback to host using structured event object.
      */
@@ -153,29 +365,10 @@ public:
 
 private:
     std::string callbackUrl_;
+    std::shared_ptr<ProgressSender> sender_;
 
-    static size_t writeCallback(void* contents, size_t size, size_t nmemb, void* userp) {
-        return size * nmemb;
-    }
-
-    void sendHttpPost(const std::string& jsonPayload) {
-        CURL* curl = curl_easy_init();
-        if (!curl) {
-            return;
-        }
-
-        struct curl_slist* headers = nullptr;
-        headers = curl_slist_append(headers, "Content-Type: application/json");
-
-        curl_easy_setopt(curl, CURLOPT_URL, callbackUrl_.c_str());
-        curl_easy_setopt(curl, CURLOPT_POSTFIELDS, jsonPayload.c_str());
-        curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
-        curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, writeCallback);
-
-        CURLcode res = curl_easy_perform(curl);
-
-        curl_slist_free_all(headers);
-        curl_easy_cleanup(curl);
+    void sendHttpPost(std::string jsonPayload) {
+        sender_->enqueue(std::move(jsonPayload));
     }
 };
 
@@ -1,79 +1,80 @@
 #pragma once
 
 #include <graphbench/benchmark_executor.hpp>
+#include <graphbench/workload_parameters.hpp>
 #include <map>
 
 namespace graphbench {
 
 /**
- * Vertex update structure for property operations.
+ * Runtime interface to the property operations of an executor.
+ * Executors are registered and dispatched through their structural executor type;
+ * the dispatcher reaches the property operations of a property executor through
+ * this interface (one virtual call per batch).
  */
-struct VertexUpdate {
-    std::any systemId;
-    std::map<std::string, std::any> properties;
-};
-
-/**
- * Edge update structure for property operations.
- */
-struct EdgeUpdate {
-    std::any srcSystemId;
-    std::any dstSystemId;
-    std::map<std::string, std::any> properties;
-};
+template<typename SystemId>
+class PropertyOperations {
+public:
+    virtual std::vector<double> updateVertexProperty(BatchView<VertexUpdate<SystemId>> updates,
+                                                     int batchSize) = 0;
+    virtual std::vector<double> updateEdgeProperty(const std::string& label,
+                                                   BatchView<EdgeUpdate<SystemId>> updates,
+                                                   int batchSize) = 0;
+    virtual std::vector<double> getVertexByProperty(BatchView<PropertyQuery> queries,
+                                                    int batchSize) = 0;
+    virtual std::vector<double> getEdgeByProperty(BatchView<PropertyQuery> queries,
+                                                  int batchSize) = 0;
 
-/**
- * Property query structure.
- */
-struct PropertyQuery {
-    std::string key;
-    std::any value;
+protected:
+    virtual ~PropertyOperations() = default;
 };
 
 /**
  * CRTP base class for property benchmark executors.
  * Extends BenchmarkExecutor with property-related operations.
- * Uses static polymorphism for zero-overhead abstraction.
+ * Uses static polymorphism for zero-overhead abstraction; the PropertyOperations
+ * overrides forward to the Impl methods of the derived executor.
  */
-template<typename Derived>
-class PropertyBenchmarkExecutor : public BenchmarkExecutor<Derived> {
+template<typename Derived, typename SystemId>
+class PropertyBenchmarkExecutor : public BenchmarkExecutor<Derived, SystemId>,
+                                  public PropertyOperations<SystemId> {
 public:
-    std::vector<double> updateVertexProperty(const std::vector<VertexUpdate>& updates,
-                                             int batchSize) {
+    std::vector<double> updateVertexProperty(BatchView<VertexUpdate<SystemId>> updates,
+                                             int batchSize) override {
         return static_cast<Derived*>(this)->updateVertexPropertyImpl(updates, batchSize);
     }
 
     std::vector<double> updateEdgeProperty(const std::string& label,
-                                           const std::vector<EdgeUpdate>& updates,
-                                           int batchSize) {
+                                           BatchView<EdgeUpdate<SystemId>> updates,
+                                           int batchSize) override {
         return static_cast<Derived*>(this)->updateEdgePropertyImpl(label, updates, batchSize);
     }
 
-    std::vector<double> getVertexByProperty(const std::vector<PropertyQuery>& queries,
-                                            int batchSize) {
+    std::vector<double> getVertexByProperty(BatchView<PropertyQuery> queries,
+                                            int batchSize) override {
         return static_cast<Derived*>(this)->getVertexByPropertyImpl(queries, batchSize);
     }
 
-    std::vector<double> getEdgeByProperty(const std::vector<PropertyQuery>& queries,
-                                          int batchSize) {
+    std::vector<double> getEdgeByProperty(BatchView<PropertyQuery> queries,
+                                          int batchSize) override {
         return static_cast<Derived*>(this)->getEdgeByPropertyImpl(queries, batchSize);
     }
 
     // Default methods with batch size = 1
-    std::vector<double> updateVertexProperty(const std::vector<VertexUpdate>& updates) {
+    std::vector<double> updateVertexProperty(BatchView<VertexUpdate<SystemId>> updates) {
         return updateVertexProperty(updates, 1);
     }
 
     std::vector<double> updateEdgeProperty(const std::string& label,
-                                           const std::vector<EdgeUpdate>& updates) {
+                                           BatchView<EdgeUpdate<SystemId>> updates) {
         return updateEdgeProperty(label, updates, 1);
     }
 
-    std::vector<double> getVertexByProperty(const std::vector<PropertyQuery>& queries) {
+    std::vector<double> getVertexByProperty(BatchView<PropertyQuery> queries) {
         return getVertexByProperty(queries, 1);
     }
 
-    std::vector<double> getEdgeByProperty(const std::vector<PropertyQuery>& queries) {
+    std::vector<double> getEdgeByProperty(BatchView<PropertyQuery> queries) {
         return getEdgeByProperty(queries, 1);
     }
 
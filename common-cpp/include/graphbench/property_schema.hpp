@@ -0,0 +1,69 @@
+#pragma once
+
+#include <graphbench/parallel_csv_reader.hpp>
+#include <graphbench/property_type.hpp>
+#include <filesystem>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace graphbench {
+
+namespace fs = std::filesystem;
+
+/**
+ * Property columns of a dataset and their types.
+ * Column names come from the nodes.csv / edges.csv headers, types from type_meta.json
+ * (columns without an entry are STRING). Used to type workload parameters of
+ * property tasks the same way the loader typed the stored values.
+ */
+class PropertySchema {
+public:
+    PropertySchema() = default;
+
+    /**
+     * Read the schema of <datasetDir>; missing files yield an empty schema.
+     */
+    static PropertySchema read(const std::string& datasetDir) {
+        PropertySchema schema;
+        auto typeMaps = readPropertyTypeMeta(datasetDir);
+        schema.vertexProperties_ = readColumns(fs::path(datasetDir) / "nodes.csv", 1, typeMaps.first);
+        schema.edgeProperties_ = readColumns(fs::path(datasetDir) / "edges.csv", 2, typeMaps.second);
+        return schema;
+    }
+
+    bool hasVertexProperties() const { return !vertexProperties_.empty(); }
+    bool hasEdgeProperties() const { return !edgeProperties_.empty(); }
+
+    /** Type of a vertex property column, STRING for unknown columns */
+    PropertyType vertexPropertyType(const std::string& column) const {
+        auto it = vertexProperties_.find(column);
+        return it != vertexProperties_.end() ? it->second : PropertyType::STRING;
+    }
+
+    /** Type of an edge property column, STRING for unknown columns */
+    PropertyType edgePropertyType(const std::string& column) const {
+        auto it = edgeProperties_.find(column);
+        return it != edgeProperties_.end() ? it->second : PropertyType::STRING;
+    }
+
+private:
+    std::map<std::string, PropertyType> vertexProperties_;
+    std::map<std::string, PropertyType> edgeProperties_;
+
+    static std::map<std::string, PropertyType> readColumns(const fs::path& csvPath, size_t idColumns,
+                                                           const std::map<std::string, PropertyType>& types) {
+        std::map<std::string, PropertyType> columns;
+        if (!fs::exists(csvPath)) {
+            return columns;
+        }
+        std::vector<std::string> headers = ParallelCsvReader::readHeader(csvPath.string());
+        for (size_t i = idColumns; i < headers.size(); i++) {
+            auto it = types.find(headers[i]);
+            columns[headers[i]] = it != types.end() ? it->second : PropertyType::STRING;
+        }
+        return columns;
+    }
+};
+
+} // namespace graphbench
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+#include <utility>
+
+namespace graphbench {
+
+using json = nlohmann::json;
+namespace fs = std::filesystem;
+
+/**
+ * Type enumeration for property types.
+ */
+enum class PropertyType {
+    STRING,
+    INTEGER,
+    LONG,
+    FLOAT,
+    DOUBLE,
+    BOOLEAN
+};
+
+/**
+ * Convert type string from type_meta.json to PropertyType enum.
+ */
+inline PropertyType propertyTypeFromString(const std::string& typeStr) {
+    std::string lower = typeStr;
+    std::transform(lower.begin(), lower.end(), lower.begin(), ::tolower);
+
+    if (lower == "integer") return PropertyType::INTEGER;
+    if (lower == "long") return PropertyType::LONG;
+    if (lower == "float") return PropertyType::FLOAT;
+    if (lower == "double") return PropertyType::DOUBLE;
+    if (lower == "boolean") return PropertyType::BOOLEAN;
+    return PropertyType::STRING;
+}
+
+/**
+ * Read property type metadata from <datasetDir>/type_meta.json.
+ * Returns pair of [nodePropertyTypes, edgePropertyTypes]; both are empty if the file is missing.
+ */
+inline std::pair<std::map<std::string, PropertyType>, std::map<std::string, PropertyType>>
+readPropertyTypeMeta(const std::string& datasetDir) {
+    std::map<std::string, PropertyType> nodePropertyTypes;
+    std::map<std::string, PropertyType> edgePropertyTypes;
+
+    fs::path typeMetaPath = fs::path(datasetDir) / "type_meta.json";
+    if (!fs::exists(typeMetaPath)) {
+        return {nodePropertyTypes, edgePropertyTypes};
+    }
+
+    try {
+        std::ifstream file(typeMetaPath);
+        json meta;
+        file >> meta;
+
+        if (meta.contains("node_properties")) {
+            for (auto& [key, value] : meta["node_properties"].items()) {
+                nodePropertyTypes[key] = propertyTypeFromString(value.get<std::string>());
+            }
+        }
+
+        if (meta.contains("edge_properties")) {
+            for (auto& [key, value] : meta["edge_properties"].items()) {
+                edgePropertyTypes[key] = propertyTypeFromString(value.get<std::string>());
+            }
+        }
+    } catch (const std::exception& e) {
+        // Silently fall back to String for all properties if type_meta.json is invalid
+        std::cerr << "Warning: Failed to read type_meta.json: " << e.what() << std::endl;
+    }
+
+    return {nodePropertyTypes, edgePropertyTypes};
+}
+
+} // namespace graphbench
@@ -0,0 +1,198 @@
+#pragma once
+
+#include <graphbench/benchmark_utils.hpp>
+#include <fcntl.h>
+#include <linux/fs.h>
+#include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+namespace graphbench {
+
+namespace fs = std::filesystem;
+
+/**
+ * How a database directory is materialized from a snapshot (and vice versa).
+ */
+enum class RestoreMode {
+    AUTO,        // Reflink where the filesystem supports it, otherwise hardlink immutable files
+    COPY,        // Full byte copy of every file (the original behavior)
+    REFLINK,     // FICLONE copy-on-write clones (XFS, btrfs), copying files that cannot be cloned
+    HARDLINK,    // Hardlink immutable files (RocksDB SST/blob), copy everything else
+    CHECKPOINT   // RocksDB checkpoint layout; see RestoreStrategy::replicate
+};
+
+/**
+ * Outcome of one snapshot or restore run.
+ */
+struct RestoreStats {
+    std::string strategy;     // Strategy actually used, after fallbacks
+    double seconds = 0.0;
+    uint64_t filesCloned = 0;
+    uint64_t filesLinked = 0;
+    uint64_t filesCopied = 0;
+    uint64_t bytesCopied = 0;  // Bytes physically written (clones and links excluded)
+    uint64_t itemsReverted = 0;  // Undo-log restores: documents removed or put back
+};
+
+/**
+ * Restore strategy layer used by BenchmarkExecutor::snapGraph/restoreGraph.
+ *
+ * The strategy is selected with the RESTORE_STRATEGY environment variable
+ * (auto, copy, reflink, hardlink, checkpoint; default auto). Every strategy falls
+ * back to a plain copy per file when the faster path is not available, e.g. a
+ * filesystem without reflink support or a snapshot on another device.
+ *
+ * Hardlinking is only safe for files the engine never modifies in place. For
+ * RocksDB that is SST and blob files: they are written once, and compaction
+ * deletes them by unlinking, which leaves the snapshot's link intact. MANIFEST,
+ * CURRENT, OPTIONS, LOG and WAL files are always copied.
+ */
+class RestoreStrategy {
+public:
+    static RestoreMode modeFromEnv() {
+        return parseMode(BenchmarkUtils::getEnv("RESTORE_STRATEGY", "auto"));
+    }
+
+    static RestoreMode parseMode(std::string name) {
+        std::transform(name.begin(), name.end(), name.begin(),
+                       [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        if (name.empty() || name == "auto") return RestoreMode::AUTO;
+        if (name == "copy") return RestoreMode::COPY;
+        if (name == "reflink") return RestoreMode::REFLINK;
+        if (name == "hardlink") return RestoreMode::HARDLINK;
+        if (name == "checkpoint") return RestoreMode::CHECKPOINT;
+        throw std::runtime_error("Unknown RESTORE_STRATEGY: " + name +
+                                 " (expected auto, copy, reflink, hardlink or checkpoint)");
+    }
+
+    static const char* modeName(RestoreMode mode) {
+        switch (mode) {
+            case RestoreMode::AUTO: return "auto";
+            case RestoreMode::COPY: return "copy";
+            case RestoreMode::REFLINK: return "reflink";
+            case RestoreMode::HARDLINK: return "hardlink";
+            case RestoreMode::CHECKPOINT: return "checkpoint";
+        }
+        return "unknown";
+    }
+
+    /**
+     * Files that are never modified after creation and may be shared via hardlinks.
+     */
+    static bool isImmutableFile(const fs::path& path) {
+        std::string ext = path.extension().string();
+        return ext == ".sst" || ext == ".blob";
+    }
+
+    /**
+     * Replace destination with a replica of source.
+     *
+     * CHECKPOINT produces the same layout as rocksdb::Checkpoint (hardlinked SST
+     * files, copied MANIFEST/CURRENT/OPTIONS/WAL). It works on the closed database
+     * directory because snapshots are taken with the database closed and engines
+     * such as RocksGraph do not expose their rocksdb::DB handle.
+     */
+    static RestoreStats replicate(const fs::path& source, const fs::path& destination, RestoreMode mode) {
+        if (!fs::exists(source) || !fs::is_directory(source)) {
+            throw std::runtime_error("Source directory does not exist: " + source.string());
+        }
+
+        auto startTime = std::chrono::steady_clock::now();
+        RestoreStats stats;
+
+        BenchmarkUtils::deleteDirectory(destination);
+        fs::create_directories(destination);
+
+        bool tryReflink = mode == RestoreMode::AUTO || mode == RestoreMode::REFLINK;
+        bool tryHardlink = mode == RestoreMode::AUTO || mode == RestoreMode::HARDLINK
+                        || mode == RestoreMode::CHECKPOINT;
+
+        for (const auto& entry : fs::recursive_directory_iterator(source)) {
+            fs::path target = destination / fs::relative(entry.path(), source);
+            if (entry.is_directory()) {
+                fs::create_directories(target);
+                continue;
+            }
+            if (!entry.is_regular_file()) {
+                continue;
+            }
+
+            if (tryReflink) {
+                if (cloneFile(entry.path(), target)) {
+                    stats.filesCloned++;
+                    continue;
+                }
+                // The filesystem cannot clone; do not pay for a failed ioctl per file
+                tryReflink = false;
+            }
+            if (tryHardlink && isImmutableFile(entry.path())) {
+                std::error_code ec;
+                fs::create_hard_link(entry.path(), target, ec);
+                if (!ec) {
+                    stats.filesLinked++;
+                    continue;
+                }
+                // Cross-device or unsupported, copy from now on
+                tryHardlink = false;
+            }
+            fs::copy_file(entry.path(), target, fs::copy_options::overwrite_existing);
+            stats.filesCopied++;
+            stats.bytesCopied += entry.file_size();
+        }
+
+        stats.strategy = describe(mode, stats);
+        stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+        return stats;
+    }
+
+private:
+    /**
+     * Clone source into a new file at target with FICLONE.
+     * Returns false (leaving no file behind) if the filesystem does not support it.
+     */
+    static bool cloneFile(const fs::path& source, const fs::path& target) {
+        int srcFd = ::open(source.c_str(), O_RDONLY | O_CLOEXEC);
+        if (srcFd < 0) {
+            return false;
+        }
+        struct stat st;
+        if (::fstat(srcFd, &st) != 0) {
+            ::close(srcFd);
+            return false;
+        }
+        int dstFd = ::open(target.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, st.st_mode & 0777);
+        if (dstFd < 0) {
+            ::close(srcFd);
+            return false;
+        }
+        bool cloned = ::ioctl(dstFd, FICLONE, srcFd) == 0;
+        ::close(dstFd);
+        ::close(srcFd);
+        if (!cloned) {
+            ::unlink(target.c_str());
+        }
+        return cloned;
+    }
+
+    static std::string describe(RestoreMode mode, const RestoreStats& stats) {
+        if (stats.filesCloned > 0) {
+            return stats.filesCopied > 0 ? "reflink+copy" : "reflink";
+        }
+        if (stats.filesLinked > 0) {
+            return mode == RestoreMode::CHECKPOINT ? "checkpoint" : "hardlink";
+        }
+        return "copy";
+    }
+};
+
+} // namespace graphbench
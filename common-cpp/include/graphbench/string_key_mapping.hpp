@@ -0,0 +1,210 @@
+#pragma once
+
+#include <graphbench/benchmark_utils.hpp>
+#include <graphbench/progress_callback.hpp>
+#include <graphbench/node_id_mapping.hpp>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace graphbench {
+
+class StringKeyMapping;
+
+/**
+ * Text of one string key, valid until the end of the full expression that produced
+ * it (e.g. writer.element(*key)). Computed keys are formatted into the inline
+ * buffer; pooled keys view the mapping's arena.
+ */
+class KeyText {
+public:
+    static constexpr size_t MAX_COMPUTED_LENGTH = 32;
+
+    explicit KeyText(std::string_view pooled) : view_(pooled) {}
+
+    KeyText(std::string_view prefix, int64_t number) {
+        std::memcpy(buffer_, prefix.data(), prefix.size());
+        char* end = std::to_chars(buffer_ + prefix.size(), buffer_ + sizeof(buffer_), number).ptr;
+        view_ = std::string_view(buffer_, end - buffer_);
+    }
+
+    // The view may point into buffer_, so a copy would dangle
+    KeyText(const KeyText&) = delete;
+    KeyText& operator=(const KeyText&) = delete;
+
+    operator std::string_view() const { return view_; }
+    std::string str() const { return std::string(view_); }
+
+private:
+    char buffer_[MAX_COMPUTED_LENGTH];
+    std::string_view view_;
+};
+
+/**
+ * System ID of a node in a string-keyed backend: a handle to its key in a
+ * StringKeyMapping. Dereferencing yields the key text (*key converts to
+ * std::string_view). Handles order and compare by node, so they can be sorted
+ * and deduplicated like interned pointers.
+ */
+class StringKey {
+public:
+    StringKey() = default;
+    StringKey(const StringKeyMapping* mapping, int64_t node) : mapping_(mapping), node_(node) {}
+
+    inline KeyText operator*() const;
+
+    int64_t node() const { return node_; }
+
+    bool operator==(const StringKey& other) const { return node_ == other.node_; }
+    bool operator!=(const StringKey& other) const { return node_ != other.node_; }
+    bool operator<(const StringKey& other) const { return node_ < other.node_; }
+
+private:
+    const StringKeyMapping* mapping_ = nullptr;
+    int64_t node_ = -1;
+};
+
+/**
+ * Mapping from CSV node IDs to string keys, with the interface of NodeIdMapping
+ * but without one std::string per node. Strategies:
+ *
+ *   computed  the key is prefix + decimal node ID (e.g. "v42"); only a loaded
+ *             bit per node is stored, and keys are formatted on use
+ *   pooled    opaque keys are copied into one arena, addressed by 32-bit offsets
+ *             (4 bytes per node plus the key bytes; the arena is limited to 4 GiB)
+ *
+ * Both keep a LoadedMask, so lookups test a bit instead of comparing strings.
+ * The ID_MAPPING environment variable selects the strategy where a backend
+ * supports both (strategyFromEnv).
+ */
+class StringKeyMapping {
+public:
+    enum class Strategy { COMPUTED, POOLED };
+
+    StringKeyMapping(size_t node_count, Strategy strategy, std::string prefix = "",
+                     ProgressCallback* progress_callback = nullptr)
+        : strategy_(strategy), prefix_(std::move(prefix)), loaded_(node_count),
+          progress_callback_(progress_callback) {
+        if (strategy_ == Strategy::COMPUTED) {
+            // Prefix plus sign and 19 digits must fit the inline key buffer
+            if (prefix_.size() + 20 > KeyText::MAX_COMPUTED_LENGTH) {
+                throw std::runtime_error("Computed key prefix too long: " + prefix_);
+            }
+        } else {
+            offsets_.assign(node_count, 0);
+        }
+    }
+
+    /**
+     * Strategy from ID_MAPPING (computed, the default, or pooled).
+     */
+    static Strategy strategyFromEnv() {
+        std::string name = BenchmarkUtils::getEnv("ID_MAPPING", "computed");
+        if (name == "computed") {
+            return Strategy::COMPUTED;
+        }
+        if (name == "pooled") {
+            return Strategy::POOLED;
+        }
+        throw std::runtime_error("Unknown ID_MAPPING: " + name + " (expected computed or pooled)");
+    }
+
+    // Handles point at the mapping, so it must not be copied or moved once used
+    StringKeyMapping(const StringKeyMapping&) = delete;
+    StringKeyMapping& operator=(const StringKeyMapping&) = delete;
+
+    Strategy strategy() const { return strategy_; }
+
+    /**
+     * Record the key of a node. With the computed strategy key must be
+     * prefix + node ID; it is not stored.
+     */
+    void set(int64_t node_id, std::string_view key) {
+        size_t index = static_cast<size_t>(node_id);
+        if (node_id < 0 || index >= loaded_.size()) {
+            std::string errorMsg = "Node ID " + std::to_string(node_id) +
+                                   " exceeds expected count " + std::to_string(loaded_.size());
+            if (progress_callback_) {
+                progress_callback_->sendErrorMessage(errorMsg, "DATA_ERROR");
+            }
+            throw std::runtime_error(errorMsg);
+        }
+        if (strategy_ == Strategy::POOLED) {
+            if (arena_.size() + key.size() + 1 > std::numeric_limits<uint32_t>::max()) {
+                throw std::runtime_error("Key pool exceeds 4 GiB");
+            }
+            offsets_[index] = static_cast<uint32_t>(arena_.size());
+            arena_.append(key);
+            arena_.push_back('\0');
+        }
+        loaded_.set(index);
+    }
+
+    /**
+     * Get the key handle of a node, with validation.
+     * @throws std::runtime_error if node ID is out of range or not yet loaded
+     */
+    StringKey get(int64_t node_id, const std::string& context) const {
+        if (!loaded_.test(node_id)) {
+            bool inRange = node_id >= 0 && static_cast<size_t>(node_id) < loaded_.size();
+            std::string errorMsg = "Invalid " + context + " node ID " + std::to_string(node_id) +
+                                   (inRange ? ": node not loaded yet"
+                                            : ": out of range (max=" + std::to_string(loaded_.size() - 1) + ")");
+            if (progress_callback_) {
+                progress_callback_->sendErrorMessage(errorMsg, "DATA_ERROR");
+            }
+            throw std::runtime_error(errorMsg);
+        }
+        return StringKey(this, node_id);
+    }
+
+    /**
+     * Get the key handle without error reporting (for parameter parsing).
+     * Returns an empty handle if the node ID is invalid or not loaded.
+     */
+    StringKey get_or_default(int64_t node_id, bool* found = nullptr) const {
+        bool loaded = loaded_.test(node_id);
+        if (found) *found = loaded;
+        return loaded ? StringKey(this, node_id) : StringKey();
+    }
+
+    /** Key text of a loaded node */
+    KeyText keyText(int64_t node_id) const {
+        if (strategy_ == Strategy::COMPUTED) {
+            return KeyText(prefix_, node_id);
+        }
+        return KeyText(std::string_view(arena_.data() + offsets_[static_cast<size_t>(node_id)]));
+    }
+
+    size_t size() const {
+        return loaded_.size();
+    }
+
+    /** Bytes held for the keys (mask, offsets and arena) */
+    size_t memoryBytes() const {
+        return (loaded_.size() + 7) / 8 + offsets_.capacity() * sizeof(uint32_t) + arena_.capacity();
+    }
+
+    static size_t count_nodes_from_csv(const std::string& dataset_path) {
+        return SyntheticGraph::countNodes(dataset_path);
+    }
+
+private:
+    Strategy strategy_;
+    std::string prefix_;
+    LoadedMask loaded_;
+    std::vector<uint32_t> offsets_;  // Pooled: arena offset per node
+    std::string arena_;              // Pooled: NUL-terminated keys
+    ProgressCallback* progress_callback_;
+};
+
+inline KeyText StringKey::operator*() const {
+    return mapping_->keyText(node_);
+}
+
+} // namespace graphbench
@@ -0,0 +1,297 @@
+#pragma once
+
+#include <graphbench/parallel_csv_reader.hpp>
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace graphbench {
+
+using json = nlohmann::json;
+namespace fs = std::filesystem;
+
+/**
+ * Graph generated while it is loaded instead of read from CSV files, for scale
+ * sweeps over graphs too large to download and convert. A dataset directory that
+ * holds a synthetic.json (instead of nodes.csv and edges.csv) describes one:
+ *
+ *   {"generator": "rmat", "scale": 24, "edge_factor": 16, "seed": 1}
+ *
+ *   generator    rmat (default) or ba
+ *   scale        2^scale vertices with origin IDs 0 .. 2^scale - 1 (1 to 40)
+ *   edge_factor  edges per vertex (default 16), edge_factor * 2^scale edges in total
+ *   seed         generator seed (default 1)
+ *   a, b, c      rmat quadrant probabilities (default 0.57, 0.19, 0.19 as in Graph500),
+ *                the fourth quadrant gets the rest
+ *   scramble     rmat: permute the vertex IDs, so the hubs are not the lowest IDs (default true)
+ *
+ * rmat is the recursive matrix model (Chakrabarti, Zhan and Faloutsos, 2004), a
+ * stochastic Kronecker graph with a 2x2 initiator: each edge descends the scale
+ * levels of the adjacency matrix and picks one quadrant per level. ba is
+ * Barabási–Albert preferential attachment in the edge-list form of Batagelj and
+ * Brandes: edge i leaves vertex i / edge_factor, and its target is an endpoint of a
+ * uniformly chosen earlier edge, so vertices are picked in proportion to their
+ * degree. Targets are resolved by following those choices backwards, which lets any
+ * edge be generated independently (Sanders and Schulz, "Scalable generation of
+ * scale-free graphs", 2016).
+ *
+ * Every random choice is a hash of (seed, edge index, draw), so edge i is the same
+ * for any number of threads, and the workload compiler (host/dataset/synthetic_graph.py)
+ * reproduces the edges it samples. Edge batches are generated on LOAD_THREADS threads
+ * and delivered in edge order, like ParallelCsvReader batches. Both generators can
+ * produce duplicate edges and self-loops, which are loaded as they are, like
+ * duplicate rows of an edges.csv. The graphs have no properties.
+ */
+class SyntheticGraph {
+public:
+    using BatchCallback = ParallelCsvReader::BatchCallback;
+
+    static constexpr const char* SPEC_FILE = "synthetic.json";
+    static constexpr size_t BATCH_ROWS = 64 * 1024;
+    static constexpr int MAX_SCALE = 40;
+
+    explicit SyntheticGraph(const json& spec, int threads = ParallelCsvReader::defaultThreads())
+        : threads_(std::max(threads, 1)) {
+        std::string generator = spec.value("generator", std::string("rmat"));
+        if (generator == "rmat") {
+            generator_ = Generator::RMAT;
+        } else if (generator == "ba") {
+            generator_ = Generator::BA;
+        } else {
+            throw std::runtime_error("Unknown synthetic generator: " + generator + " (expected rmat or ba)");
+        }
+        scale_ = spec.at("scale").get<int>();
+        int64_t edgeFactor = spec.value("edge_factor", static_cast<int64_t>(16));
+        if (scale_ < 1 || scale_ > MAX_SCALE) {
+            throw std::runtime_error("Synthetic graph scale must be between 1 and " + std::to_string(MAX_SCALE));
+        }
+        if (edgeFactor < 1 || edgeFactor > (int64_t(1) << (62 - scale_))) {
+            throw std::runtime_error("Synthetic graph edge_factor must be at least 1 and at most 2^(62 - scale)");
+        }
+        edgeFactor_ = static_cast<uint64_t>(edgeFactor);
+        seed_ = spec.value("seed", uint64_t(1));
+        key_ = mix(seed_);
+
+        a_ = spec.value("a", 0.57);
+        double b = spec.value("b", 0.19);
+        double c = spec.value("c", 0.19);
+        if (a_ < 0 || b < 0 || c < 0 || a_ + b + c > 1) {
+            throw std::runtime_error("rmat needs a, b, c >= 0 and a + b + c <= 1");
+        }
+        ab_ = a_ + b;
+        abc_ = ab_ + c;
+        scramble_ = spec.value("scramble", true);
+        mask_ = (uint64_t(1) << scale_) - 1;
+        for (int round = 0; round < 2; round++) {
+            scrambleMultiplier_[round] = random(~uint64_t(0), 2 * round) | 1;
+            scrambleOffset_[round] = random(~uint64_t(0), 2 * round + 1);
+        }
+    }
+
+    /**
+     * Open the synthetic graph described by <datasetDir>/synthetic.json.
+     * @return nullptr when the directory holds a CSV dataset
+     */
+    static std::unique_ptr<SyntheticGraph> open(const std::string& datasetDir) {
+        fs::path specPath = fs::path(datasetDir) / SPEC_FILE;
+        if (!fs::exists(specPath)) {
+            return nullptr;
+        }
+        std::ifstream file(specPath);
+        json spec;
+        try {
+            file >> spec;
+        } catch (const json::exception& e) {
+            throw std::runtime_error("Invalid " + specPath.string() + ": " + e.what());
+        }
+        return std::make_unique<SyntheticGraph>(spec);
+    }
+
+    /**
+     * Number of nodes of a dataset directory: generated for a synthetic graph,
+     * otherwise the data rows of nodes.csv.
+     */
+    static size_t countNodes(const std::string& datasetDir) {
+        if (auto graph = open(datasetDir)) {
+            return graph->nodeCount();
+        }
+        return ParallelCsvReader::countDataRows((fs::path(datasetDir) / "nodes.csv").string());
+    }
+
+    size_t nodeCount() const { return static_cast<size_t>(uint64_t(1) << scale_); }
+    size_t edgeCount() const { return static_cast<size_t>(edgeFactor_ << scale_); }
+
+    /** e.g. "rmat scale 24, edge factor 16, seed 1" */
+    std::string describe() const {
+        return std::string(generator_ == Generator::RMAT ? "rmat" : "ba") + " scale " + std::to_string(scale_) +
+               ", edge factor " + std::to_string(edgeFactor_) + ", seed " + std::to_string(seed_);
+    }
+
+    /**
+     * Deliver the node IDs 0 .. nodeCount() - 1 as CsvBatch objects (one ID column)
+     * and return the headers of the equivalent nodes.csv. There are no property
+     * columns, whatever withProperties says.
+     */
+    std::vector<std::string> readNodes(bool /*withProperties*/, const BatchCallback& callback) const {
+        uint64_t rows = nodeCount();
+        for (uint64_t begin = 0; begin < rows; begin += BATCH_ROWS) {
+            CsvBatch batch;
+            batch.idColumns = 1;
+            batch.rows = static_cast<size_t>(std::min<uint64_t>(rows - begin, BATCH_ROWS));
+            batch.ids.resize(batch.rows);
+            for (size_t row = 0; row < batch.rows; row++) {
+                batch.ids[row] = static_cast<int64_t>(begin + row);
+            }
+            batch.headers = &nodeHeaders_;
+            callback(batch);
+        }
+        return nodeHeaders_;
+    }
+
+    /**
+     * Generate all edges as CsvBatch objects (src, dst) in edge index order and
+     * return the headers of the equivalent edges.csv.
+     */
+    std::vector<std::string> readEdges(bool /*withProperties*/, const BatchCallback& callback) const {
+        uint64_t rows = edgeCount();
+        uint64_t batches = (rows + BATCH_ROWS - 1) / BATCH_ROWS;
+
+        // Keep one batch per thread in flight and deliver them in order
+        size_t window = static_cast<size_t>(threads_);
+        std::deque<std::future<CsvBatch>> inFlight;
+        uint64_t nextBatch = 0;
+        while (nextBatch < batches || !inFlight.empty()) {
+            while (nextBatch < batches && inFlight.size() < window) {
+                uint64_t begin = nextBatch * BATCH_ROWS;
+                uint64_t end = std::min(rows, begin + BATCH_ROWS);
+                nextBatch++;
+                inFlight.push_back(std::async(std::launch::async, [this, begin, end]() {
+                    return edgeBatch(begin, end);
+                }));
+            }
+            CsvBatch batch = inFlight.front().get();
+            inFlight.pop_front();
+            batch.headers = &edgeHeaders_;
+            callback(batch);
+        }
+        return edgeHeaders_;
+    }
+
+    /** Endpoints of edge index (0 <= index < edgeCount()) */
+    std::pair<int64_t, int64_t> edge(uint64_t index) const {
+        if (generator_ == Generator::BA) {
+            return {static_cast<int64_t>(index / edgeFactor_), static_cast<int64_t>(attachmentTarget(index))};
+        }
+        uint64_t src = 0;
+        uint64_t dst = 0;
+        for (int level = 0; level < scale_; level++) {
+            double u = unit(random(index, static_cast<uint64_t>(level)));
+            src <<= 1;
+            dst <<= 1;
+            if (u < a_) {
+                // Top left quadrant
+            } else if (u < ab_) {
+                dst |= 1;
+            } else if (u < abc_) {
+                src |= 1;
+            } else {
+                src |= 1;
+                dst |= 1;
+            }
+        }
+        if (scramble_) {
+            src = scramble(src);
+            dst = scramble(dst);
+        }
+        return {static_cast<int64_t>(src), static_cast<int64_t>(dst)};
+    }
+
+private:
+    enum class Generator { RMAT, BA };
+
+    Generator generator_ = Generator::RMAT;
+    int scale_ = 0;
+    uint64_t edgeFactor_ = 16;
+    uint64_t seed_ = 1;
+    uint64_t key_ = 0;
+    double a_ = 0.57;
+    double ab_ = 0.76;     // a + b
+    double abc_ = 0.95;    // a + b + c
+    bool scramble_ = true;
+    uint64_t mask_ = 0;
+    uint64_t scrambleMultiplier_[2] = {1, 1};
+    uint64_t scrambleOffset_[2] = {0, 0};
+    int threads_;
+    const std::vector<std::string> nodeHeaders_{"node_id"};
+    const std::vector<std::string> edgeHeaders_{"src", "dst"};
+
+    /** splitmix64 finalizer (Steele, Lea and Flood, 2014) */
+    static uint64_t mix(uint64_t x) {
+        x += 0x9E3779B97F4A7C15ULL;
+        x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+        return x ^ (x >> 31);
+    }
+
+    /** Random 64 bits for the draw-th choice of edge index */
+    uint64_t random(uint64_t index, uint64_t draw) const {
+        return mix(mix(key_ + index) + draw);
+    }
+
+    /** Uniform double in [0, 1) from the top 53 bits */
+    static double unit(uint64_t bits) {
+        return static_cast<double>(bits >> 11) * 0x1.0p-53;
+    }
+
+    /**
+     * Bijection on [0, 2^scale): two rounds of an odd multiply-add and a xorshift,
+     * each invertible modulo 2^scale.
+     */
+    uint64_t scramble(uint64_t vertex) const {
+        int shift = (scale_ + 1) / 2;
+        for (int round = 0; round < 2; round++) {
+            vertex = (vertex * scrambleMultiplier_[round] + scrambleOffset_[round]) & mask_;
+            vertex ^= vertex >> shift;
+        }
+        return vertex;
+    }
+
+    /**
+     * Target of Barabási–Albert edge index. Position 2i of the Batagelj–Brandes
+     * endpoint list is the source of edge i and 2i + 1 its target; the target copies
+     * a uniform position in [0, 2i]. An even position is a source and known directly,
+     * an odd one is the target of an earlier edge and resolved the same way.
+     */
+    uint64_t attachmentTarget(uint64_t index) const {
+        while (true) {
+            uint64_t position = random(index, 0) % (2 * index + 1);
+            if (position % 2 == 0) {
+                return (position / 2) / edgeFactor_;
+            }
+            index = position / 2;
+        }
+    }
+
+    CsvBatch edgeBatch(uint64_t begin, uint64_t end) const {
+        CsvBatch batch;
+        batch.idColumns = 2;
+        batch.rows = static_cast<size_t>(end - begin);
+        batch.ids.resize(2 * batch.rows);
+        for (size_t row = 0; row < batch.rows; row++) {
+            auto [src, dst] = edge(begin + row);
+            batch.ids[2 * row] = src;
+            batch.ids[2 * row + 1] = dst;
+        }
+        return batch;
+    }
+};
+
+} // namespace graphbench
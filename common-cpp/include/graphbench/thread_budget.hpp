@@ -0,0 +1,81 @@
+#pragma once
+
+#include <graphbench/benchmark_utils.hpp>
+#include <graphbench/concurrent_driver.hpp>
+#include <nlohmann/json.hpp>
+#include <pthread.h>
+#include <sched.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace graphbench {
+
+using json = nlohmann::json;
+
+/**
+ * Split of threads and CPUs between the HTTP front end and benchmark execution.
+ *
+ *   HTTP_THREADS  handler threads of the HTTP server (default 4)
+ *   HTTP_CPUS     CPUs reserved for the HTTP handlers, taken from the end of the
+ *                 process's CPU set (default 1 when the set has at least 4 CPUs,
+ *                 0 = no split)
+ *
+ * Benchmark jobs run on the remaining CPUs. ConcurrentDriver pins its client
+ * threads within the CPU set of the thread that starts them, so pinning the job
+ * worker keeps all benchmark threads off the HTTP CPUs (and stream readers polling
+ * a long job off the benchmark cores).
+ */
+class ThreadBudget {
+public:
+    static ThreadBudget fromEnv() {
+        ThreadBudget budget;
+        budget.httpThreads_ = std::max(1, std::stoi(BenchmarkUtils::getEnv("HTTP_THREADS", "4")));
+
+        std::vector<int> cpus = ConcurrentDriver::allowedCpus();
+        int defaultReserved = cpus.size() >= 4 ? 1 : 0;
+        int reserved = std::stoi(BenchmarkUtils::getEnv("HTTP_CPUS", std::to_string(defaultReserved)));
+        // Leave at least one CPU for the benchmark
+        reserved = std::clamp(reserved, 0, std::max(0, static_cast<int>(cpus.size()) - 1));
+        if (reserved > 0) {
+            budget.benchmarkCpus_.assign(cpus.begin(), cpus.end() - reserved);
+            budget.httpCpus_.assign(cpus.end() - reserved, cpus.end());
+        }
+        return budget;
+    }
+
+    int httpThreads() const { return httpThreads_; }
+
+    /** Restrict the calling thread to the HTTP CPUs; threads it creates inherit them */
+    void pinToHttpCpus() const { pinCurrentThread(httpCpus_); }
+
+    /** Restrict the calling thread to the benchmark CPUs */
+    void pinToBenchmarkCpus() const { pinCurrentThread(benchmarkCpus_); }
+
+    json toJson() const {
+        return {
+            {"http_threads", httpThreads_},
+            {"http_cpus", httpCpus_},
+            {"benchmark_cpus", benchmarkCpus_}
+        };
+    }
+
+private:
+    int httpThreads_ = 4;
+    std::vector<int> httpCpus_;       // Empty = no split
+    std::vector<int> benchmarkCpus_;
+
+    static void pinCurrentThread(const std::vector<int>& cpus) {
+        if (cpus.empty()) {
+            return;
+        }
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for (int cpu : cpus) {
+            CPU_SET(cpu, &set);
+        }
+        pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    }
+};
+
+} // namespace graphbench
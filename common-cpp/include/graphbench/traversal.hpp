@@ -0,0 +1,164 @@
+#pragma once
+
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace graphbench {
+
+using json = nlohmann::json;
+
+/**
+ * Work done by the traversal queries (K_HOP, BFS, SHORTEST_PATH) of one run.
+ * Latency alone does not compare traversals across systems: a query that stops
+ * early or visits fewer vertices is cheaper, so the visited counts are reported
+ * next to it.
+ */
+struct TraversalStats {
+    uint64_t queries = 0;           // Queries with a reported visited count
+    uint64_t visitedVertices = 0;   // Distinct vertices reached, excluding the start vertex
+    uint64_t maxVisited = 0;        // Largest per-query count (when known per query)
+    uint64_t pathQueries = 0;       // SHORTEST_PATH queries
+    uint64_t pathsFound = 0;        // SHORTEST_PATH: pairs with a path within the depth bound
+    uint64_t pathLengthSum = 0;     // SHORTEST_PATH: summed hop counts of the found paths
+
+    void merge(const TraversalStats& other) {
+        queries += other.queries;
+        visitedVertices += other.visitedVertices;
+        maxVisited = std::max(maxVisited, other.maxVisited);
+        pathQueries += other.pathQueries;
+        pathsFound += other.pathsFound;
+        pathLengthSum += other.pathLengthSum;
+    }
+
+    json toJson() const {
+        json out = json::object();
+        if (queries > 0) {
+            out["queries"] = queries;
+            out["visited_vertices"] = visitedVertices;
+            out["avg_visited"] = static_cast<double>(visitedVertices) / queries;
+            out["max_visited"] = maxVisited;
+        }
+        if (pathQueries > 0) {
+            out["path_queries"] = pathQueries;
+            out["paths_found"] = pathsFound;
+            out["avg_path_length"] = pathsFound > 0 ? static_cast<double>(pathLengthSum) / pathsFound : 0.0;
+        }
+        return out;
+    }
+};
+
+/**
+ * Thread-local sink for traversal statistics, the counterpart of LatencyRecorder.
+ * The dispatcher installs one TraversalStats per client thread; executors report
+ * each query (or each batch, when the system only returns totals).
+ */
+class TraversalRecorder {
+public:
+    class Scope {
+    public:
+        explicit Scope(TraversalStats* stats) : previous_(active()) {
+            active() = stats;
+        }
+        ~Scope() {
+            active() = previous_;
+        }
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        TraversalStats* previous_;
+    };
+
+    /** One query that reached visited vertices */
+    static void recordQuery(uint64_t visited) {
+        if (TraversalStats* stats = active()) {
+            stats->queries++;
+            stats->visitedVertices += visited;
+            stats->maxVisited = std::max(stats->maxVisited, visited);
+        }
+    }
+
+    /** A batch of queries of which only the visited total is known */
+    static void recordBatch(uint64_t queries, uint64_t visited) {
+        if (TraversalStats* stats = active()) {
+            stats->queries += queries;
+            stats->visitedVertices += visited;
+        }
+    }
+
+    /**
+     * Outcome of one shortest-path query; hops is ignored when no path was found.
+     * Its visited count, when the system exposes one, is reported with recordQuery().
+     */
+    static void recordPath(bool found, uint64_t hops) {
+        if (TraversalStats* stats = active()) {
+            stats->pathQueries++;
+            if (found) {
+                stats->pathsFound++;
+                stats->pathLengthSum += hops;
+            }
+        }
+    }
+
+    /** Outcomes of a batch of shortest-path queries */
+    static void recordPaths(uint64_t queries, uint64_t found, uint64_t hopSum) {
+        if (TraversalStats* stats = active()) {
+            stats->pathQueries += queries;
+            stats->pathsFound += found;
+            stats->pathLengthSum += hopSum;
+        }
+    }
+
+private:
+    static TraversalStats*& active() {
+        static thread_local TraversalStats* stats = nullptr;
+        return stats;
+    }
+};
+
+/**
+ * Visited set over dense integer vertex IDs for in-harness traversals.
+ * One bit per vertex; the bitmap grows on demand and clear() only resets the
+ * words the last traversal touched, so a short query on a large graph does not
+ * pay for zeroing the whole bitmap.
+ */
+class VisitedBitmap {
+public:
+    /** Mark id as visited; returns false if it already was */
+    bool insert(uint64_t id) {
+        size_t word = static_cast<size_t>(id >> 6);
+        if (word >= words_.size()) {
+            words_.resize(std::max(word + 1, words_.size() * 2), 0);
+        }
+        uint64_t bit = uint64_t{1} << (id & 63);
+        uint64_t& bits = words_[word];
+        if (bits & bit) {
+            return false;
+        }
+        if (bits == 0) {
+            touched_.push_back(word);
+        }
+        bits |= bit;
+        return true;
+    }
+
+    bool contains(uint64_t id) const {
+        size_t word = static_cast<size_t>(id >> 6);
+        return word < words_.size() && (words_[word] >> (id & 63)) & 1;
+    }
+
+    void clear() {
+        for (size_t word : touched_) {
+            words_[word] = 0;
+        }
+        touched_.clear();
+    }
+
+private:
+    std::vector<uint64_t> words_;
+    std::vector<size_t> touched_;
+};
+
+} // namespace graphbench
@@ -0,0 +1,180 @@
+#pragma once
+
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace graphbench {
+
+using json = nlohmann::json;
+
+/**
+ * Summary statistics over the trials of one batch size run.
+ *
+ * Confidence intervals are percentile bootstrap intervals: the trial values are
+ * resampled with replacement BOOTSTRAP_RESAMPLES times, and the 2.5th and 97.5th
+ * percentiles of the resampled means (medians) bound the interval. The generator
+ * has a fixed seed, so the same trial values always give the same interval.
+ */
+struct TrialStatistics {
+    static constexpr int BOOTSTRAP_RESAMPLES = 1000;
+    static constexpr uint32_t BOOTSTRAP_SEED = 42;
+
+    static double mean(const std::vector<double>& values) {
+        if (values.empty()) {
+            return 0.0;
+        }
+        double sum = 0.0;
+        for (double value : values) {
+            sum += value;
+        }
+        return sum / values.size();
+    }
+
+    static double median(std::vector<double> values) {
+        if (values.empty()) {
+            return 0.0;
+        }
+        std::sort(values.begin(), values.end());
+        size_t mid = values.size() / 2;
+        return values.size() % 2 ? values[mid] : (values[mid - 1] + values[mid]) / 2;
+    }
+
+    /** Sample standard deviation divided by the mean (0 for fewer than two values or a zero mean) */
+    static double coefficientOfVariation(const std::vector<double>& values) {
+        double avg = mean(values);
+        if (values.size() < 2 || avg == 0.0) {
+            return 0.0;
+        }
+        double squares = 0.0;
+        for (double value : values) {
+            squares += (value - avg) * (value - avg);
+        }
+        return std::sqrt(squares / (values.size() - 1)) / std::abs(avg);
+    }
+
+    /**
+     * @return {"mean", "median", "mean_ci95": [low, high], "median_ci95": [low, high], "values"}
+     */
+    static json summarize(const std::vector<double>& values) {
+        std::vector<double> means;
+        std::vector<double> medians;
+        if (values.size() > 1) {
+            std::mt19937 rng(BOOTSTRAP_SEED);
+            std::uniform_int_distribution<size_t> pick(0, values.size() - 1);
+            std::vector<double> resample(values.size());
+            means.reserve(BOOTSTRAP_RESAMPLES);
+            medians.reserve(BOOTSTRAP_RESAMPLES);
+            for (int i = 0; i < BOOTSTRAP_RESAMPLES; i++) {
+                for (double& value : resample) {
+                    value = values[pick(rng)];
+                }
+                means.push_back(mean(resample));
+                medians.push_back(median(resample));
+            }
+        } else {
+            means = values;
+            medians = values;
+        }
+        return {
+            {"mean", mean(values)},
+            {"median", median(values)},
+            {"mean_ci95", interval(std::move(means))},
+            {"median_ci95", interval(std::move(medians))},
+            {"values", values}
+        };
+    }
+
+private:
+    /** [2.5th, 97.5th] percentile of the bootstrap estimates (nearest rank) */
+    static json interval(std::vector<double> estimates) {
+        if (estimates.empty()) {
+            return json::array();
+        }
+        std::sort(estimates.begin(), estimates.end());
+        auto rank = [&estimates](double quantile) {
+            size_t index = static_cast<size_t>(std::ceil(quantile * estimates.size()));
+            return estimates[std::min(estimates.size() - 1, index > 0 ? index - 1 : 0)];
+        };
+        return json::array({rank(0.025), rank(0.975)});
+    }
+};
+
+/**
+ * Warmup and repetition settings of a task, from its workload:
+ *
+ *   warmup_ops           operations issued after each restore and before timing,
+ *                        excluded from every statistic (default 0)
+ *   trials               maximum number of measured trials per batch size (default 1)
+ *   steady_state_window  number of most recent trials the steady-state test looks at (default 3)
+ *   steady_state_cv      stop before `trials` once the coefficient of variation of the
+ *                        last window's throughputs is at most this (default 0 = off)
+ */
+struct TrialPlan {
+    size_t warmupOps = 0;
+    int maxTrials = 1;
+    int window = 3;
+    double maxCv = 0.0;
+
+    static TrialPlan fromWorkload(const json& workload) {
+        TrialPlan plan;
+        int64_t warmupOps = workload.value("warmup_ops", static_cast<int64_t>(0));
+        plan.maxTrials = workload.value("trials", 1);
+        plan.window = workload.value("steady_state_window", 3);
+        plan.maxCv = workload.value("steady_state_cv", 0.0);
+        if (warmupOps < 0) {
+            throw std::runtime_error("warmup_ops must not be negative");
+        }
+        if (plan.maxTrials < 1) {
+            throw std::runtime_error("trials must be at least 1");
+        }
+        if (plan.window < 2) {
+            throw std::runtime_error("steady_state_window must be at least 2");
+        }
+        if (plan.maxCv < 0) {
+            throw std::runtime_error("steady_state_cv must not be negative");
+        }
+        plan.warmupOps = static_cast<size_t>(warmupOps);
+        return plan;
+    }
+
+    /** Coefficient of variation of the last window throughputs (0 until there are window of them) */
+    double windowCv(const std::vector<double>& throughputs) const {
+        if (throughputs.size() < static_cast<size_t>(window)) {
+            return 0.0;
+        }
+        return TrialStatistics::coefficientOfVariation(
+            std::vector<double>(throughputs.end() - window, throughputs.end()));
+    }
+
+    /** Whether the trials so far have reached a steady state (never when the detector is off) */
+    bool steady(const std::vector<double>& throughputs) const {
+        return maxCv > 0 && throughputs.size() >= static_cast<size_t>(window) && windowCv(throughputs) <= maxCv;
+    }
+
+    /**
+     * The "trials" entry of a batch result.
+     * @param latencies Mean operation latency of each trial (us)
+     * @param throughputs Throughput of each trial (ops/s)
+     */
+    json report(const std::vector<double>& latencies, const std::vector<double>& throughputs) const {
+        json trials = {
+            {"count", throughputs.size()},
+            {"max", maxTrials},
+            {"latency_us", TrialStatistics::summarize(latencies)},
+            {"throughput_ops_per_sec", TrialStatistics::summarize(throughputs)}
+        };
+        if (maxCv > 0) {
+            trials["steady_state"] = steady(throughputs);
+            trials["steady_state_window"] = window;
+            trials["window_cv"] = windowCv(throughputs);
+        }
+        return trials;
+    }
+};
+
+} // namespace graphbench
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <graphbench/number_format.hpp>
+#include <graphbench/property_type.hpp>
+#include <cstdint>
 #include <string>
 #include <any>
 #include <stdexcept>
@@ -9,11 +12,6 @@
 
 namespace graphbench {
 
-/**
- * Type enumeration for property types.
- */
-enum class PropertyType;
-
 /**
  * Utility class for converting values between different types.
  * Used for converting CSV strings and JSON values to the correct C++ types.
@@ -186,10 +184,10 @@ public:
                 return std::to_string(std::any_cast<int64_t>(value));
             }
             if (value.type() == typeid(float)) {
-                return std::to_string(std::any_cast<float>(value));
+                return shortestString(std::any_cast<float>(value));
             }
             if (value.type() == typeid(double)) {
-                return std::to_string(std::any_cast<double>(value));
+                return shortestString(std::any_cast<double>(value));
             }
             if (value.type() == typeid(bool)) {
                 return std::any_cast<bool>(value) ? "true" : "false";
@@ -202,6 +200,16 @@ public:
     }
 
 private:
+    /**
+     * Shortest decimal text that parses back to the same value ("3.5" rather than "3.500000"),
+     * so numbers read from CSV compare equal to their original text where possible.
+     */
+    template<typename T>
+    static std::string shortestString(T num) {
+        char buffer[SHORTEST_FORMAT_BYTES];
+        return std::string(buffer, formatShortest(buffer, num));
+    }
+
     /**
      * Parse boolean from string.
      * Accepts: "true", "false", "1", "0", "yes", "no" (case-insensitive)
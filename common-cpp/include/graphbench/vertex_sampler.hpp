@@ -0,0 +1,275 @@
+#pragma once
+
+#include <graphbench/degree_counts.hpp>
+#include <graphbench/synthetic_graph.hpp>
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace graphbench {
+
+using json = nlohmann::json;
+
+/**
+ * Zipf distribution over ranks 1..n with P(k) proportional to 1 / k^exponent, for
+ * any exponent > 0, by rejection-inversion (Hörmann and Derflinger, "Rejection-
+ * inversion to generate variates from monotone discrete distributions", 1996).
+ * Constant time per draw and no table, so it works for graphs of any size.
+ */
+class ZipfDistribution {
+public:
+    ZipfDistribution(uint64_t n, double exponent)
+        : n_(static_cast<double>(n)), exponent_(exponent),
+          hIntegralX1_(hIntegral(1.5) - 1.0), hIntegralN_(hIntegral(n_ + 0.5)),
+          s_(2.0 - hIntegralInverse(hIntegral(2.5) - h(2.0))) {
+        if (n == 0 || !(exponent > 0)) {
+            throw std::runtime_error("Zipf distribution needs at least one element and a positive exponent");
+        }
+    }
+
+    /** Rank in [1, n] */
+    template<typename Rng>
+    uint64_t operator()(Rng& rng) {
+        std::uniform_real_distribution<double> uniform(0.0, 1.0);
+        while (true) {
+            double u = hIntegralN_ + uniform(rng) * (hIntegralX1_ - hIntegralN_);
+            double x = hIntegralInverse(u);
+            double k = std::clamp(std::floor(x + 0.5), 1.0, n_);
+            if (k - x <= s_ || u >= hIntegral(k + 0.5) - h(k)) {
+                return static_cast<uint64_t>(k);
+            }
+        }
+    }
+
+private:
+    double n_;
+    double exponent_;
+    double hIntegralX1_;
+    double hIntegralN_;
+    double s_;
+
+    double h(double x) const { return std::exp(-exponent_ * std::log(x)); }
+
+    double hIntegral(double x) const {
+        double logX = std::log(x);
+        return expm1OverX((1.0 - exponent_) * logX) * logX;
+    }
+
+    double hIntegralInverse(double x) const {
+        double t = std::max(x * (1.0 - exponent_), -1.0);
+        return std::exp(log1pOverX(t) * x);
+    }
+
+    // log1p(x) / x and expm1(x) / x, continuous at 0
+    static double log1pOverX(double x) {
+        return std::abs(x) > 1e-8 ? std::log1p(x) / x : 1.0 - x * (0.5 - x * (1.0 / 3.0 - 0.25 * x));
+    }
+
+    static double expm1OverX(double x) {
+        return std::abs(x) > 1e-8 ? std::expm1(x) / x : 1.0 + x * 0.5 * (1.0 + x / 3.0 * (1.0 + 0.25 * x));
+    }
+};
+
+/**
+ * Vertex IDs drawn in the harness, so tasks that read (or remove) vertices do not
+ * need the IDs listed in the workload file. Wherever a task takes "ids", it can
+ * give a sampler specification instead of an array or binary reference:
+ *
+ *   {"$sample": {"distribution": "zipf", "count": 100000, "theta": 0.99, "seed": 7}}
+ *
+ * Distributions:
+ *   uniform   every vertex equally likely
+ *   zipf      the vertex of popularity rank k with probability proportional to 1 / k^theta
+ *             (theta > 0, default 0.99)
+ *   hotspot   hot_fraction of the vertices (default 0.2) receive hot_probability of the
+ *             draws (default 0.8), uniformly within the hot and the cold set
+ *   degree    probability proportional to the vertex's degree in the dataset; "degree"
+ *             selects out (default), in or both
+ *
+ * Vertices are the origin IDs 0 .. n-1 of nodes.csv or of a synthetic graph. The
+ * popularity ranks of zipf and hotspot are spread over the IDs by a seeded affine
+ * permutation, so the hot vertices are not simply the lowest IDs (which would also
+ * be neighbors in key order). Draws are with replacement unless "unique" is set (for
+ * REMOVE_VERTEX), and reproducible for a given seed. The node count and the degree
+ * counts come from LOAD_GRAPH (setLoadedGraph()), which visits every edge anyway,
+ * so they describe the loaded graph and sampling never rescans the dataset. Without
+ * a LOAD_GRAPH in the run, the node count is read from the dataset on first use and
+ * degree sampling fails.
+ */
+class VertexSampler {
+public:
+    explicit VertexSampler(std::string datasetPath) : datasetPath_(std::move(datasetPath)) {}
+
+    /** Node count and degree counts of the graph LOAD_GRAPH just loaded */
+    void setLoadedGraph(uint64_t nodeCount, DegreeCounts degrees) {
+        nodeCount_ = nodeCount;
+        counted_ = true;
+        degrees.resize(static_cast<size_t>(nodeCount));
+        outDegrees_ = std::move(degrees.out);
+        inDegrees_ = std::move(degrees.in);
+        degreesRecorded_ = true;
+        cumulative_.clear();
+        cumulativeKind_.clear();
+    }
+
+    static bool isSpec(const json& ids) {
+        return ids.is_object() && ids.contains("$sample");
+    }
+
+    /** Draw origin vertex IDs for a {"$sample": ...} specification */
+    std::vector<int64_t> sample(const json& ids) {
+        const json& spec = ids.at("$sample");
+        std::string distribution = spec.value("distribution", std::string("uniform"));
+        int64_t count = spec.at("count").get<int64_t>();
+        bool unique = spec.value("unique", false);
+        std::mt19937_64 rng(spec.value("seed", uint64_t(42)));
+        if (count < 0) {
+            throw std::runtime_error("Sample count must not be negative");
+        }
+        uint64_t n = nodeCount();
+        if (n == 0) {
+            throw std::runtime_error("Cannot sample vertices of an empty graph");
+        }
+        if (unique && static_cast<uint64_t>(count) > n) {
+            throw std::runtime_error("Cannot draw " + std::to_string(count) + " distinct vertices out of " +
+                                     std::to_string(n));
+        }
+
+        if (distribution == "uniform") {
+            std::uniform_int_distribution<uint64_t> pick(0, n - 1);
+            return draw(count, unique, [&]() { return pick(rng); });
+        }
+        if (distribution == "zipf") {
+            ZipfDistribution zipf(n, spec.value("theta", 0.99));
+            RankPermutation permutation(n, rng);
+            return draw(count, unique, [&]() { return permutation(zipf(rng) - 1); });
+        }
+        if (distribution == "hotspot") {
+            double hotFraction = spec.value("hot_fraction", 0.2);
+            double hotProbability = spec.value("hot_probability", 0.8);
+            if (!(hotFraction > 0 && hotFraction < 1) || hotProbability < 0 || hotProbability > 1) {
+                throw std::runtime_error("hotspot needs 0 < hot_fraction < 1 and 0 <= hot_probability <= 1");
+            }
+            uint64_t hot = std::clamp<uint64_t>(static_cast<uint64_t>(std::llround(n * hotFraction)), 1, n);
+            RankPermutation permutation(n, rng);
+            std::bernoulli_distribution inHotSet(hot < n ? hotProbability : 1.0);
+            std::uniform_int_distribution<uint64_t> pickHot(0, hot - 1);
+            std::uniform_int_distribution<uint64_t> pickCold(hot, std::max(hot, n - 1));
+            return draw(count, unique, [&]() {
+                return permutation(inHotSet(rng) ? pickHot(rng) : pickCold(rng));
+            });
+        }
+        if (distribution == "degree") {
+            const std::vector<uint64_t>& cumulative = cumulativeDegrees(spec.value("degree", std::string("out")));
+            uint64_t total = cumulative.empty() ? 0 : cumulative.back();
+            if (total == 0) {
+                throw std::runtime_error("Cannot sample by degree: the dataset has no edges");
+            }
+            std::uniform_int_distribution<uint64_t> pick(0, total - 1);
+            return draw(count, unique, [&]() {
+                // First vertex whose cumulative degree exceeds the draw
+                return static_cast<uint64_t>(std::upper_bound(cumulative.begin(), cumulative.end(), pick(rng)) -
+                                             cumulative.begin());
+            });
+        }
+        throw std::runtime_error("Unknown sample distribution: " + distribution +
+                                 " (expected uniform, zipf, hotspot or degree)");
+    }
+
+private:
+    // Give up on unique draws after this many draws per requested vertex
+    static constexpr int64_t UNIQUE_ATTEMPTS_PER_VERTEX = 1000;
+
+    std::string datasetPath_;
+    uint64_t nodeCount_ = 0;
+    bool counted_ = false;
+    bool degreesRecorded_ = false;
+    std::vector<uint32_t> outDegrees_;
+    std::vector<uint32_t> inDegrees_;
+    std::vector<uint64_t> cumulative_;    // Cumulative degrees of the kind in cumulativeKind_
+    std::string cumulativeKind_;
+
+    /** Bijection rank -> vertex ID, r -> (a * r + b) mod n with gcd(a, n) = 1 */
+    class RankPermutation {
+    public:
+        template<typename Rng>
+        RankPermutation(uint64_t n, Rng& rng) : n_(n) {
+            std::uniform_int_distribution<uint64_t> pick(0, n - 1);
+            do {
+                a_ = pick(rng);
+            } while (std::gcd(a_, n_) != 1);
+            b_ = pick(rng);
+        }
+
+        uint64_t operator()(uint64_t rank) const {
+            return static_cast<uint64_t>((static_cast<unsigned __int128>(a_) * rank + b_) % n_);
+        }
+
+    private:
+        uint64_t n_;
+        uint64_t a_ = 1;
+        uint64_t b_ = 0;
+    };
+
+    template<typename Draw>
+    static std::vector<int64_t> draw(int64_t count, bool unique, Draw next) {
+        std::vector<int64_t> ids;
+        ids.reserve(static_cast<size_t>(count));
+        if (!unique) {
+            for (int64_t i = 0; i < count; i++) {
+                ids.push_back(static_cast<int64_t>(next()));
+            }
+            return ids;
+        }
+        std::unordered_set<int64_t> seen;
+        int64_t attempts = count * UNIQUE_ATTEMPTS_PER_VERTEX;
+        while (static_cast<int64_t>(ids.size()) < count && attempts-- > 0) {
+            int64_t id = static_cast<int64_t>(next());
+            if (seen.insert(id).second) {
+                ids.push_back(id);
+            }
+        }
+        if (static_cast<int64_t>(ids.size()) < count) {
+            throw std::runtime_error("Distribution too skewed to draw " + std::to_string(count) + " distinct vertices");
+        }
+        return ids;
+    }
+
+    uint64_t nodeCount() {
+        if (!counted_) {
+            nodeCount_ = SyntheticGraph::countNodes(datasetPath_);
+            counted_ = true;
+        }
+        return nodeCount_;
+    }
+
+    const std::vector<uint64_t>& cumulativeDegrees(const std::string& kind) {
+        if (kind != "out" && kind != "in" && kind != "both") {
+            throw std::runtime_error("Unknown degree: " + kind + " (expected out, in or both)");
+        }
+        if (kind == cumulativeKind_) {
+            return cumulative_;
+        }
+        if (!degreesRecorded_) {
+            throw std::runtime_error("Sampling by degree needs the degree counts recorded by LOAD_GRAPH; "
+                                     "run LOAD_GRAPH before this task");
+        }
+        cumulative_.resize(outDegrees_.size());
+        uint64_t total = 0;
+        for (size_t vertex = 0; vertex < outDegrees_.size(); vertex++) {
+            total += (kind != "in" ? outDegrees_[vertex] : 0) + (kind != "out" ? inDegrees_[vertex] : 0);
+            cumulative_[vertex] = total;
+        }
+        cumulativeKind_ = kind;
+        return cumulative_;
+    }
+};
+
+} // namespace graphbench
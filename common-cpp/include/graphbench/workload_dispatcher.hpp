@@ -5,6 +5,20 @@
 #include <graphbench/benchmark_utils.hpp>
 #include <graphbench/workload_parameters.hpp>
 #include <graphbench/parameter_parser.hpp>
+#include <graphbench/property_benchmark_executor.hpp>
+#include <graphbench/property_schema.hpp>
+#include <graphbench/latency_histogram.hpp>
+#include <graphbench/concurrent_driver.hpp>
+#include <graphbench/cycle_clock.hpp>
+#include <graphbench/open_loop_schedule.hpp>
+#include <graphbench/traversal.hpp>
+#include <graphbench/binary_graph_cache.hpp>
+#include <graphbench/binary_parameters.hpp>
+#include <graphbench/perf_counters.hpp>
+#include <graphbench/trial_statistics.hpp>
+#include <graphbench/vertex_sampler.hpp>
+#include <graphbench/cache_control.hpp>
+#include <graphbench/degree_counts.hpp>
 #include <filesystem>
 #include <fstream>
 #include <vector>
@@ -14,6 +28,9 @@
 #include <sstream>
 #include <iostream>
 #include <memory>
+#include <optional>
+#include <functional>
+#include <atomic>
 
 namespace graphbench {
 
@@ -27,8 +44,13 @@ namespace fs = std::filesystem;
 template<typename Executor>
 class WorkloadDispatcher {
 public:
+    using SystemId = typename Executor::SystemIdType;
+    /** Receives result lines ("subtask", "task", "metadata") as soon as they are complete */
+    using ResultListener = std::function<void(const json&)>;
+
     WorkloadDispatcher(Executor* executor, const std::string& datasetPath)
-        : executor_(executor), datasetPath_(datasetPath), parameterParser_(executor) {
+        : executor_(executor), datasetPath_(datasetPath), parameterParser_(executor), vertexSampler_(datasetPath) {
+        parameterParser_.setVertexSampler(&vertexSampler_);
         // Get progress callback URL from environment
         std::string callbackUrl = BenchmarkUtils::getEnv("PROGRESS_CALLBACK_URL", "");
         progressCallback_ = std::make_shared<ProgressCallback>(callbackUrl);
@@ -39,6 +61,10 @@ public:
      * Returns results in the same format as Java implementation.
      */
     json executeBenchmark(const std::string& workloadDir) {
+        // Calibrate the operation timer before any operation is timed
+        const CycleClock::Calibration& timer = CycleClock::calibrate();
+        std::cout << "Timer: " << timer.source << ", overhead " << timer.overheadNs << " ns per read" << std::endl;
+
         // Initialize database
         executor_->initDatabase();
 
@@ -64,6 +90,7 @@ public:
         metadata["dataset"] = datasetName;
         metadata["datasetPath"] = datasetPath_;
         metadata["timestamp"] = getCurrentTimestamp();
+        metadata["timer"] = timer.toJson();
 
         // Get workload name from directory or first file
         std::string workloadName = extractWorkloadName(workloadFiles[0].parent_path().filename().string());
@@ -79,6 +106,7 @@ public:
 
             json result = executeWorkloadFile(workloadFile, i, totalTasks);
             results.push_back(result);
+            emitResult({{"type", "task"}, {"task_index", i}, {"result", result}});
 
             // If LOAD_GRAPH failed, stop execution
             if (result["task_type"] == "LOAD_GRAPH" && result["status"] == "failed") {
@@ -90,6 +118,11 @@ public:
         // Shutdown database
         executor_->shutdown();
 
+        // Deliver the remaining progress events before the results are returned
+        progressCallback_->flush();
+        metadata["progress_callback"] = progressCallback_->statsJson();
+        emitResult({{"type", "metadata"}, {"metadata", metadata}});
+
         // Build final response
         json response;
         response["metadata"] = metadata;
@@ -98,11 +131,34 @@ public:
         return response;
     }
 
+    /**
+     * Stream results while the benchmark runs (job API); without a listener,
+     * results are only returned by executeBenchmark().
+     */
+    void setResultListener(ResultListener listener) {
+        resultListener_ = std::move(listener);
+    }
+
 private:
     Executor* executor_;
     std::string datasetPath_;
     std::shared_ptr<ProgressCallback> progressCallback_;
     ParameterParser<Executor> parameterParser_;
+    VertexSampler vertexSampler_;                   // Draws sampled "ids" ({"$sample": ...})
+    std::optional<PropertySchema> propertySchema_;  // Read on the first property task
+    OpenLoopSchedule* openLoop_ = nullptr;          // Schedule of the running open-loop measurement
+    PerfCounters perfCounters_ = PerfCounters::fromEnv();  // PERF_COUNTERS around each measurement
+    size_t warmupPerClient_ = 0;                    // Leading items of each client's share used for warmup
+    bool warmingUp_ = false;                        // Clients issue only their warmup items
+    bool pageCacheWarned_ = false;                  // Whether a failed page cache drop was reported
+    std::atomic<size_t> warmedOps_{0};              // Operations issued by the running warmup
+    ResultListener resultListener_;
+
+    void emitResult(const json& line) {
+        if (resultListener_) {
+            resultListener_(line);
+        }
+    }
 
     std::string getCurrentTimestamp() {
         auto now = std::chrono::system_clock::now();
@@ -147,7 +203,18 @@ private:
                 .setTaskProgress(taskIndex, totalTasks)
         );
 
+        // Binary sidecar holding the large ID arrays of the parameters, mapped while the task runs
+        std::unique_ptr<ParameterFile> parameterFile;
+
         try {
+            // GRAPH_CACHE=build/rebuild converts the dataset here, outside the timed load
+            if (taskType == "LOAD_GRAPH") {
+                double cacheSeconds = BinaryGraphCache::prepare(datasetPath_);
+                if (cacheSeconds > 0) {
+                    result["graph_cache_build_seconds"] = cacheSeconds;
+                }
+            }
+
             auto startTime = std::chrono::high_resolution_clock::now();
 
             if (taskType == "LOAD_GRAPH") {
@@ -155,37 +222,95 @@ private:
             } else {
                 // Get parameters for all non-LOAD_GRAPH tasks
                 const auto& parameters = workload.at("parameters");
+                if (workload.contains("parameters_file")) {
+                    parameterFile = std::make_unique<ParameterFile>(
+                        workloadFile.parent_path() / workload.at("parameters_file").get<std::string>());
+                }
+                parameterParser_.setParameterFile(parameterFile.get());
+
+                // Number of concurrent client threads, 1 = serial execution on this thread
+                int clientThreads = std::max(1, workload.value("client_threads", 1));
 
                 if (taskType == "ADD_VERTEX") {
                     auto params = parameterParser_.parseAddVertexParameters(parameters);
+                    auto shares = ConcurrentDriver::partitionCount(params.count, clientThreads);
                     executeVaryBatchSizeBench(workload, result, taskIndex, totalTasks, params.count, params.count,
-                        [this, &params](int batchSize) {
-                            return executor_->addVertex(params.count, batchSize);
+                        [this, &shares](int batchSize, int thread) {
+                            return runClientCount(shares[thread], batchSize, thread, [this](int count, int size) {
+                                return executor_->addVertex(count, size);
+                            });
                         });
                 } else if (taskType == "ADD_EDGE") {
                     auto params = parameterParser_.parseAddEdgeParameters(parameters);
+                    auto slices = partitionForClients(params.pairs, clientThreads);
                     executeVaryBatchSizeBench(workload, result, taskIndex, totalTasks, params.originalCount, params.pairs.size(),
-                        [this, &params](int batchSize) {
-                            return executor_->addEdge(params.label, params.pairs, batchSize);
+                        [this, &params, &slices](int batchSize, int thread) {
+                            return runClientSlice(clientSlice(params.pairs, slices, thread), batchSize, thread,
+                                [this, &params](const auto& pairs, int size) {
+                                    return executor_->addEdge(params.label, pairs, size);
+                                });
                         });
                 } else if (taskType == "REMOVE_VERTEX") {
                     auto params = parameterParser_.parseRemoveVertexParameters(parameters);
+                    auto slices = partitionForClients(params.systemIds, clientThreads);
                     executeVaryBatchSizeBench(workload, result, taskIndex, totalTasks, params.originalCount, params.systemIds.size(),
-                        [this, &params](int batchSize) {
-                            return executor_->removeVertex(params.systemIds, batchSize);
+                        [this, &params, &slices](int batchSize, int thread) {
+                            return runClientSlice(clientSlice(params.systemIds, slices, thread), batchSize, thread,
+                                [this](const auto& systemIds, int size) {
+                                    return executor_->removeVertex(systemIds, size);
+                                });
                         });
                 } else if (taskType == "REMOVE_EDGE") {
                     auto params = parameterParser_.parseRemoveEdgeParameters(parameters);
+                    auto slices = partitionForClients(params.pairs, clientThreads);
                     executeVaryBatchSizeBench(workload, result, taskIndex, totalTasks, params.originalCount, params.pairs.size(),
-                        [this, &params](int batchSize) {
-                            return executor_->removeEdge(params.label, params.pairs, batchSize);
+                        [this, &params, &slices](int batchSize, int thread) {
+                            return runClientSlice(clientSlice(params.pairs, slices, thread), batchSize, thread,
+                                [this, &params](const auto& pairs, int size) {
+                                    return executor_->removeEdge(params.label, pairs, size);
+                                });
                         });
                 } else if (taskType == "GET_NBRS") {
                     auto params = parameterParser_.parseGetNbrsParameters(parameters);
+                    auto slices = partitionForClients(params.systemIds, clientThreads);
+                    int runBatchSize = 1;  // Written by client 0, read after the run
                     executeVaryBatchSizeBench(workload, result, taskIndex, totalTasks, params.originalCount, params.systemIds.size(),
-                        [this, &params](int batchSize) {
-                            return executor_->getNbrs(params.direction, params.systemIds, batchSize);
+                        [this, &params, &slices, &runBatchSize](int batchSize, int thread) {
+                            if (thread == 0) {
+                                runBatchSize = batchSize;
+                            }
+                            return runClientSlice(clientSlice(params.systemIds, slices, thread), batchSize, thread,
+                                [this, &params](const auto& systemIds, int size) {
+                                    return executor_->getNbrs(params.direction, systemIds, size);
+                                });
+                        },
+                        [this, &params, &slices, &runBatchSize, clientThreads](LatencyHistogram&, json& batchResult) {
+                            batchResult["unique_ids"] = uniqueIdsPerBatch(params.systemIds, slices, clientThreads, runBatchSize);
+                        });
+                } else if (isTraversalTask(taskType)) {
+                    executeTraversalTask(workload, parameters, result, taskIndex, totalTasks, clientThreads);
+                } else if (taskType == "MIXED") {
+                    auto params = parameterParser_.parseMixedParameters(parameters);
+                    auto slices = partitionForClients(params.ops, clientThreads);
+                    // One histogram per (client thread, operation type)
+                    std::vector<LatencyHistogram> opHistograms(clientThreads * MIXED_OP_TYPE_COUNT);
+                    executeVaryBatchSizeBench(workload, result, taskIndex, totalTasks, params.originalCount, params.ops.size(),
+                        [this, &params, &slices, &opHistograms](int batchSize, int thread) {
+                            LatencyHistogram* histograms = &opHistograms[thread * MIXED_OP_TYPE_COUNT];
+                            for (size_t type = 0; type < MIXED_OP_TYPE_COUNT; type++) {
+                                histograms[type].reset();
+                            }
+                            return runClientSlice(clientSlice(params.ops, slices, thread), batchSize, thread,
+                                [this, &params, histograms](BatchView<MixedOp> ops, int size) {
+                                    return executeMixedStream(params, ops, size, histograms);
+                                });
+                        },
+                        [this, &opHistograms, clientThreads](LatencyHistogram& histogram, json& batchResult) {
+                            // Open-loop runs already recorded the corrected latencies into the task histogram
+                            finishMixedBatch(opHistograms, clientThreads, openLoop_ == nullptr, histogram, batchResult);
                         });
+                } else if (isPropertyTask(taskType)) {
+                    executePropertyTask(workload, parameters, result, taskIndex, totalTasks, clientThreads);
                 } else {
                     result["status"] = "skipped";
                     result["message"] = "Task type not recognized: " + taskType;
@@ -206,6 +331,9 @@ private:
             );
 
         } catch (const std::exception& e) {
+            openLoop_ = nullptr;
+            warmupPerClient_ = 0;
+            warmingUp_ = false;
             result["status"] = "failed";
             result["error"] = e.what();
 
@@ -217,14 +345,31 @@ private:
                     .setTaskProgress(taskIndex, totalTasks)
             );
         }
+        parameterParser_.setParameterFile(nullptr);
 
         return result;
     }
 
     void executeLoadGraph(json& result) {
-        auto loadResult = executor_->loadGraph(datasetPath_);
+        // The loaders report every edge they visit, so degree sampling needs no second pass
+        DegreeCounts degrees;
+        std::map<std::string, std::any> loadResult;
+        {
+            DegreeRecorder::Scope degreeScope(&degrees);
+            loadResult = executor_->loadGraph(datasetPath_);
+        }
         result["nodes"] = std::any_cast<int>(loadResult["nodes"]);
         result["edges"] = std::any_cast<int>(loadResult["edges"]);
+        vertexSampler_.setLoadedGraph(static_cast<uint64_t>(std::any_cast<int>(loadResult["nodes"])), std::move(degrees));
+        if (loadResult.count("load_mode")) {
+            result["load_mode"] = std::any_cast<std::string>(loadResult["load_mode"]);
+        }
+        if (loadResult.count("property_index")) {
+            result["property_index"] = std::any_cast<std::string>(loadResult["property_index"]);
+        }
+        if (loadResult.count("engine_profile")) {
+            result["engine_profile"] = std::any_cast<std::string>(loadResult["engine_profile"]);
+        }
         result["status"] = "success";
 
         // Create snapshot after loading graph
@@ -233,10 +378,12 @@ private:
                 ProgressEvent("snapshot_start", "SNAPSHOT")
                     .setTaskProgress(0, 0)
             );
-            executor_->snapGraph();
+            RestoreStats snapshotStats = executor_->snapGraph();
+            result["snapshot_seconds"] = snapshotStats.seconds;
             progressCallback_->sendProgressCallback(
                 ProgressEvent("snapshot_complete", "SNAPSHOT")
                     .setStatus("success")
+                    .setDuration(snapshotStats.seconds)
                     .setTaskProgress(0, 0)
             );
         } catch (const std::exception& e) {
@@ -249,75 +396,599 @@ private:
         }
     }
 
+    static bool isPropertyTask(const std::string& taskType) {
+        return taskType == "UPDATE_VERTEX_PROPERTY" || taskType == "UPDATE_EDGE_PROPERTY" ||
+               taskType == "GET_VERTEX_BY_PROPERTY" || taskType == "GET_EDGE_BY_PROPERTY";
+    }
+
+    const PropertySchema& propertySchema() {
+        if (!propertySchema_) {
+            propertySchema_ = PropertySchema::read(datasetPath_);
+        }
+        return *propertySchema_;
+    }
+
+    /**
+     * Execute a property task on the executor's PropertyOperations.
+     * Like the Java dispatcher, the task is marked "unexecute" when the dataset has
+     * no property columns of the kind it targets.
+     */
+    void executePropertyTask(const json& workload, const json& parameters, json& result,
+                             int taskIndex, int totalTasks, int clientThreads) {
+        std::string taskType = workload.at("task_type").get<std::string>();
+        auto* properties = dynamic_cast<PropertyOperations<SystemId>*>(executor_);
+        if (!properties) {
+            throw std::runtime_error(taskType + " requires a property executor, but " +
+                                     executor_->getDatabaseName() + " has no property operations");
+        }
+
+        const PropertySchema& schema = propertySchema();
+        bool edgeTask = taskType == "UPDATE_EDGE_PROPERTY" || taskType == "GET_EDGE_BY_PROPERTY";
+        if (edgeTask ? !schema.hasEdgeProperties() : !schema.hasVertexProperties()) {
+            result["status"] = "unexecute";
+            result["skip_reason"] = std::string("Dataset has no ") + (edgeTask ? "edge" : "vertex") +
+                                    " property columns";
+            std::cout << "Skipping " << taskType << ": " << result["skip_reason"].get<std::string>() << std::endl;
+            return;
+        }
+
+        if (taskType == "UPDATE_VERTEX_PROPERTY") {
+            auto params = parameterParser_.parseUpdateVertexPropertyParameters(parameters, schema);
+            auto slices = partitionForClients(params.updates, clientThreads);
+            executeVaryBatchSizeBench(workload, result, taskIndex, totalTasks, params.originalCount, params.updates.size(),
+                [this, properties, &params, &slices](int batchSize, int thread) {
+                    return runClientSlice(clientSlice(params.updates, slices, thread), batchSize, thread,
+                        [properties](const auto& updates, int size) {
+                            return properties->updateVertexProperty(updates, size);
+                        });
+                });
+        } else if (taskType == "UPDATE_EDGE_PROPERTY") {
+            auto params = parameterParser_.parseUpdateEdgePropertyParameters(parameters, schema);
+            auto slices = partitionForClients(params.updates, clientThreads);
+            executeVaryBatchSizeBench(workload, result, taskIndex, totalTasks, params.originalCount, params.updates.size(),
+                [this, properties, &params, &slices](int batchSize, int thread) {
+                    return runClientSlice(clientSlice(params.updates, slices, thread), batchSize, thread,
+                        [properties, &params](const auto& updates, int size) {
+                            return properties->updateEdgeProperty(params.label, updates, size);
+                        });
+                });
+        } else if (taskType == "GET_VERTEX_BY_PROPERTY") {
+            auto params = parameterParser_.parseGetVertexByPropertyParameters(parameters, schema);
+            auto slices = partitionForClients(params.queries, clientThreads);
+            executeVaryBatchSizeBench(workload, result, taskIndex, totalTasks, params.originalCount, params.queries.size(),
+                [this, properties, &params, &slices](int batchSize, int thread) {
+                    return runClientSlice(clientSlice(params.queries, slices, thread), batchSize, thread,
+                        [properties](const auto& queries, int size) {
+                            return properties->getVertexByProperty(queries, size);
+                        });
+                });
+        } else {
+            auto params = parameterParser_.parseGetEdgeByPropertyParameters(parameters, schema);
+            auto slices = partitionForClients(params.queries, clientThreads);
+            executeVaryBatchSizeBench(workload, result, taskIndex, totalTasks, params.originalCount, params.queries.size(),
+                [this, properties, &params, &slices](int batchSize, int thread) {
+                    return runClientSlice(clientSlice(params.queries, slices, thread), batchSize, thread,
+                        [properties](const auto& queries, int size) {
+                            return properties->getEdgeByProperty(queries, size);
+                        });
+                });
+        }
+    }
+
+    static bool isTraversalTask(const std::string& taskType) {
+        return taskType == "K_HOP" || taskType == "BFS" || taskType == "SHORTEST_PATH";
+    }
+
+    /**
+     * Execute a multi-hop traversal task. Each client thread collects the visited
+     * counts its traversals report; they are summed into a "traversal" entry of
+     * every batch result, next to the latency summary.
+     */
+    void executeTraversalTask(const json& workload, const json& parameters, json& result,
+                              int taskIndex, int totalTasks, int clientThreads) {
+        std::string taskType = workload.at("task_type").get<std::string>();
+        std::vector<TraversalStats> stats(clientThreads);
+        auto finishTraversalBatch = [&stats](LatencyHistogram&, json& batchResult) {
+            TraversalStats total;
+            for (const TraversalStats& threadStats : stats) {
+                total.merge(threadStats);
+            }
+            batchResult["traversal"] = total.toJson();
+        };
+
+        if (taskType == "SHORTEST_PATH") {
+            auto params = parameterParser_.parseShortestPathParameters(parameters);
+            auto slices = partitionForClients(params.pairs, clientThreads);
+            executeVaryBatchSizeBench(workload, result, taskIndex, totalTasks, params.originalCount, params.pairs.size(),
+                [this, &params, &slices, &stats](int batchSize, int thread) {
+                    stats[thread] = TraversalStats();
+                    TraversalRecorder::Scope statsScope(&stats[thread]);
+                    return runClientSlice(clientSlice(params.pairs, slices, thread), batchSize, thread,
+                        [this, &params](const auto& pairs, int size) {
+                            return executor_->shortestPath(params.direction, params.maxDepth, pairs, size);
+                        });
+                },
+                finishTraversalBatch);
+            return;
+        }
+
+        bool kHop = taskType == "K_HOP";
+        auto params = parameterParser_.parseTraversalParameters(parameters, kHop ? "depth" : "max_depth", kHop ? 2 : 0);
+        if (kHop && params.depth < 1) {
+            throw std::runtime_error("K_HOP depth must be at least 1");
+        }
+        auto slices = partitionForClients(params.systemIds, clientThreads);
+        executeVaryBatchSizeBench(workload, result, taskIndex, totalTasks, params.originalCount, params.systemIds.size(),
+            [this, &params, &slices, &stats, kHop](int batchSize, int thread) {
+                stats[thread] = TraversalStats();
+                TraversalRecorder::Scope statsScope(&stats[thread]);
+                return runClientSlice(clientSlice(params.systemIds, slices, thread), batchSize, thread,
+                    [this, &params, kHop](const auto& systemIds, int size) {
+                        return kHop ? executor_->kHop(params.direction, params.depth, systemIds, size)
+                                    : executor_->bfs(params.direction, params.depth, systemIds, size);
+                    });
+            },
+            finishTraversalBatch);
+    }
+
+    /**
+     * Split parameter items into one slice (a view into items) per client thread.
+     * Serial runs (one client) return no slices and use the original vector directly.
+     */
+    template<typename T>
+    static std::vector<BatchView<T>> partitionForClients(const std::vector<T>& items, int clientThreads) {
+        if (clientThreads <= 1) {
+            return {};
+        }
+        return ConcurrentDriver::partition(items, clientThreads);
+    }
+
+    template<typename T>
+    static BatchView<T> clientSlice(const std::vector<T>& items, const std::vector<BatchView<T>>& slices, int thread) {
+        return slices.empty() ? BatchView<T>(items) : slices[thread];
+    }
+
+    /**
+     * Distinct items summed over the batches of one measured run: each client's share
+     * after its warmup items, cut into batchSize chunks from its start as the executors
+     * and OpenLoopSchedule cut it. Reported next to GET_NBRS latencies, since a
+     * repeated vertex within a batch may be served from what the first lookup cached.
+     */
+    template<typename T>
+    size_t uniqueIdsPerBatch(const std::vector<T>& items, const std::vector<BatchView<T>>& slices,
+                             int clientThreads, int batchSize) const {
+        size_t step = static_cast<size_t>(std::max(batchSize, 1));
+        size_t unique = 0;
+        std::vector<T> batch;
+        for (int thread = 0; thread < clientThreads; thread++) {
+            BatchView<T> share = clientSlice(items, slices, thread);
+            for (size_t offset = std::min(warmupPerClient_, share.size()); offset < share.size(); offset += step) {
+                size_t count = std::min(step, share.size() - offset);
+                batch.assign(share.data() + offset, share.data() + offset + count);
+                std::sort(batch.begin(), batch.end());
+                unique += static_cast<size_t>(std::unique(batch.begin(), batch.end()) - batch.begin());
+            }
+        }
+        return unique;
+    }
+
+    /**
+     * Run one client's share of a task: a single executor call in closed-loop runs,
+     * or batch by batch on the open-loop schedule. With warmup_ops the first
+     * warmupPerClient_ items of the share are issued (closed loop) during the
+     * warmup and skipped by the measured run.
+     *
+     * @param call Function (items, batchSize) issuing the items through the executor
+     */
+    template<typename T, typename Call>
+    std::vector<double> runClientSlice(BatchView<T> items, int batchSize, int thread, Call call) {
+        if (warmupPerClient_ > 0) {
+            // The first items of the share warm up; only the rest is measured
+            size_t warmup = std::min(warmupPerClient_, items.size());
+            if (warmingUp_) {
+                warmedOps_ += warmup;
+                return warmup > 0 ? call(items.slice(0, warmup), batchSize) : std::vector<double>();
+            }
+            items = items.slice(warmup, items.size());
+        }
+        if (!openLoop_) {
+            return call(items, batchSize);
+        }
+        return openLoop_->run(thread, items.size(), batchSize, [&](size_t offset, size_t count) {
+            return call(items.slice(offset, count), static_cast<int>(count));
+        });
+    }
+
+    /**
+     * Count-based variant of runClientSlice (ADD_VERTEX).
+     *
+     * @param call Function (count, batchSize)
+     */
+    template<typename Call>
+    std::vector<double> runClientCount(int count, int batchSize, int thread, Call call) {
+        if (warmupPerClient_ > 0) {
+            int warmup = static_cast<int>(std::min(warmupPerClient_, static_cast<size_t>(std::max(count, 0))));
+            if (warmingUp_) {
+                warmedOps_ += static_cast<size_t>(warmup);
+                return warmup > 0 ? call(warmup, batchSize) : std::vector<double>();
+            }
+            count -= warmup;
+        }
+        if (!openLoop_) {
+            return call(count, batchSize);
+        }
+        return openLoop_->run(thread, static_cast<size_t>(std::max(count, 0)), batchSize,
+            [&](size_t, size_t batchCount) {
+                return call(static_cast<int>(batchCount), static_cast<int>(batchCount));
+            });
+    }
+
+    /**
+     * Target rates of an open-loop task: "target_ops_per_sec" as a number or as a list
+     * (throughput sweep). Empty for closed-loop tasks.
+     */
+    static std::vector<double> targetRates(const json& workload) {
+        std::vector<double> rates;
+        if (!workload.contains("target_ops_per_sec")) {
+            return rates;
+        }
+        const json& target = workload.at("target_ops_per_sec");
+        if (target.is_array()) {
+            rates = target.get<std::vector<double>>();
+        } else {
+            rates.push_back(target.get<double>());
+        }
+        for (double rate : rates) {
+            if (rate <= 0) {
+                throw std::runtime_error("target_ops_per_sec must be positive");
+            }
+        }
+        return rates;
+    }
+
+    /** A run of consecutive pool items of a mixed task, without copying them */
+    template<typename T>
+    static BatchView<T> runOf(const std::vector<T>& pool, uint32_t first, int runLength) {
+        return BatchView<T>(pool).slice(first, static_cast<size_t>(runLength));
+    }
+
+    /**
+     * Replay one client's share of a mixed operation stream.
+     * Consecutive operations of the same type are coalesced into one executor
+     * call of at most batchSize operations; each call records into the histogram
+     * of its operation type.
+     *
+     * @param histograms MIXED_OP_TYPE_COUNT histograms owned by this client (reset by the caller)
+     */
+    std::vector<double> executeMixedStream(const MixedParameters<SystemId>& params, BatchView<MixedOp> ops,
+                                           int batchSize, LatencyHistogram* histograms) {
+        size_t maxRun = static_cast<size_t>(std::max(batchSize, 1));
+        std::vector<double> latencies;
+
+        size_t i = 0;
+        while (i < ops.size()) {
+            size_t runStart = i;
+            MixedOpType type = ops[runStart].type;
+            uint32_t first = ops[runStart].index;
+            while (i < ops.size() && i - runStart < maxRun && ops[i].type == type
+                   && ops[i].index == first + (i - runStart)) {
+                i++;
+            }
+            int runLength = static_cast<int>(i - runStart);
+
+            LatencyRecorder::Scope recorderScope(&histograms[static_cast<size_t>(type)]);
+            std::vector<double> runLatencies;
+            switch (type) {
+                case MixedOpType::ADD_VERTEX:
+                    runLatencies = executor_->addVertex(runLength, runLength);
+                    break;
+                case MixedOpType::ADD_EDGE:
+                    runLatencies = executor_->addEdge(params.label, runOf(params.addEdgePairs, first, runLength), runLength);
+                    break;
+                case MixedOpType::REMOVE_VERTEX:
+                    runLatencies = executor_->removeVertex(runOf(params.removeVertexIds, first, runLength), runLength);
+                    break;
+                case MixedOpType::REMOVE_EDGE:
+                    runLatencies = executor_->removeEdge(params.label, runOf(params.removeEdgePairs, first, runLength), runLength);
+                    break;
+                case MixedOpType::GET_NBRS:
+                    runLatencies = executor_->getNbrs(params.direction, runOf(params.getNbrsIds, first, runLength), runLength);
+                    break;
+                default:
+                    break;
+            }
+            latencies.insert(latencies.end(), runLatencies.begin(), runLatencies.end());
+        }
+        return latencies;
+    }
+
+    /**
+     * Merge the per-client, per-type histograms of a mixed run into the task
+     * histogram (unless mergeIntoTotal is false) and add the per-type breakdown to
+     * the batch result.
+     */
+    static void finishMixedBatch(const std::vector<LatencyHistogram>& opHistograms, int clientThreads,
+                                 bool mergeIntoTotal, LatencyHistogram& histogram, json& batchResult) {
+        json opLatency = json::object();
+        for (size_t type = 0; type < MIXED_OP_TYPE_COUNT; type++) {
+            LatencyHistogram typeHistogram;
+            for (int thread = 0; thread < clientThreads; thread++) {
+                typeHistogram.merge(opHistograms[thread * MIXED_OP_TYPE_COUNT + type]);
+            }
+            if (mergeIntoTotal) {
+                histogram.merge(typeHistogram);
+            }
+            if (typeHistogram.count() > 0) {
+                opLatency[mixedOpTypeName(static_cast<MixedOpType>(type))] = typeHistogram.percentilesJson();
+            }
+        }
+        batchResult["op_latency"] = opLatency;
+    }
+
+    /** Outcome of running every client's share of a task once */
+    struct Measurement {
+        LatencyHistogram histogram;   // Per-operation latencies recorded by the executor or schedule
+        std::vector<double> latencies;
+        double wallSeconds = 0.0;     // Until the last client finished
+        double duration = 0.0;
+    };
+
+    /** Run taskFunc on clientThreads pinned clients (or on this thread) and time it */
+    template<typename Func>
+    Measurement measure(Func& taskFunc, int batchSize, int clientThreads) {
+        Measurement measurement;
+        auto startTime = std::chrono::high_resolution_clock::now();
+        if (clientThreads > 1) {
+            ConcurrentDriver driver(clientThreads);
+            auto concurrentResult = driver.run([&taskFunc, batchSize](int thread) {
+                return taskFunc(batchSize, thread);
+            });
+            measurement.histogram.merge(concurrentResult.histogram);
+            measurement.latencies = std::move(concurrentResult.latencies);
+            measurement.wallSeconds = concurrentResult.wallSeconds;
+        } else {
+            LatencyRecorder::Scope recorderScope(&measurement.histogram);
+            measurement.latencies = taskFunc(batchSize, 0);
+        }
+        auto endTime = std::chrono::high_resolution_clock::now();
+        measurement.duration = std::chrono::duration<double>(endTime - startTime).count();
+        if (clientThreads <= 1) {
+            measurement.wallSeconds = measurement.duration;
+        }
+        return measurement;
+    }
+
+    /**
+     * Issue the warmup items of every client's share, closed loop and untimed.
+     * @return Number of operations issued
+     */
+    template<typename Func>
+    size_t warmUp(Func& taskFunc, int batchSize, int clientThreads) {
+        warmedOps_ = 0;
+        warmingUp_ = true;
+        measure(taskFunc, batchSize, clientThreads);
+        warmingUp_ = false;
+        return warmedOps_.load();
+    }
+
+    /**
+     * Bring the caches into the state of the task's cache_mode (see CacheControl).
+     * @return {"mode", "engine_cache_reset", "page_cache_dropped", "page_cache_error",
+     *         "prewarmed", "seconds"}, or null for as_is
+     */
+    json prepareCache(CacheMode mode) {
+        if (mode == CacheMode::AS_IS) {
+            return nullptr;
+        }
+        auto start = std::chrono::steady_clock::now();
+        json state = {{"mode", CacheControl::name(mode)}};
+        if (mode == CacheMode::COLD) {
+            // The engine first, since reopening it reads files back into the page cache
+            state["engine_cache_reset"] = executor_->resetEngineCache();
+            std::string error = CacheControl::dropPageCache();
+            state["page_cache_dropped"] = error.empty();
+            if (!error.empty()) {
+                state["page_cache_error"] = error;
+                if (!pageCacheWarned_) {
+                    std::cerr << "Warning: cannot drop the page cache (" << error
+                              << "); cold runs need a privileged container" << std::endl;
+                    pageCacheWarned_ = true;
+                }
+            }
+        } else {
+            state["prewarmed"] = executor_->prewarmCache();
+        }
+        state["seconds"] = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return state;
+    }
+
+    /** Restore the graph to its loaded state, reporting progress; a failed restore only warns */
+    RestoreStats restoreBeforeRun(int taskIndex, int totalTasks) {
+        RestoreStats restoreStats;
+        try {
+            progressCallback_->sendProgressCallback(
+                ProgressEvent("restore_start", "RESTORE")
+                    .setTaskProgress(taskIndex, totalTasks)
+            );
+            restoreStats = executor_->restoreGraph();
+            progressCallback_->sendProgressCallback(
+                ProgressEvent("restore_complete", "RESTORE")
+                    .setStatus("success")
+                    .setDuration(restoreStats.seconds)
+                    .setTaskProgress(taskIndex, totalTasks)
+            );
+        } catch (const std::exception& e) {
+            progressCallback_->sendProgressCallback(
+                ProgressEvent("restore_complete", "RESTORE")
+                    .setStatus("failed")
+                    .setTaskProgress(taskIndex, totalTasks)
+            );
+            std::cerr << "Warning: Failed to restore graph: " << e.what() << std::endl;
+        }
+        return restoreStats;
+    }
+
+    template<typename Func>
+    void executeVaryBatchSizeBench(const json& workload, json& result, int taskIndex, int totalTasks,
+                         int originalCount, int validCount, Func taskFunc) {
+        executeVaryBatchSizeBench(workload, result, taskIndex, totalTasks, originalCount, validCount, taskFunc,
+                                  [](LatencyHistogram&, json&) {});
+    }
+
     /**
      * Execute a task with automatic restore before each batch size.
      * Similar to Java's transactionalExecute method.
+     * When the workload sets client_threads > 1 the task runs on that many pinned
+     * client threads, each working on its own slice of the parameters.
+     * When it sets target_ops_per_sec the task runs open-loop on an OpenLoopSchedule,
+     * once per batch size and target rate (a list of rates is a throughput sweep);
+     * latency is then measured from each batch's intended start.
+     * Each run can repeat as several trials (TrialPlan: warmup_ops, trials and the
+     * steady-state stop); every trial restores, warms up and is measured, and the
+     * batch result reports the trials' means with bootstrap confidence intervals.
+     * cache_mode prepares the caches after every restore (CacheControl).
      *
-     * @param workload Workload JSON containing task_type and batch_sizes
+     * @param workload Workload JSON containing task_type, batch_sizes and optional client_threads,
+     *                 target_ops_per_sec, warmup_ops, trials, steady_state_window, steady_state_cv
+     *                 and cache_mode
      * @param result Result JSON to populate
      * @param taskIndex Current task index
      * @param totalTasks Total number of tasks
      * @param numOps Number of operations for this task
-     * @param taskFunc Function that executes the actual task for a given batch size
+     * @param taskFunc Function (batchSize, threadIndex) that executes one client's share of the task
+     * @param finishBatch Function (histogram, batchResult) run after each trial with that trial's
+     *                    histogram, before the latency summary is written; lets a task add its
+     *                    own breakdown
      */
-    template<typename Func>
+    template<typename Func, typename FinishFunc>
     void executeVaryBatchSizeBench(const json& workload, json& result, int taskIndex, int totalTasks,
-                         int originalCount, int validCount, Func taskFunc) {
-        std::vector<int> batchSizes = workload.at("batch_sizes").get<std::vector<int>>();
+                         int originalCount, int validCount, Func taskFunc, FinishFunc finishBatch) {
+        // Default to batch size 1 when not specified (same as the Java dispatcher)
+        std::vector<int> batchSizes = workload.value("batch_sizes", std::vector<int>{1});
         json batchResults = json::array();
         std::string taskType = workload.at("task_type").get<std::string>();
-
+        int clientThreads = std::max(1, workload.value("client_threads", 1));
+
+        // One run per batch size, or per (batch size, target rate) for open-loop tasks
+        struct Run {
+            int batchSize;
+            double targetRate;  // 0 = closed loop
+        };
+        std::vector<double> rates = targetRates(workload);
+        std::vector<Run> runs;
         for (int batchSize : batchSizes) {
-            // Restore graph to clean state before executing workload
-            try {
-                progressCallback_->sendProgressCallback(
-                    ProgressEvent("restore_start", "RESTORE")
-                        .setTaskProgress(taskIndex, totalTasks)
-                );
-                executor_->restoreGraph();
-                progressCallback_->sendProgressCallback(
-                    ProgressEvent("restore_complete", "RESTORE")
-                        .setStatus("success")
-                        .setTaskProgress(taskIndex, totalTasks)
-                );
-            } catch (const std::exception& e) {
-                progressCallback_->sendProgressCallback(
-                    ProgressEvent("restore_complete", "RESTORE")
-                        .setStatus("failed")
-                        .setTaskProgress(taskIndex, totalTasks)
-                );
-                std::cerr << "Warning: Failed to restore graph: " << e.what() << std::endl;
+            if (rates.empty()) {
+                runs.push_back({batchSize, 0.0});
+            }
+            for (double rate : rates) {
+                runs.push_back({batchSize, rate});
             }
+        }
+
+        TrialPlan plan = TrialPlan::fromWorkload(workload);
+        if (plan.warmupOps > 0 && plan.warmupOps >= static_cast<size_t>(std::max(validCount, 0))) {
+            throw std::runtime_error("warmup_ops (" + std::to_string(plan.warmupOps) +
+                                     ") must be smaller than the task's " + std::to_string(validCount) + " valid operations");
+        }
+        warmupPerClient_ = (plan.warmupOps + clientThreads - 1) / clientThreads;
+        CacheMode cacheMode = CacheControl::modeFromWorkload(workload);
+
+        for (const Run& run : runs) {
+            int batchSize = run.batchSize;
+            RestoreStats restoreStats = restoreBeforeRun(taskIndex, totalTasks);
 
             // Send subtask start callback
-            std::string subtaskName = taskType + " (batch_size=" + std::to_string(batchSize) + ")";
+            std::string subtaskName = taskType + " (batch_size=" + std::to_string(batchSize);
+            if (run.targetRate > 0) {
+                subtaskName += ", target=" + std::to_string(static_cast<int64_t>(run.targetRate)) + " ops/s";
+            }
+            subtaskName += ")";
             progressCallback_->sendProgressCallback(
                 ProgressEvent("subtask_start", subtaskName)
                     .setTaskProgress(taskIndex, totalTasks)
                     .setNumOps(validCount)
             );
 
-            auto startTime = std::chrono::high_resolution_clock::now();
-            auto latencies = taskFunc(batchSize);
-            auto endTime = std::chrono::high_resolution_clock::now();
-            double duration = std::chrono::duration<double>(endTime - startTime).count();
+            // Each trial restores (after the first), warms up and is measured; the task
+            // breakdown, open-loop summary and counters of the batch result are the last trial's
+            LatencyHistogram histogram;  // All measured trials
+            json batchResult;
+            std::vector<double> trialLatencies;
+            std::vector<double> trialThroughputs;
+            size_t measuredOps = static_cast<size_t>(validCount);
+            double duration = 0.0;
+            bool steady = false;
+            for (int trial = 0; trial < plan.maxTrials && !steady; trial++) {
+                if (trial > 0) {
+                    restoreBeforeRun(taskIndex, totalTasks);
+                }
+                json cacheState = prepareCache(cacheMode);
+                if (warmupPerClient_ > 0) {
+                    measuredOps = static_cast<size_t>(validCount) - warmUp(taskFunc, batchSize, clientThreads);
+                }
+
+                std::optional<OpenLoopSchedule> schedule;
+                if (run.targetRate > 0) {
+                    schedule.emplace(run.targetRate, clientThreads);
+                    openLoop_ = &*schedule;
+                }
 
-            double avgLatency = 0.0;
-            for (double lat : latencies) {
-                avgLatency += lat;
+                EngineCounters engineBefore = executor_->engineStats();
+                perfCounters_.start();
+                Measurement measurement = measure(taskFunc, batchSize, clientThreads);
+                json perfSummary = perfCounters_.stop(measuredOps);
+                EngineCounters engineAfter = executor_->engineStats();
+                duration += measurement.duration;
+
+                batchResult = json::object();
+                if (!cacheState.is_null()) {
+                    batchResult["cache"] = cacheState;
+                }
+                finishBatch(measurement.histogram, batchResult);
+                openLoop_ = nullptr;
+                if (schedule) {
+                    batchResult["load_mode"] = "open_loop";
+                    batchResult.update(schedule->summaryJson());
+                }
+                if (!perfSummary.is_null()) {
+                    batchResult["perf_counters"] = perfSummary;
+                }
+                if (!engineBefore.empty()) {
+                    batchResult["engine_stats"] = EngineStats::delta(engineBefore, engineAfter);
+                }
+
+                histogram.merge(measurement.histogram);
+                trialLatencies.push_back(TrialStatistics::mean(measurement.latencies));
+                trialThroughputs.push_back(measurement.wallSeconds > 0 ? measuredOps / measurement.wallSeconds : 0.0);
+                steady = plan.steady(trialThroughputs);
             }
-            avgLatency /= latencies.size();
 
-            json batchResult;
             batchResult["batch_size"] = batchSize;
-            batchResult["latency_us"] = avgLatency;
+            batchResult["latency_us"] = TrialStatistics::mean(trialLatencies);
+            batchResult["latency"] = histogram.percentilesJson();
+            batchResult["histogram"] = histogram.bucketsJson();
+            batchResult["client_threads"] = clientThreads;
+            batchResult["throughput_ops_per_sec"] = TrialStatistics::mean(trialThroughputs);
+            if (plan.maxTrials > 1) {
+                batchResult["trials"] = plan.report(trialLatencies, trialThroughputs);
+            }
+            batchResult["restore_seconds"] = restoreStats.seconds;
+            batchResult["restore_strategy"] = restoreStats.strategy;
+            if (restoreStats.itemsReverted > 0) {
+                batchResult["restore_items_reverted"] = restoreStats.itemsReverted;
+            }
             batchResult["validOpsCount"] = validCount;
             batchResult["filteredOpsCount"] = originalCount - validCount;
             batchResult["errorCount"] = 0;
             batchResult["originalOpsCount"] = originalCount;
+            if (warmupPerClient_ > 0) {
+                batchResult["warmup_ops"] = validCount - static_cast<int64_t>(measuredOps);
+                batchResult["measured_ops"] = measuredOps;
+            }
             batchResult["status"] = "success";
 
             batchResults.push_back(batchResult);
+            emitResult({{"type", "subtask"}, {"task_index", taskIndex}, {"task_type", taskType}, {"batch_result", batchResult}});
 
             // Send subtask complete callback
             progressCallback_->sendProgressCallback(
@@ -328,6 +999,7 @@ private:
                     .setOpsCounts(originalCount, validCount, originalCount - validCount)
             );
         }
+        warmupPerClient_ = 0;
 
         result["batch_results"] = batchResults;
         result["status"] = "success";
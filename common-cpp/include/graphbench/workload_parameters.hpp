@@ -25,82 +25,177 @@ struct AddVertexParameters : public WorkloadParameters {
 /**
  * Parameters for ADD_EDGE task.
  */
+template<typename SystemId>
 struct AddEdgeParameters : public WorkloadParameters {
     std::string label;
-    std::vector<std::pair<std::any, std::any>> pairs;  // Pre-converted system IDs
+    std::vector<std::pair<SystemId, SystemId>> pairs;  // Pre-converted system IDs
     int originalCount;  // Original number of pairs before conversion
 };
 
 /**
  * Parameters for REMOVE_VERTEX task.
  */
+template<typename SystemId>
 struct RemoveVertexParameters : public WorkloadParameters {
-    std::vector<std::any> systemIds;  // Pre-converted system IDs
+    std::vector<SystemId> systemIds;  // Pre-converted system IDs
     int originalCount;
 };
 
 /**
  * Parameters for REMOVE_EDGE task.
  */
+template<typename SystemId>
 struct RemoveEdgeParameters : public WorkloadParameters {
     std::string label;
-    std::vector<std::pair<std::any, std::any>> pairs;  // Pre-converted system IDs
+    std::vector<std::pair<SystemId, SystemId>> pairs;  // Pre-converted system IDs
     int originalCount;
 };
 
 /**
  * Parameters for GET_NBRS task.
  */
+template<typename SystemId>
 struct GetNbrsParameters : public WorkloadParameters {
     std::string direction;
-    std::vector<std::any> systemIds;  // Pre-converted system IDs
+    std::vector<SystemId> systemIds;  // Pre-converted system IDs
     int originalCount;
 };
 
+/**
+ * Parameters for K_HOP and BFS tasks.
+ */
+template<typename SystemId>
+struct TraversalParameters : public WorkloadParameters {
+    std::string direction;
+    int depth = 0;                    // K_HOP: hop count; BFS: max depth, 0 = unbounded
+    std::vector<SystemId> systemIds;  // Pre-converted start vertices
+    int originalCount = 0;
+};
+
+/**
+ * Parameters for SHORTEST_PATH task.
+ */
+template<typename SystemId>
+struct ShortestPathParameters : public WorkloadParameters {
+    std::string direction;
+    int maxDepth = 0;                                  // 0 = unbounded
+    std::vector<std::pair<SystemId, SystemId>> pairs;  // Pre-converted (src, dst) system IDs
+    int originalCount = 0;
+};
+
+/**
+ * Operation kinds that can appear in a MIXED task.
+ */
+enum class MixedOpType : uint8_t {
+    ADD_VERTEX,
+    ADD_EDGE,
+    REMOVE_VERTEX,
+    REMOVE_EDGE,
+    GET_NBRS,
+    COUNT
+};
+
+constexpr size_t MIXED_OP_TYPE_COUNT = static_cast<size_t>(MixedOpType::COUNT);
+
+inline const char* mixedOpTypeName(MixedOpType type) {
+    switch (type) {
+        case MixedOpType::ADD_VERTEX: return "ADD_VERTEX";
+        case MixedOpType::ADD_EDGE: return "ADD_EDGE";
+        case MixedOpType::REMOVE_VERTEX: return "REMOVE_VERTEX";
+        case MixedOpType::REMOVE_EDGE: return "REMOVE_EDGE";
+        case MixedOpType::GET_NBRS: return "GET_NBRS";
+        default: return "UNKNOWN";
+    }
+}
+
+/**
+ * One entry of a pre-generated mixed operation stream.
+ * index points into the per-type parameter array of MixedParameters; indices of
+ * one type are assigned in stream order, so a run of same-type operations maps
+ * to a contiguous range of that array.
+ */
+struct MixedOp {
+    MixedOpType type;
+    uint32_t index;
+};
+
+/**
+ * Parameters for MIXED task: per-type operation pools plus the interleaved stream.
+ */
+template<typename SystemId>
+struct MixedParameters : public WorkloadParameters {
+    std::string label;
+    std::string direction;
+    int addVertexCount = 0;
+    std::vector<std::pair<SystemId, SystemId>> addEdgePairs;     // Pre-converted system IDs
+    std::vector<SystemId> removeVertexIds;                        // Pre-converted system IDs
+    std::vector<std::pair<SystemId, SystemId>> removeEdgePairs;  // Pre-converted system IDs
+    std::vector<SystemId> getNbrsIds;                             // Pre-converted system IDs
+    std::vector<MixedOp> ops;  // Interleaved operation stream
+    int originalCount = 0;
+};
+
+/**
+ * Vertex update structure for property operations.
+ * All properties of one update are written to the same vertex in one operation.
+ */
+template<typename SystemId>
+struct VertexUpdate {
+    SystemId systemId;
+    std::map<std::string, std::any> properties;
+};
+
+/**
+ * Edge update structure for property operations.
+ */
+template<typename SystemId>
+struct EdgeUpdate {
+    SystemId srcSystemId;
+    SystemId dstSystemId;
+    std::map<std::string, std::any> properties;
+};
+
+/**
+ * Property query structure.
+ */
+struct PropertyQuery {
+    std::string key;
+    std::any value;
+};
+
 /**
  * Parameters for UPDATE_VERTEX_PROPERTY task.
  */
+template<typename SystemId>
 struct UpdateVertexPropertyParameters : public WorkloadParameters {
-    struct Update {
-        std::any vertexId;  // System ID
-        std::map<std::string, std::any> properties;
-    };
-    std::vector<Update> updates;
+    std::vector<VertexUpdate<SystemId>> updates;  // Pre-converted system IDs, typed values
+    int originalCount = 0;
 };
 
 /**
  * Parameters for UPDATE_EDGE_PROPERTY task.
  */
+template<typename SystemId>
 struct UpdateEdgePropertyParameters : public WorkloadParameters {
-    struct Update {
-        std::any srcId;  // System ID
-        std::any dstId;  // System ID
-        std::string label;
-        std::map<std::string, std::any> properties;
-    };
-    std::vector<Update> updates;
+    std::string label;
+    std::vector<EdgeUpdate<SystemId>> updates;  // Pre-converted system IDs, typed values
+    int originalCount = 0;
 };
 
 /**
  * Parameters for GET_VERTEX_BY_PROPERTY task.
  */
 struct GetVertexByPropertyParameters : public WorkloadParameters {
-    struct Query {
-        std::string propertyName;
-        std::any propertyValue;
-    };
-    std::vector<Query> queries;
+    std::vector<PropertyQuery> queries;  // Typed values
+    int originalCount = 0;
 };
 
 /**
  * Parameters for GET_EDGE_BY_PROPERTY task.
  */
 struct GetEdgeByPropertyParameters : public WorkloadParameters {
-    struct Query {
-        std::string propertyName;
-        std::any propertyValue;
-    };
-    std::vector<Query> queries;
+    std::vector<PropertyQuery> queries;  // Typed values
+    int originalCount = 0;
 };
 
 } // namespace graphbench
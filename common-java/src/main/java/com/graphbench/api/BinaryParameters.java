@@ -0,0 +1,84 @@
+package com.graphbench.api;
+
+import java.io.File;
+import java.io.IOException;
+import java.nio.ByteOrder;
+import java.nio.LongBuffer;
+import java.nio.MappedByteBuffer;
+import java.nio.channels.FileChannel;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.StandardOpenOption;
+import java.util.*;
+
+/**
+ * Reads the binary parameter sidecar of a workload file.
+ * The workload compiler moves large "ids" and "pairs" arrays into a file of little-endian int64 values
+ * (8-byte magic "GBPARAM1", value count, values) and leaves {"$binary": {offset, count, width}} references
+ * in the JSON. The C++ servers parse the mapped values directly; here the references are expanded back
+ * into the lists ParameterParser expects.
+ */
+public class BinaryParameters {
+    private static final byte[] MAGIC = "GBPARAM1".getBytes(StandardCharsets.US_ASCII);
+    private static final int HEADER_SIZE = 16;
+
+    /**
+     * Replace every binary reference in parameters (including nested pools) with its values.
+     */
+    public static void inflate(Map<String, Object> parameters, File parametersFile) throws IOException {
+        try (FileChannel channel = FileChannel.open(parametersFile.toPath(), StandardOpenOption.READ)) {
+            if (channel.size() > Integer.MAX_VALUE) {
+                throw new IOException("Parameter file larger than 2 GB cannot be mapped by the Java backends"
+                        + " (compile with \"parameter_format\": \"json\"): " + parametersFile);
+            }
+            MappedByteBuffer buffer = channel.map(FileChannel.MapMode.READ_ONLY, 0, channel.size());
+            buffer.order(ByteOrder.LITTLE_ENDIAN);
+            byte[] magic = new byte[MAGIC.length];
+            buffer.get(magic);
+            if (!Arrays.equals(magic, MAGIC) || HEADER_SIZE + buffer.getLong() * Long.BYTES != channel.size()) {
+                throw new IOException("Invalid parameter file: " + parametersFile);
+            }
+            inflate(parameters, buffer);
+        }
+    }
+
+    @SuppressWarnings("unchecked")
+    private static void inflate(Map<String, Object> parameters, MappedByteBuffer buffer) throws IOException {
+        for (Map.Entry<String, Object> entry : parameters.entrySet()) {
+            if (!(entry.getValue() instanceof Map)) {
+                continue;
+            }
+            Map<String, Object> value = (Map<String, Object>) entry.getValue();
+            if (!value.containsKey("$binary")) {
+                inflate(value, buffer);
+                continue;
+            }
+            Map<String, Object> reference = (Map<String, Object>) value.get("$binary");
+            // Sidecar offsets are 64-bit; read them whole so a large file is rejected, not truncated
+            long offset = ((Number) reference.get("offset")).longValue();
+            long count = ((Number) reference.get("count")).longValue();
+            long width = reference.containsKey("width") ? ((Number) reference.get("width")).longValue() : 1;
+            if (offset > Integer.MAX_VALUE || count > Integer.MAX_VALUE) {
+                throw new IOException("Binary parameter beyond 2 GB cannot be read by the Java backends"
+                        + " (compile with \"parameter_format\": \"json\"): " + reference);
+            }
+            if (offset < HEADER_SIZE || count < 0 || width < 1 || offset + count * width * Long.BYTES > buffer.capacity()) {
+                throw new IOException("Binary parameter out of range: " + reference);
+            }
+            // Slices lose the byte order of the parent buffer
+            LongBuffer values = buffer.duplicate().position((int) offset).slice().order(ByteOrder.LITTLE_ENDIAN).asLongBuffer();
+
+            List<Object> list = new ArrayList<>((int) count);
+            for (int i = 0; i < count; i++) {
+                if (width == 2) {
+                    Map<String, Object> pair = new HashMap<>();
+                    pair.put("src", values.get(2 * i));
+                    pair.put("dst", values.get(2 * i + 1));
+                    list.add(pair);
+                } else {
+                    list.add(values.get(i));
+                }
+            }
+            entry.setValue(list);
+        }
+    }
+}
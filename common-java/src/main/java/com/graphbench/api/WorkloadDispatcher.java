@@ -21,6 +21,10 @@ public class WorkloadDispatcher {
     private static final Set<String> EDGE_PROPERTY_TASKS = new HashSet<>(Arrays.asList(
         "UPDATE_EDGE_PROPERTY", "GET_EDGE_BY_PROPERTY"
     ));
+    // Multi-hop traversals are only implemented by the C++ backends
+    private static final Set<String> TRAVERSAL_TASKS = new HashSet<>(Arrays.asList(
+        "K_HOP", "BFS", "SHORTEST_PATH"
+    ));
 
     private final BenchmarkExecutor executor;
     private final String datasetPath;
@@ -144,6 +148,9 @@ public class WorkloadDispatcher {
             WorkloadTask task = gson.fromJson(new FileReader(workloadFile), WorkloadTask.class);
             String taskType = task.getTaskType();
             Map<String, Object> parameters = task.getParameters();
+            if (task.getParametersFile() != null && parameters != null) {
+                BinaryParameters.inflate(parameters, new File(workloadFile.getParentFile(), task.getParametersFile()));
+            }
 
             result.put("task_type", taskType);
             result.put("ops_count", task.getOpsCount());
@@ -194,6 +201,14 @@ public class WorkloadDispatcher {
                     throw new RuntimeException("csvMetadata is null: LOAD_GRAPH must run before any other task");
                 }
 
+                if (TRAVERSAL_TASKS.contains(taskType)) {
+                    String reason = taskType + " is not implemented by the Java backends";
+                    progressCallback.sendLogMessage("Skipping " + taskType + ": " + reason, "INFO");
+                    result.put("status", "unexecute");
+                    result.put("skip_reason", reason);
+                    return result;
+                }
+
                 boolean isVertexPropTask = VERTEX_PROPERTY_TASKS.contains(taskType);
                 boolean isEdgePropTask   = EDGE_PROPERTY_TASKS.contains(taskType);
                 boolean hasVertexProps   = csvMetadata.getNodePropertyHeaders().length > 0;
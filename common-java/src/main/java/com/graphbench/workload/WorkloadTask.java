@@ -19,6 +19,9 @@ public class WorkloadTask {
 
     private Map<String, Object> parameters;
 
+    @SerializedName("parameters_file")
+    private String parametersFile;
+
     public String getTaskType() {
         return taskType;
     }
@@ -50,4 +53,12 @@ public class WorkloadTask {
     public void setParameters(Map<String, Object> parameters) {
         this.parameters = parameters;
     }
+
+    public String getParametersFile() {
+        return parametersFile;
+    }
+
+    public void setParametersFile(String parametersFile) {
+        this.parametersFile = parametersFile;
+    }
 }
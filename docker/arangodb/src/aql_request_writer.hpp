@@ -0,0 +1,230 @@
+#pragma once
+
+#include <graphbench/number_format.hpp>
+#include <any>
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace graphbench {
+
+/**
+ * Append prefix + value to out as a quoted JSON string.
+ */
+inline void appendJsonString(std::string& out, std::string_view value, std::string_view prefix = {}) {
+    static const char* hex = "0123456789abcdef";
+    out.push_back('"');
+    for (std::string_view part : {prefix, value}) {
+        for (char c : part) {
+            unsigned char u = static_cast<unsigned char>(c);
+            if (c == '"' || c == '\\') {
+                out.push_back('\\');
+                out.push_back(c);
+            } else if (u < 0x20) {
+                out.append("\\u00");
+                out.push_back(hex[u >> 4]);
+                out.push_back(hex[u & 0xF]);
+            } else {
+                out.push_back(c);
+            }
+        }
+    }
+    out.push_back('"');
+}
+
+/**
+ * Cursor batch size sent with every request of AqlRequestWriter, so a benchmark
+ * query returns all its results in the first response instead of the server's
+ * default batch of 1000 (VelocyPack responses are not decoded, so their hasMore
+ * could not be followed).
+ */
+constexpr size_t AQL_CURSOR_BATCH_SIZE = size_t{1} << 30;
+
+/**
+ * Writes an AQL cursor request body ({"query": ..., "bindVars": {...}, "batchSize": ...}) directly
+ * into a caller-owned buffer, without building an nlohmann::json DOM first.
+ * The buffer is cleared but keeps its capacity, so a buffer reused across batches
+ * stops allocating once it has grown to the largest request.
+ *
+ * Usage:
+ *   AqlRequestWriter writer(buffer);
+ *   writer.beginRequest(query).beginArray("keys");
+ *   for (...) writer.element(key);
+ *   writer.endArray();
+ *   client->executeAQLCounted(writer.finish());
+ */
+class AqlRequestWriter {
+public:
+    explicit AqlRequestWriter(std::string& buffer) : out_(buffer) {
+        out_.clear();
+    }
+
+    /**
+     * Start the request with the query string; bind variables follow.
+     */
+    AqlRequestWriter& beginRequest(std::string_view query) {
+        out_.append("{\"query\":");
+        appendString(query);
+        out_.append(",\"bindVars\":{");
+        first_.assign(1, true);
+        return *this;
+    }
+
+    /** Bind variable holding an array: "name":[ */
+    AqlRequestWriter& beginArray(std::string_view bindVar) {
+        appendKey(bindVar);
+        out_.push_back('[');
+        first_.push_back(true);
+        return *this;
+    }
+
+    AqlRequestWriter& endArray() {
+        out_.push_back(']');
+        first_.pop_back();
+        return *this;
+    }
+
+    /** Object element of the current array */
+    AqlRequestWriter& beginObject() {
+        separator();
+        out_.push_back('{');
+        first_.push_back(true);
+        return *this;
+    }
+
+    /** Field of the current object or bind variable holding an object: "name":{ */
+    AqlRequestWriter& beginObject(std::string_view name) {
+        appendKey(name);
+        out_.push_back('{');
+        first_.push_back(true);
+        return *this;
+    }
+
+    AqlRequestWriter& endObject() {
+        out_.push_back('}');
+        first_.pop_back();
+        return *this;
+    }
+
+    /** String element of the current array, written as prefix + value */
+    AqlRequestWriter& element(std::string_view value, std::string_view prefix = {}) {
+        separator();
+        appendString(value, prefix);
+        return *this;
+    }
+
+    /** String field of the current object or bind variable, written as prefix + value */
+    AqlRequestWriter& field(std::string_view name, std::string_view value, std::string_view prefix = {}) {
+        appendKey(name);
+        appendString(value, prefix);
+        return *this;
+    }
+
+    /** Integer field */
+    AqlRequestWriter& intField(std::string_view name, int64_t value) {
+        appendKey(name);
+        appendNumber(value);
+        return *this;
+    }
+
+    /** Floating-point field, shortest round-trip form; NaN and infinity are written as null like nlohmann::json */
+    AqlRequestWriter& doubleField(std::string_view name, double value) {
+        appendKey(name);
+        appendNumber(value);
+        return *this;
+    }
+
+    AqlRequestWriter& boolField(std::string_view name, bool value) {
+        appendKey(name);
+        out_.append(value ? "true" : "false");
+        return *this;
+    }
+
+    AqlRequestWriter& nullField(std::string_view name) {
+        appendKey(name);
+        out_.append("null");
+        return *this;
+    }
+
+    /**
+     * Field holding a property value as produced by TypeConverter (std::string, int,
+     * int64_t, float, double or bool); an empty or other value is written as null.
+     */
+    AqlRequestWriter& anyField(std::string_view name, const std::any& value) {
+        if (const auto* text = std::any_cast<std::string>(&value)) {
+            return field(name, *text);
+        }
+        appendKey(name);
+        if (const auto* number = std::any_cast<int>(&value)) {
+            appendNumber(static_cast<int64_t>(*number));
+        } else if (const auto* number = std::any_cast<int64_t>(&value)) {
+            appendNumber(*number);
+        } else if (const auto* number = std::any_cast<float>(&value)) {
+            appendNumber(*number);
+        } else if (const auto* number = std::any_cast<double>(&value)) {
+            appendNumber(*number);
+        } else if (const auto* flag = std::any_cast<bool>(&value)) {
+            out_.append(*flag ? "true" : "false");
+        } else if (const auto* text = std::any_cast<const char*>(&value)) {
+            appendString(*text);
+        } else {
+            out_.append("null");
+        }
+        return *this;
+    }
+
+    /**
+     * Close bindVars, add the cursor batch size and close the request; returns the complete body.
+     */
+    const std::string& finish() {
+        out_.append("},\"batchSize\":");
+        out_.append(std::to_string(AQL_CURSOR_BATCH_SIZE));
+        out_.push_back('}');
+        first_.clear();
+        return out_;
+    }
+
+private:
+    std::string& out_;
+    std::vector<bool> first_;  // Per open container: no element written yet
+
+    void separator() {
+        if (!first_.back()) {
+            out_.push_back(',');
+        }
+        first_.back() = false;
+    }
+
+    void appendKey(std::string_view name) {
+        separator();
+        appendString(name);
+        out_.push_back(':');
+    }
+
+    void appendString(std::string_view value, std::string_view prefix = {}) {
+        appendJsonString(out_, value, prefix);
+    }
+
+    void appendNumber(int64_t value) {
+        char buffer[32];
+        out_.append(buffer, std::to_chars(buffer, buffer + sizeof(buffer), value).ptr - buffer);
+    }
+
+    template<typename Floating>
+    void appendNumber(Floating value) {
+        static_assert(std::is_floating_point_v<Floating>, "appendNumber takes int64_t, float or double");
+        if (!std::isfinite(value)) {
+            out_.append("null");
+            return;
+        }
+        char buffer[SHORTEST_FORMAT_BYTES];
+        out_.append(buffer, formatShortest(buffer, value));
+    }
+};
+
+} // namespace graphbench
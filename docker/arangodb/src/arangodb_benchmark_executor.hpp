@@ -1,38 +1,56 @@
 #pragma once
 
 #include "arangodb_client.hpp"
+#include "aql_request_writer.hpp"
 #include "arangodb_graph_loader.hpp"
+#include "arangodb_undo_log.hpp"
 #include <graphbench/benchmark_executor.hpp>
 #include <graphbench/progress_callback.hpp>
 #include <graphbench/benchmark_utils.hpp>
-#include <graphbench/node_id_mapping.hpp>
+#include <graphbench/string_key_mapping.hpp>
+#include <graphbench/latency_histogram.hpp>
+#include <graphbench/cycle_clock.hpp>
+#include <graphbench/traversal.hpp>
 #include <nlohmann/json.hpp>
 #include <map>
 #include <string>
 #include <vector>
 #include <memory>
+#include <optional>
+#include <atomic>
 #include <chrono>
-#include <random>
 
 namespace graphbench {
 
 using json = nlohmann::json;
 
+/**
+ * System ID of an ArangoDB vertex: a handle to its document key in the executor's
+ * StringKeyMapping (*id yields the key). Loaded keys are "v" + origin ID, so by
+ * default they are computed on use instead of stored per node.
+ */
+using ArangoDBSystemId = StringKey;
+
 /**
  * ArangoDB structural benchmark executor using REST API.
  * Implements graph structural operations (add/remove vertices/edges, get neighbors).
  * Uses CRTP pattern for zero-overhead abstraction.
  */
-class ArangoDBBenchmarkExecutor : public BenchmarkExecutor<ArangoDBBenchmarkExecutor> {
+class ArangoDBBenchmarkExecutor : public BenchmarkExecutor<ArangoDBBenchmarkExecutor, ArangoDBSystemId> {
 public:
     ArangoDBBenchmarkExecutor()
         : dbPath_(DB_PATH),
           snapshotPath_(SNAPSHOT_PATH),
-          errorCount_(0) {
+          errorCount_(0),
+          preSerialize_(flagFromEnv("PRE_SERIALIZE")),
+          engineStats_(flagFromEnv("ENGINE_STATS")) {
         std::string callbackUrl = BenchmarkUtils::getEnv("PROGRESS_CALLBACK_URL", "");
         progressCallback_ = std::make_shared<ProgressCallback>(callbackUrl);
     }
 
+    // Registered executors are owned through this type, including the property executor
+    virtual ~ArangoDBBenchmarkExecutor() = default;
+
     /**
      * Initialize database: create connection, database, and collections.
      */
@@ -40,7 +58,7 @@ public:
         BenchmarkUtils::checkAndCleanDatabaseDirectory(dbPath_);
 
         // Create ArangoDB utility instance
-        arangoUtils_ = std::make_shared<ArangoDBClient>("localhost", 8529, "root", "");
+        arangoUtils_ = makeClient();
 
         // Create database
         try {
@@ -86,87 +104,117 @@ public:
      * Open database connection (after snapshot/restore operations).
      */
     void openDatabaseImpl() {
-        arangoUtils_ = std::make_shared<ArangoDBClient>("localhost", 8529, "root", "");
+        arangoUtils_ = makeClient();
         arangoUtils_->useDatabase(DB_NAME);
     }
 
     /**
      * Load graph from CSV files (structural benchmark: no properties).
      * Uses ArangoDBGraphLoader to batch-load nodes and edges.
+     * Virtual (like getDatabaseNameImpl) so the property executor, which is
+     * dispatched through this type, loads properties and indexes instead.
      */
-    std::map<std::string, std::any> loadGraphImpl(const std::string& datasetPath) {
+    virtual std::map<std::string, std::any> loadGraphImpl(const std::string& datasetPath) {
         ArangoDBGraphLoader loader(arangoUtils_, DB_NAME, progressCallback_, false);
         auto result = loader.load(datasetPath);
-        nodeIdMapping_ = std::make_unique<NodeIdMapping<std::string>>(loader.getNodeIdMapping());
+        nodeIdMapping_ = loader.releaseNodeIdMapping();
         return result;
     }
 
+    /**
+     * Snapshot the loaded graph server side; see ArangoDBUndoLog.
+     */
+    RestoreStats snapGraphImpl() {
+        return undoLog_.snapshot(*arangoUtils_, DB_NAME);
+    }
+
+    /**
+     * Revert the changes logged since the snapshot or the last restore.
+     */
+    RestoreStats restoreGraphImpl() {
+        RestoreStats stats = undoLog_.revert(*arangoUtils_);
+        progressCallback_->sendLogMessage(
+            "Database restored from undo log (" + std::to_string(stats.itemsReverted) + " documents, " +
+            std::to_string(stats.seconds) + "s)",
+            "INFO");
+        return stats;
+    }
+
     /**
      * Add vertices in batches.
-     * Uses batch AQL INSERT to add multiple vertices in one query.
+     * Uses batch AQL INSERT to add multiple vertices in one query. Keys come from
+     * the undo log's counter, so a restore can remove them by range.
      */
     std::vector<double> addVertexImpl(int count, int batchSize) {
-        std::random_device rd;
-        std::mt19937 gen(rd());
-
-        return executeBatchOperation(count, batchSize, [this, &gen](int batchCount) {
-            // Build batch of vertex documents
-            json docs = json::array();
-            for (int i = 0; i < batchCount; i++) {
-                docs.push_back({
-                    {"_key", "new_v" + std::to_string(gen())}
-                });
-            }
-
-            // Single batch INSERT query
-            std::string query = "FOR doc IN @docs INSERT doc INTO " + std::string(VERTEX_COLLECTION);
-            json bindVars = {{"docs", docs}};
-            arangoUtils_->executeAQL(query, bindVars);
-        });
+        const std::string query = "FOR doc IN @docs INSERT doc INTO " + std::string(VERTEX_COLLECTION);
+
+        return executeRequestBatches(count, batchSize,
+            [this, &query](std::string& body, int batchCount) {
+                // Single batch INSERT query with the vertex documents as bind variable
+                uint64_t firstKey = undoLog_.reserveVertexKeys(static_cast<uint64_t>(batchCount));
+                AqlRequestWriter writer(body);
+                writer.beginRequest(query).beginArray("docs");
+                for (int i = 0; i < batchCount; i++) {
+                    writer.beginObject()
+                          .field("_key", std::to_string(firstKey + i), ArangoDBUndoLog::VERTEX_KEY_PREFIX)
+                          .endObject();
+                }
+                writer.endArray().finish();
+            },
+            [this](const std::string& body, int) {
+                arangoUtils_->executeAQLCounted(body);
+            });
     }
 
     /**
      * Remove vertices in batches.
      * Uses batch AQL REMOVE to delete multiple vertices in one query.
      */
-    std::vector<double> removeVertexImpl(const std::vector<std::any>& systemIds, int batchSize) {
-        return executeBatchOperation(systemIds, batchSize, [this](const std::vector<std::any>& batch) {
-            // Build array of vertex keys
-            json keys = json::array();
-            for (const auto& id : batch) {
-                keys.push_back(std::any_cast<std::string>(id));
-            }
-
-            // Single batch REMOVE query
-            std::string query = "FOR key IN @keys REMOVE key IN " + std::string(VERTEX_COLLECTION);
-            json bindVars = {{"keys", keys}};
-            arangoUtils_->executeAQL(query, bindVars);
-        });
+    std::vector<double> removeVertexImpl(BatchView<ArangoDBSystemId> systemIds, int batchSize) {
+        const std::string query = "FOR key IN @keys REMOVE key IN " + std::string(VERTEX_COLLECTION);
+        undoLog_.touchVertices(systemIds, [](ArangoDBSystemId id) { return id; });
+
+        return executeRequestBatches(systemIds, batchSize,
+            [&query](std::string& body, BatchView<ArangoDBSystemId> batch) {
+                // Single batch REMOVE query with the vertex keys as bind variable
+                AqlRequestWriter writer(body);
+                writer.beginRequest(query).beginArray("keys");
+                for (ArangoDBSystemId id : batch) {
+                    writer.element(*id);
+                }
+                writer.endArray().finish();
+            },
+            countedRequest());
     }
 
     /**
      * Add edges in batches.
-     * Uses batch AQL INSERT to add multiple edges in one query.
+     * Uses batch AQL INSERT to add multiple edges in one query, with keys from the
+     * undo log's counter.
      */
     std::vector<double> addEdgeImpl(const std::string& label,
-                                    const std::vector<std::pair<std::any, std::any>>& pairs,
+                                    BatchView<std::pair<ArangoDBSystemId, ArangoDBSystemId>> pairs,
                                     int batchSize) {
-        return executeBatchOperation(pairs, batchSize, [this, &label](const std::vector<std::pair<std::any, std::any>>& batch) {
-            // Build batch of edge documents
-            json docs = json::array();
-            for (const auto& [src, dst] : batch) {
-                docs.push_back({
-                    {"_from", std::string(VERTEX_COLLECTION) + "/" + std::any_cast<std::string>(src)},
-                    {"_to", std::string(VERTEX_COLLECTION) + "/" + std::any_cast<std::string>(dst)},
-                    {"label", label}
-                });
-            }
-
-            // Single batch INSERT query
-            std::string query = "FOR doc IN @docs INSERT doc INTO " + std::string(EDGE_COLLECTION);
-            json bindVars = {{"docs", docs}};
-            arangoUtils_->executeAQL(query, bindVars);
-        });
+        const std::string query = "FOR doc IN @docs INSERT doc INTO " + std::string(EDGE_COLLECTION);
+        const std::string vertexPrefix = std::string(VERTEX_COLLECTION) + "/";
+
+        return executeRequestBatches(pairs, batchSize,
+            [&](std::string& body, BatchView<std::pair<ArangoDBSystemId, ArangoDBSystemId>> batch) {
+                // Single batch INSERT query with the edge documents as bind variable
+                uint64_t key = undoLog_.reserveEdgeKeys(batch.size());
+                AqlRequestWriter writer(body);
+                writer.beginRequest(query).beginArray("docs");
+                for (const auto& [src, dst] : batch) {
+                    writer.beginObject()
+                          .field("_key", std::to_string(key++), ArangoDBUndoLog::EDGE_KEY_PREFIX)
+                          .field("_from", *src, vertexPrefix)
+                          .field("_to", *dst, vertexPrefix)
+                          .field("label", label)
+                          .endObject();
+                }
+                writer.endArray().finish();
+            },
+            countedRequest());
     }
 
     /**
@@ -174,27 +222,31 @@ public:
      * Uses batch AQL to find and remove multiple edges in one query.
      */
     std::vector<double> removeEdgeImpl(const std::string& label,
-                                       const std::vector<std::pair<std::any, std::any>>& pairs,
+                                       BatchView<std::pair<ArangoDBSystemId, ArangoDBSystemId>> pairs,
                                        int batchSize) {
-        return executeBatchOperation(pairs, batchSize, [this, &label](const std::vector<std::pair<std::any, std::any>>& batch) {
-            // Build array of edge specifications
-            json edgeSpecs = json::array();
-            for (const auto& [src, dst] : batch) {
-                edgeSpecs.push_back({
-                    {"from", std::string(VERTEX_COLLECTION) + "/" + std::any_cast<std::string>(src)},
-                    {"to", std::string(VERTEX_COLLECTION) + "/" + std::any_cast<std::string>(dst)}
-                });
-            }
-
-            // Single batch REMOVE query using FOR loop
-            std::string query =
-                "FOR spec IN @specs "
-                "  FOR e IN " + std::string(EDGE_COLLECTION) + " "
-                "    FILTER e._from == spec.from AND e._to == spec.to AND e.label == @label "
-                "    REMOVE e IN " + std::string(EDGE_COLLECTION);
-            json bindVars = {{"specs", edgeSpecs}, {"label", label}};
-            arangoUtils_->executeAQL(query, bindVars);
-        });
+        // Single batch REMOVE query using FOR loop
+        const std::string query =
+            "FOR spec IN @specs "
+            "  FOR e IN " + std::string(EDGE_COLLECTION) + " "
+            "    FILTER e._from == spec.from AND e._to == spec.to AND e.label == @label "
+            "    REMOVE e IN " + std::string(EDGE_COLLECTION);
+        const std::string vertexPrefix = std::string(VERTEX_COLLECTION) + "/";
+        undoLog_.touchEdges(label, pairs, [](const auto& pair) { return pair; });
+
+        return executeRequestBatches(pairs, batchSize,
+            [&](std::string& body, BatchView<std::pair<ArangoDBSystemId, ArangoDBSystemId>> batch) {
+                // Edge specifications and label as bind variables
+                AqlRequestWriter writer(body);
+                writer.beginRequest(query).beginArray("specs");
+                for (const auto& [src, dst] : batch) {
+                    writer.beginObject()
+                          .field("from", *src, vertexPrefix)
+                          .field("to", *dst, vertexPrefix)
+                          .endObject();
+                }
+                writer.endArray().field("label", label).finish();
+            },
+            countedRequest());
     }
 
     /**
@@ -202,57 +254,133 @@ public:
      * Uses AQL graph traversal to find neighbors.
      */
     std::vector<double> getNbrsImpl(const std::string& direction,
-                                    const std::vector<std::any>& systemIds,
+                                    BatchView<ArangoDBSystemId> systemIds,
                                     int batchSize) {
-        return executeBatchOperation(systemIds, batchSize, [this, &direction](const std::vector<std::any>& batch) {
-            // Build array of vertex IDs
-            json vertexIds = json::array();
-            for (const auto& id : batch) {
-                vertexIds.push_back(std::string(VERTEX_COLLECTION) + "/" + std::any_cast<std::string>(id));
-            }
+        const std::string traversalDir = traversalDirection(direction);
+
+        // Single batch traversal query
+        const std::string query =
+            "FOR vid IN @vids "
+            "  FOR v IN 1..1 " + traversalDir + " vid " + std::string(EDGE_COLLECTION) + " "
+            "    RETURN v";
+
+        return executeRequestBatches(systemIds, batchSize, VertexListRequest{query, "vids"},
+            [this](const std::string& body, BatchView<ArangoDBSystemId>) {
+                // Neighbors are counted by the SAX scan, never materialized
+                AqlResultSummary summary = arangoUtils_->executeAQLCounted(body);
+
+                // Prevent dead code elimination of query result
+                asm volatile("" : : "r,m"(summary.results) : "memory");
+            });
+    }
 
-            // Determine traversal direction
-            std::string traversalDir;
-            if (direction == "OUT" || direction == "OUTGOING") {
-                traversalDir = "OUTBOUND";
-            } else if (direction == "IN" || direction == "INCOMING") {
-                traversalDir = "INBOUND";
-            } else {
-                traversalDir = "ANY";
-            }
+    /**
+     * Count the vertices within depth hops of each start vertex.
+     * One native AQL traversal per start vertex, all in one query; the server sums
+     * the counts so only one number comes back per batch.
+     */
+    std::vector<double> kHopImpl(const std::string& direction, int depth,
+                                 BatchView<ArangoDBSystemId> systemIds,
+                                 int batchSize) {
+        return executeTraversal(direction, depth, systemIds, batchSize);
+    }
 
-            // Single batch traversal query
-            std::string query =
-                "FOR vid IN @vids "
-                "  FOR v IN 1..1 " + traversalDir + " vid " + std::string(EDGE_COLLECTION) + " "
-                "    RETURN v";
-            json bindVars = {{"vids", vertexIds}};
-            json result = arangoUtils_->executeAQL(query, bindVars);
+    /**
+     * Breadth-first reachability from each start vertex (maxDepth 0 = unbounded).
+     */
+    std::vector<double> bfsImpl(const std::string& direction, int maxDepth,
+                                BatchView<ArangoDBSystemId> systemIds,
+                                int batchSize) {
+        return executeTraversal(direction, maxDepth > 0 ? maxDepth : UNBOUNDED_TRAVERSAL_DEPTH, systemIds, batchSize);
+    }
 
-            // Prevent dead code elimination of query result
-            asm volatile("" : : "r,m"(result) : "memory");
-        });
+    /**
+     * Unweighted shortest paths with AQL SHORTEST_PATH, one per pair, in one query per batch.
+     * AQL takes no depth bound for SHORTEST_PATH, so maxDepth only filters the found paths;
+     * the server does not report how many vertices the search visited.
+     */
+    std::vector<double> shortestPathImpl(const std::string& direction, int maxDepth,
+                                         BatchView<std::pair<ArangoDBSystemId, ArangoDBSystemId>> pairs,
+                                         int batchSize) {
+        std::string hopFilter = maxDepth > 0 ? " AND n - 1 <= " + std::to_string(maxDepth) : "";
+        const std::string query =
+            "LET lengths = (FOR spec IN @specs "
+            "  RETURN LENGTH(FOR v IN " + traversalDirection(direction) + " SHORTEST_PATH spec.from TO spec.to " +
+                std::string(EDGE_COLLECTION) + " RETURN 1)) "
+            "LET hops = (FOR n IN lengths FILTER n > 0" + hopFilter + " RETURN n - 1) "
+            "RETURN [LENGTH(hops), SUM(hops)]";
+        const std::string vertexPrefix = std::string(VERTEX_COLLECTION) + "/";
+
+        return executeRequestBatches(pairs, batchSize,
+            [&](std::string& body, BatchView<std::pair<ArangoDBSystemId, ArangoDBSystemId>> batch) {
+                AqlRequestWriter writer(body);
+                writer.beginRequest(query).beginArray("specs");
+                for (const auto& [src, dst] : batch) {
+                    writer.beginObject()
+                          .field("from", *src, vertexPrefix)
+                          .field("to", *dst, vertexPrefix)
+                          .endObject();
+                }
+                writer.endArray().finish();
+            },
+            [this](const std::string& body, BatchView<std::pair<ArangoDBSystemId, ArangoDBSystemId>> batch) {
+                json result = arangoUtils_->executeAQLResults(body);
+                if (!result.empty() && result[0].is_array() && result[0].size() == 2) {
+                    TraversalRecorder::recordPaths(batch.size(), result[0][0].get<uint64_t>(), result[0][1].get<uint64_t>());
+                }
+            });
     }
 
-    std::string getDatabaseNameImpl() const { return "arangodb"; }
+    virtual std::string getDatabaseNameImpl() const { return "arangodb"; }
     std::string getDatabasePathImpl() const { return dbPath_; }
     std::string getSnapshotPathImpl() const { return snapshotPath_; }
 
+    /**
+     * Counters of arangod's /_admin/metrics/v2 (ENGINE_STATS=on). A server that
+     * refuses the metrics API reports none, after one warning.
+     */
+    EngineCounters engineStatsImpl() {
+        if (!engineStats_ || !arangoUtils_) {
+            return {};
+        }
+        try {
+            return EngineStats::parsePrometheusCounters(arangoUtils_->fetchText("/_admin/metrics/v2"));
+        } catch (const std::exception& e) {
+            progressCallback_->sendLogMessage("Server metrics unavailable: " + std::string(e.what()), "WARN");
+            engineStats_ = false;
+            return {};
+        }
+    }
+
+    /**
+     * Load the indexes of both collections into memory (loadIndexesIntoMemory):
+     * the primary index of the vertices and the edge index the traversals use.
+     * arangod offers no call to empty its block cache, so resetEngineCache() keeps
+     * the default and a cold run only drops the OS page cache.
+     */
+    bool prewarmCacheImpl() {
+        for (const char* collection : {VERTEX_COLLECTION, EDGE_COLLECTION}) {
+            arangoUtils_->executeRequest("PUT", "/_db/" + std::string(DB_NAME) + "/_api/collection/" +
+                                         collection + "/loadIndexesIntoMemory");
+        }
+        return true;
+    }
+
     int getErrorCountImpl() const { return errorCount_; }
     void resetErrorCountImpl() { errorCount_ = 0; }
 
     /**
-     * Get system ID (ArangoDB document key) from origin ID.
+     * Get system ID (handle to the ArangoDB document key) from origin ID.
      */
-    std::any getSystemIdImpl(int64_t originId) const {
+    std::optional<ArangoDBSystemId> getSystemIdImpl(int64_t originId) const {
         if (nodeIdMapping_) {
             bool found = false;
-            auto result = nodeIdMapping_->get_or_default(originId, &found);
+            ArangoDBSystemId systemId = nodeIdMapping_->get_or_default(originId, &found);
             if (found) {
-                return result;
+                return systemId;
             }
         }
-        return std::any();
+        return std::nullopt;
     }
 
     /**
@@ -268,31 +396,177 @@ protected:
     static constexpr const char* DB_NAME = "benchmark";
     static constexpr const char* VERTEX_COLLECTION = "vertices";
     static constexpr const char* EDGE_COLLECTION = "edges";
+    // AQL traversals need an upper depth; global vertex uniqueness ends them at the frontier anyway
+    static constexpr int UNBOUNDED_TRAVERSAL_DEPTH = 1000000;
 
     std::string dbPath_;
     std::string snapshotPath_;
     std::shared_ptr<ArangoDBClient> arangoUtils_;
     std::shared_ptr<ProgressCallback> progressCallback_;
-    std::unique_ptr<NodeIdMapping<std::string>> nodeIdMapping_;
-    int errorCount_;
+    std::unique_ptr<StringKeyMapping> nodeIdMapping_;
+    std::atomic<int> errorCount_;  // Shared by concurrent client threads
+    bool preSerialize_;            // Render all request bodies of a call before timing it
+    bool engineStats_;             // ENGINE_STATS: report server metrics per batch size
+    ArangoDBUndoLog undoLog_{VERTEX_COLLECTION, EDGE_COLLECTION};  // Changes since the snapshot
+
+    /**
+     * Create the REST client; ARANGODB_UNIX_SOCKET selects the Unix domain socket transport,
+     * ARANGODB_RESPONSE_FORMAT=velocypack requests VelocyPack responses for benchmark operations.
+     */
+    static std::shared_ptr<ArangoDBClient> makeClient() {
+        auto client = std::make_shared<ArangoDBClient>("localhost", 8529, "root", "",
+                                                       BenchmarkUtils::getEnv("ARANGODB_UNIX_SOCKET", ""));
+        client->setVelocyPackResponses(BenchmarkUtils::getEnv("ARANGODB_RESPONSE_FORMAT", "json") == "velocypack");
+        return client;
+    }
+
+    /** AQL traversal direction for a workload direction (OUT, IN, BOTH) */
+    static std::string traversalDirection(const std::string& direction) {
+        if (direction == "OUT" || direction == "OUTGOING") {
+            return "OUTBOUND";
+        }
+        if (direction == "IN" || direction == "INCOMING") {
+            return "INBOUND";
+        }
+        return "ANY";
+    }
+
+    /**
+     * K_HOP / BFS: breadth-first traversal up to depth hops from every start vertex of
+     * a batch, visiting each vertex once (uniqueVertices "global"), counted server side.
+     */
+    std::vector<double> executeTraversal(const std::string& direction, int depth,
+                                         BatchView<ArangoDBSystemId> systemIds,
+                                         int batchSize) {
+        const std::string query =
+            "RETURN SUM(FOR vid IN @vids "
+            "  RETURN LENGTH(FOR v IN 1.." + std::to_string(depth) + " " + traversalDirection(direction) + " vid " +
+                std::string(EDGE_COLLECTION) + " OPTIONS {order: \"bfs\", uniqueVertices: \"global\"} RETURN 1))";
+
+        return executeRequestBatches(systemIds, batchSize, VertexListRequest{query, "vids"},
+            [this](const std::string& body, BatchView<ArangoDBSystemId> batch) {
+                json result = arangoUtils_->executeAQLResults(body);
+                if (!result.empty() && result[0].is_number()) {
+                    TraversalRecorder::recordBatch(batch.size(), result[0].get<uint64_t>());
+                }
+            });
+    }
+
+    /**
+     * Per-thread buffer for request bodies written with AqlRequestWriter.
+     */
+    static std::string& requestBuffer() {
+        thread_local std::string buffer;
+        return buffer;
+    }
+
+    /** PRE_SERIALIZE=on renders request bodies outside the timed region */
+    static bool flagFromEnv(const char* name) {
+        std::string value = BenchmarkUtils::getEnv(name, "off");
+        return value == "on" || value == "true" || value == "1";
+    }
+
+    /** Request renderer binding the batch's vertex IDs as an array of document handles */
+    struct VertexListRequest {
+        const std::string& query;
+        const char* bindVar;
+
+        void operator()(std::string& body, BatchView<ArangoDBSystemId> batch) const {
+            static const std::string vertexPrefix = std::string(VERTEX_COLLECTION) + "/";
+            AqlRequestWriter writer(body);
+            writer.beginRequest(query).beginArray(bindVar);
+            for (ArangoDBSystemId id : batch) {
+                writer.element(*id, vertexPrefix);
+            }
+            writer.endArray().finish();
+        }
+    };
+
+    /** Request sender that only counts the results */
+    struct CountedRequest {
+        ArangoDBClient* client;
+
+        template<typename Batch>
+        void operator()(const std::string& body, const Batch&) const {
+            client->executeAQLCounted(body);
+        }
+    };
+
+    CountedRequest countedRequest() const {
+        return CountedRequest{arangoUtils_.get()};
+    }
+
+    /**
+     * Helper: one AQL request per batch (item-based).
+     * render(body, batch) writes the request body and send(body, batch) issues it. By
+     * default each body is rendered into the per-thread buffer inside the timed region,
+     * as a real client would; with PRE_SERIALIZE on, the bodies of all batches of the
+     * call are rendered first, so only send() is measured.
+     */
+    template<typename T, typename Render, typename Send>
+    std::vector<double> executeRequestBatches(BatchView<T> items, int batchSize, Render render, Send send) {
+        if (!preSerialize_) {
+            return executeBatchOperation(items, batchSize, [&](BatchView<T> batch) {
+                std::string& body = requestBuffer();
+                render(body, batch);
+                send(body, batch);
+            });
+        }
+        std::vector<std::string> bodies;
+        bodies.reserve((items.size() + batchSize - 1) / batchSize);
+        for (size_t i = 0; i < items.size(); i += batchSize) {
+            bodies.emplace_back();
+            render(bodies.back(), items.slice(i, batchSize));
+        }
+        size_t next = 0;
+        return executeBatchOperation(items, batchSize, [&](BatchView<T> batch) {
+            send(bodies[next++], batch);
+        });
+    }
+
+    /**
+     * Helper: one AQL request per batch (count-based), rendered as in the item-based helper.
+     */
+    template<typename Render, typename Send>
+    std::vector<double> executeRequestBatches(int count, int batchSize, Render render, Send send) {
+        if (!preSerialize_) {
+            return executeBatchOperation(count, batchSize, [&](int batchCount) {
+                std::string& body = requestBuffer();
+                render(body, batchCount);
+                send(body, batchCount);
+            });
+        }
+        std::vector<std::string> bodies;
+        bodies.reserve((std::max(count, 0) + batchSize - 1) / batchSize);
+        for (int i = 0; i < count; i += batchSize) {
+            bodies.emplace_back();
+            render(bodies.back(), std::min(batchSize, count - i));
+        }
+        size_t next = 0;
+        return executeBatchOperation(count, batchSize, [&](int batchCount) {
+            send(bodies[next++], batchCount);
+        });
+    }
 
     /**
      * Helper: execute operation in batches (count-based).
-     * Measures latency per operation.
+     * Measures latency per operation. A batch is a single request, so its latency is
+     * recorded into the active LatencyRecorder amortized over the ops it carried.
      */
     template<typename Func>
     std::vector<double> executeBatchOperation(int count, int batchSize, Func operation) {
         std::vector<double> latencies;
         for (int i = 0; i < count; i += batchSize) {
             int batchCount = std::min(batchSize, count - i);
-            auto start = std::chrono::high_resolution_clock::now();
+            uint64_t start = CycleClock::now();
             try {
                 operation(batchCount);
             } catch (const std::exception& e) {
                 errorCount_ += batchCount;
             }
-            auto end = std::chrono::high_resolution_clock::now();
-            double latency = std::chrono::duration<double, std::micro>(end - start).count() / batchCount;
+            uint64_t end = CycleClock::now();
+            LatencyRecorder::record(CycleClock::toNs(end - start) / batchCount, batchCount);
+            double latency = CycleClock::toUs(end - start) / batchCount;
             latencies.push_back(latency);
         }
         return latencies;
@@ -300,23 +574,24 @@ protected:
 
     /**
      * Helper: execute operation in batches (item-based).
-     * Measures latency per item.
+     * Each batch is a view into items, never a copy.
+     * Measures latency per item, recorded the same way as the count-based helper.
      */
     template<typename T, typename Func>
-    std::vector<double> executeBatchOperation(const std::vector<T>& items, int batchSize, Func operation) {
+    std::vector<double> executeBatchOperation(BatchView<T> items, int batchSize, Func operation) {
         std::vector<double> latencies;
         for (size_t i = 0; i < items.size(); i += batchSize) {
-            size_t end = std::min(i + batchSize, items.size());
-            std::vector<T> batch(items.begin() + i, items.begin() + end);
+            BatchView<T> batch = items.slice(i, batchSize);
 
-            auto start = std::chrono::high_resolution_clock::now();
+            uint64_t start = CycleClock::now();
             try {
                 operation(batch);
             } catch (const std::exception& e) {
                 errorCount_ += batch.size();
             }
-            auto endTime = std::chrono::high_resolution_clock::now();
-            double latency = std::chrono::duration<double, std::micro>(endTime - start).count() / batch.size();
+            uint64_t endTime = CycleClock::now();
+            LatencyRecorder::record(CycleClock::toNs(endTime - start) / batch.size(), batch.size());
+            double latency = CycleClock::toUs(endTime - start) / batch.size();
             latencies.push_back(latency);
         }
         return latencies;
@@ -0,0 +1,145 @@
+#pragma once
+
+#include "arangodb_client.hpp"
+#include <graphbench/benchmark_utils.hpp>
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace graphbench {
+
+/**
+ * Pipelined bulk import into one ArangoDB collection.
+ *
+ * The loader thread writes documents as JSON lines into the current chunk
+ * (document() / endDocument()); full chunks are queued and POSTed to
+ * /_api/import by IMPORT_CONNECTIONS worker threads, each on its own pooled
+ * connection. The queue holds at most one chunk per connection, so the loader
+ * blocks once that many chunks wait behind the ones in flight, which bounds the
+ * memory of a load to about 2 * connections chunks.
+ *
+ * The first failed import stops the pipeline; it is rethrown by the next
+ * endDocument() or by finish().
+ */
+class ArangoDBBulkImporter {
+public:
+    ArangoDBBulkImporter(ArangoDBClient& client, std::string collection, size_t chunkDocuments)
+        : client_(client), collection_(std::move(collection)), chunkDocuments_(chunkDocuments) {
+        int connections = std::max(1, std::stoi(BenchmarkUtils::getEnv("IMPORT_CONNECTIONS", "4")));
+        for (int i = 0; i < connections; i++) {
+            workers_.emplace_back([this]() { workerLoop(); });
+        }
+    }
+
+    ~ArangoDBBulkImporter() {
+        stopWorkers();
+    }
+
+    ArangoDBBulkImporter(const ArangoDBBulkImporter&) = delete;
+    ArangoDBBulkImporter& operator=(const ArangoDBBulkImporter&) = delete;
+
+    /** Buffer to append the next document to, as one line of JSON */
+    std::string& document() { return chunk_; }
+
+    /** End the document written to document(); queues the chunk once it is full */
+    void endDocument() {
+        chunk_.push_back('\n');
+        if (++chunkCount_ >= chunkDocuments_) {
+            submitChunk();
+        }
+    }
+
+    /**
+     * Import the last partial chunk and wait for all imports to complete.
+     * @return Number of documents created
+     */
+    size_t finish() {
+        if (chunkCount_ > 0) {
+            submitChunk();
+        }
+        stopWorkers();
+        if (error_) {
+            std::rethrow_exception(error_);
+        }
+        return created_;
+    }
+
+private:
+    ArangoDBClient& client_;
+    std::string collection_;
+    size_t chunkDocuments_;
+
+    std::string chunk_;
+    size_t chunkCount_ = 0;
+
+    std::mutex mutex_;
+    std::condition_variable changed_;
+    std::deque<std::string> pending_;
+    std::vector<std::thread> workers_;
+    std::exception_ptr error_;
+    size_t created_ = 0;
+    bool closing_ = false;
+
+    void submitChunk() {
+        std::string chunk;
+        chunk.reserve(chunk_.size());
+        chunk.swap(chunk_);
+        chunkCount_ = 0;
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        changed_.wait(lock, [this]() { return error_ || pending_.size() < workers_.size(); });
+        if (error_) {
+            std::rethrow_exception(error_);
+        }
+        pending_.push_back(std::move(chunk));
+        changed_.notify_all();
+    }
+
+    void stopWorkers() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            closing_ = true;
+        }
+        changed_.notify_all();
+        for (std::thread& worker : workers_) {
+            if (worker.joinable()) {
+                worker.join();
+            }
+        }
+    }
+
+    void workerLoop() {
+        while (true) {
+            std::string chunk;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                changed_.wait(lock, [this]() { return error_ || closing_ || !pending_.empty(); });
+                if (error_ || pending_.empty()) {
+                    return;
+                }
+                chunk = std::move(pending_.front());
+                pending_.pop_front();
+                changed_.notify_all();
+            }
+
+            try {
+                size_t created = client_.importDocuments(collection_, chunk);
+                std::lock_guard<std::mutex> lock(mutex_);
+                created_ += created;
+            } catch (const std::exception&) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (!error_) {
+                    error_ = std::current_exception();
+                }
+                changed_.notify_all();
+            }
+        }
+    }
+};
+
+} // namespace graphbench
@@ -2,24 +2,63 @@
 
 #include <curl/curl.h>
 #include <nlohmann/json.hpp>
+#include "aql_request_writer.hpp"
 #include <string>
 #include <memory>
+#include <mutex>
+#include <vector>
 #include <stdexcept>
 
 namespace graphbench {
 
 using json = nlohmann::json;
 
+/**
+ * Summary of an AQL cursor response that was consumed without building a DOM.
+ */
+struct AqlResultSummary {
+    size_t results = 0;    // Elements of the "result" array (0 for VelocyPack responses, which are not decoded)
+    size_t bytes = 0;      // Size of the response bodies
+    size_t batches = 0;    // Cursor batches fetched (1 unless a result exceeded AQL_CURSOR_BATCH_SIZE)
+};
+
 /**
  * Client class for ArangoDB REST API operations.
  * Provides common functionality for executing HTTP requests to ArangoDB.
+ *
+ * CURL handles are pooled and reused across requests, so the keep-alive connection
+ * cached in each handle survives between calls and benchmark latencies do not include
+ * TCP connection setup. Each request leases one handle, so concurrent client threads
+ * get their own connection. If unixSocketPath is set, requests go through that
+ * Unix domain socket instead of TCP (see --server.endpoint unix://... in arangod).
+ *
+ * executeAQLCounted() is the lean path for benchmark operations: the request body is
+ * pre-serialized (see AqlRequestWriter), the response lands in the connection's reused
+ * buffer and is only scanned by a SAX handler. With VelocyPack responses enabled it
+ * asks arangod for application/x-velocypack and skips decoding entirely.
  */
 class ArangoDBClient {
 private:
+    /**
+     * A pooled CURL handle and its reusable response buffer.
+     */
+    struct Connection {
+        CURL* curl = nullptr;
+        std::string response;
+    };
+
     std::string baseUrl;
     std::string username;
     std::string password;
     std::string currentDatabase;
+    std::string unixSocketPath;
+    bool velocyPackResponses = false;
+    std::string auth;                          // "user:password", set once for all handles
+    struct curl_slist* jsonHeaders = nullptr;  // Shared read-only header lists
+    struct curl_slist* velocyPackHeaders = nullptr;
+
+    std::mutex poolMutex;
+    std::vector<std::unique_ptr<Connection>> idleConnections;
 
     // Callback for libcurl to write response data
     static size_t WriteCallback(void* contents, size_t size, size_t nmemb, std::string* userp) {
@@ -27,62 +66,79 @@ private:
         return size * nmemb;
     }
 
-public:
-    ArangoDBClient(const std::string& host, int port,
-                const std::string& user = "root", const std::string& pass = "")
-        : baseUrl("http://" + host + ":" + std::to_string(port)),
-          username(user), password(pass), currentDatabase("_system") {}
-
     /**
-     * Set the current database context for subsequent operations.
+     * Leases a pooled connection and returns it to the pool when the request is done.
      */
-    void useDatabase(const std::string& dbName) {
-        currentDatabase = dbName;
-    }
+    class ConnectionLease {
+    public:
+        explicit ConnectionLease(ArangoDBClient& client) : client_(client), connection_(client.acquire()) {}
+        ~ConnectionLease() { client_.release(std::move(connection_)); }
+        ConnectionLease(const ConnectionLease&) = delete;
+        ConnectionLease& operator=(const ConnectionLease&) = delete;
+        Connection& operator*() const { return *connection_; }
 
-    /**
-     * Execute HTTP request to ArangoDB.
-     * @param method HTTP method (GET, POST, DELETE, etc.)
-     * @param endpoint API endpoint (e.g., "/_api/cursor")
-     * @param payload Request body as JSON (optional)
-     * @return Response body as JSON object
-     */
-    json executeRequest(const std::string& method, const std::string& endpoint,
-                       const json& payload = json::object()) {
+    private:
+        ArangoDBClient& client_;
+        std::unique_ptr<Connection> connection_;
+    };
+
+    std::unique_ptr<Connection> acquire() {
+        {
+            std::lock_guard<std::mutex> lock(poolMutex);
+            if (!idleConnections.empty()) {
+                std::unique_ptr<Connection> connection = std::move(idleConnections.back());
+                idleConnections.pop_back();
+                return connection;
+            }
+        }
+
+        auto connection = std::make_unique<Connection>();
         CURL* curl = curl_easy_init();
         if (!curl) {
             throw std::runtime_error("Failed to initialize CURL");
         }
-
-        std::string responseStr;
-        std::string url = baseUrl + endpoint;
-
-        curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
+        connection->curl = curl;
+        // Per-connection options that never change between requests
         curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, WriteCallback);
-        curl_easy_setopt(curl, CURLOPT_WRITEDATA, &responseStr);
-
-        // Set authentication
-        if (!username.empty()) {
-            std::string auth = username + ":" + password;
+        curl_easy_setopt(curl, CURLOPT_WRITEDATA, &connection->response);
+        curl_easy_setopt(curl, CURLOPT_TCP_NODELAY, 1L);
+        curl_easy_setopt(curl, CURLOPT_TCP_KEEPALIVE, 1L);
+        curl_easy_setopt(curl, CURLOPT_NOSIGNAL, 1L);
+        if (!auth.empty()) {
             curl_easy_setopt(curl, CURLOPT_USERPWD, auth.c_str());
         }
+        if (!unixSocketPath.empty()) {
+            curl_easy_setopt(curl, CURLOPT_UNIX_SOCKET_PATH, unixSocketPath.c_str());
+        }
+        return connection;
+    }
 
-        // Set HTTP method and payload
-        struct curl_slist* headers = nullptr;
-        headers = curl_slist_append(headers, "Content-Type: application/json");
-        curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
+    void release(std::unique_ptr<Connection> connection) {
+        std::lock_guard<std::mutex> lock(poolMutex);
+        idleConnections.push_back(std::move(connection));
+    }
 
-        std::string payloadStr;
-        if (method == "POST" || method == "PUT" || method == "PATCH") {
-            payloadStr = payload.dump();
-            curl_easy_setopt(curl, CURLOPT_POSTFIELDS, payloadStr.c_str());
-            if (method == "PUT") {
-                curl_easy_setopt(curl, CURLOPT_CUSTOMREQUEST, "PUT");
-            } else if (method == "PATCH") {
-                curl_easy_setopt(curl, CURLOPT_CUSTOMREQUEST, "PATCH");
-            }
-        } else if (method == "DELETE") {
-            curl_easy_setopt(curl, CURLOPT_CUSTOMREQUEST, "DELETE");
+    /**
+     * Perform one request on a leased connection; the body ends up in connection.response.
+     * Throws on transport errors and HTTP status >= 400.
+     */
+    void perform(Connection& connection, const std::string& method, const std::string& endpoint,
+                 const std::string* body, bool acceptVelocyPack) {
+        CURL* curl = connection.curl;
+        connection.response.clear();
+
+        std::string url = baseUrl + endpoint;
+        curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
+        curl_easy_setopt(curl, CURLOPT_HTTPHEADER, acceptVelocyPack ? velocyPackHeaders : jsonHeaders);
+
+        // Set HTTP method and payload (reset whatever the previous request on this handle used)
+        if (body) {
+            curl_easy_setopt(curl, CURLOPT_POSTFIELDS, body->c_str());
+            curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE_LARGE, static_cast<curl_off_t>(body->size()));
+            curl_easy_setopt(curl, CURLOPT_CUSTOMREQUEST, method == "POST" ? nullptr : method.c_str());
+        } else {
+            curl_easy_setopt(curl, CURLOPT_HTTPGET, 1L);
+            curl_easy_setopt(curl, CURLOPT_CUSTOMREQUEST, method == "GET" ? nullptr : method.c_str());
         }
 
         CURLcode res = curl_easy_perform(curl);
@@ -90,23 +146,164 @@ public:
         long httpCode = 0;
         curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &httpCode);
 
-        curl_slist_free_all(headers);
-        curl_easy_cleanup(curl);
-
         if (res != CURLE_OK) {
             throw std::runtime_error("CURL request failed: " + std::string(curl_easy_strerror(res)));
         }
 
         if (httpCode >= 400) {
             throw std::runtime_error("HTTP request failed with code " + std::to_string(httpCode) +
-                                   ": " + responseStr);
+                                   ": " + connection.response);
+        }
+    }
+
+    /**
+     * SAX handler that counts the elements of the top-level "result" array and reads
+     * "hasMore" and the cursor "id", ignoring all values.
+     */
+    class ResultCounter : public nlohmann::json_sax<json> {
+    public:
+        size_t results = 0;
+        bool hasMore = false;
+        std::string cursorId;
+
+        bool null() override { return value(); }
+        bool boolean(bool val) override {
+            if (depth_ == 1 && key_ == Key::HAS_MORE) {
+                hasMore = val;
+            }
+            return value();
+        }
+        bool number_integer(number_integer_t) override { return value(); }
+        bool number_unsigned(number_unsigned_t) override { return value(); }
+        bool number_float(number_float_t, const string_t&) override { return value(); }
+        bool string(string_t& val) override {
+            if (depth_ == 1 && key_ == Key::ID) {
+                cursorId = val;
+            }
+            return value();
         }
+        bool binary(binary_t&) override { return value(); }
 
-        if (responseStr.empty()) {
+        bool start_object(std::size_t) override {
+            value();
+            depth_++;
+            return true;
+        }
+        bool end_object() override {
+            depth_--;
+            return true;
+        }
+        bool start_array(std::size_t) override {
+            value();
+            if (depth_ == 1 && key_ == Key::RESULT) {
+                inResult_ = true;
+            }
+            depth_++;
+            return true;
+        }
+        bool end_array() override {
+            depth_--;
+            if (depth_ == 1) {
+                inResult_ = false;
+            }
+            return true;
+        }
+        bool key(string_t& val) override {
+            if (depth_ == 1) {
+                key_ = val == "result" ? Key::RESULT : val == "hasMore" ? Key::HAS_MORE
+                     : val == "id" ? Key::ID : Key::OTHER;
+            }
+            return true;
+        }
+        bool parse_error(std::size_t position, const std::string&, const nlohmann::detail::exception& ex) override {
+            throw std::runtime_error("Invalid AQL response at byte " + std::to_string(position) + ": " + ex.what());
+        }
+
+    private:
+        enum class Key { OTHER, RESULT, HAS_MORE, ID };
+        int depth_ = 0;
+        Key key_ = Key::OTHER;
+        bool inResult_ = false;
+
+        bool value() {
+            if (inResult_ && depth_ == 2) {
+                results++;
+            }
+            return true;
+        }
+    };
+
+public:
+    ArangoDBClient(const std::string& host, int port,
+                const std::string& user = "root", const std::string& pass = "",
+                const std::string& socketPath = "")
+        : baseUrl("http://" + host + ":" + std::to_string(port)),
+          username(user), password(pass), currentDatabase("_system"), unixSocketPath(socketPath) {
+        if (!username.empty()) {
+            auth = username + ":" + password;
+        }
+        jsonHeaders = curl_slist_append(jsonHeaders, "Content-Type: application/json");
+        velocyPackHeaders = curl_slist_append(velocyPackHeaders, "Content-Type: application/json");
+        velocyPackHeaders = curl_slist_append(velocyPackHeaders, "Accept: application/x-velocypack");
+    }
+
+    ~ArangoDBClient() {
+        for (auto& connection : idleConnections) {
+            curl_easy_cleanup(connection->curl);
+        }
+        curl_slist_free_all(jsonHeaders);
+        curl_slist_free_all(velocyPackHeaders);
+    }
+
+    ArangoDBClient(const ArangoDBClient&) = delete;
+    ArangoDBClient& operator=(const ArangoDBClient&) = delete;
+
+    /**
+     * Set the current database context for subsequent operations.
+     */
+    void useDatabase(const std::string& dbName) {
+        currentDatabase = dbName;
+    }
+
+    /**
+     * Request VelocyPack instead of JSON responses in executeAQLCounted().
+     */
+    void setVelocyPackResponses(bool enabled) {
+        velocyPackResponses = enabled;
+    }
+
+    /**
+     * Execute HTTP request to ArangoDB.
+     * @param method HTTP method (GET, POST, DELETE, etc.)
+     * @param endpoint API endpoint (e.g., "/_api/cursor")
+     * @param payload Request body as JSON (optional)
+     * @return Response body as JSON object
+     */
+    json executeRequest(const std::string& method, const std::string& endpoint,
+                       const json& payload = json::object()) {
+        ConnectionLease connection(*this);
+        if (method == "POST" || method == "PUT" || method == "PATCH") {
+            std::string payloadStr = payload.dump();
+            perform(*connection, method, endpoint, &payloadStr, false);
+        } else {
+            perform(*connection, method, endpoint, nullptr, false);
+        }
+
+        if ((*connection).response.empty()) {
             return json::object();
         }
 
-        return json::parse(responseStr);
+        return json::parse((*connection).response);
+    }
+
+    /**
+     * GET an endpoint that does not answer with JSON (e.g. Prometheus metrics).
+     * @return Response body
+     */
+    std::string fetchText(const std::string& endpoint) {
+        ConnectionLease connection(*this);
+        perform(*connection, "GET", endpoint, nullptr, false);
+        return (*connection).response;
     }
 
     /**
@@ -125,6 +322,63 @@ public:
         return executeRequest("POST", endpoint, payload);
     }
 
+    /**
+     * Execute a pre-serialized AQL cursor request and count its results without
+     * materializing them. A JSON cursor that still has more batches (a result larger
+     * than AQL_CURSOR_BATCH_SIZE) is drained with PUT /_api/cursor/<id>, so the count
+     * is complete and no cursor is left open on the server.
+     * @param body Complete cursor request body (see AqlRequestWriter)
+     * @return Result count, response size and number of cursor batches
+     */
+    AqlResultSummary executeAQLCounted(const std::string& body) {
+        ConnectionLease connection(*this);
+        std::string cursorEndpoint = "/_db/" + currentDatabase + "/_api/cursor";
+        perform(*connection, "POST", cursorEndpoint, &body, velocyPackResponses);
+
+        AqlResultSummary summary;
+        while (true) {
+            const std::string& response = (*connection).response;
+            summary.bytes += response.size();
+            summary.batches++;
+            if (velocyPackResponses || response.empty()) {
+                break;
+            }
+            ResultCounter counter;
+            json::sax_parse(response, &counter);
+            summary.results += counter.results;
+            if (!counter.hasMore || counter.cursorId.empty()) {
+                break;
+            }
+            perform(*connection, "PUT", cursorEndpoint + "/" + counter.cursorId, nullptr, false);
+        }
+        return summary;
+    }
+
+    /**
+     * Execute a pre-serialized AQL cursor request and return its result array.
+     * Always requests JSON, since the caller reads the values; meant for queries
+     * that aggregate to a few scalars.
+     * @param body Complete cursor request body (see AqlRequestWriter)
+     */
+    json executeAQLResults(const std::string& body) {
+        ConnectionLease connection(*this);
+        perform(*connection, "POST", "/_db/" + currentDatabase + "/_api/cursor", &body, false);
+
+        json response = json::parse((*connection).response);
+        if (response.contains("result") && response["result"].is_array()) {
+            return response["result"];
+        }
+        return json::array();
+    }
+
+    /**
+     * Execute AQL query with bind variables and count its results without materializing them.
+     */
+    AqlResultSummary executeAQLCounted(const std::string& query, const json& bindVars) {
+        json payload = {{"query", query}, {"bindVars", bindVars}, {"batchSize", AQL_CURSOR_BATCH_SIZE}};
+        return executeAQLCounted(payload.dump());
+    }
+
     /**
      * Execute AQL query and return result array.
      * @param query AQL query string
@@ -139,6 +393,26 @@ public:
         return json::array();
     }
 
+    /**
+     * Bulk import newline-separated JSON documents through /_api/import.
+     * Existing documents are kept (overwrite=false), the import does not wait for
+     * sync, and it fails as a whole if any document is rejected (complete=true).
+     * @param collection Target collection
+     * @param jsonLines One JSON document per line
+     * @return Number of documents created
+     */
+    size_t importDocuments(const std::string& collection, const std::string& jsonLines) {
+        ConnectionLease connection(*this);
+        perform(*connection, "POST", "/_db/" + currentDatabase + "/_api/import?type=documents&collection=" +
+                collection + "&overwrite=false&waitForSync=false&complete=true", &jsonLines, false);
+
+        json response = json::parse((*connection).response);
+        if (response.value("errors", 0) > 0) {
+            throw std::runtime_error("Import into " + collection + " failed: " + (*connection).response);
+        }
+        return response.value("created", size_t(0));
+    }
+
     /**
      * Create a database.
      */
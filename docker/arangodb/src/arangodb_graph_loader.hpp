@@ -1,10 +1,15 @@
 #pragma once
 
+#include "arangodb_bulk_importer.hpp"
 #include "arangodb_client.hpp"
+#include "aql_request_writer.hpp"
 #include <graphbench/progress_callback.hpp>
 #include <graphbench/benchmark_utils.hpp>
-#include <graphbench/node_id_mapping.hpp>
-#include <csv.hpp>
+#include <graphbench/string_key_mapping.hpp>
+#include <graphbench/binary_graph_cache.hpp>
+#include <graphbench/degree_counts.hpp>
+#include <graphbench/parallel_csv_reader.hpp>
+#include <graphbench/synthetic_graph.hpp>
 #include <map>
 #include <string>
 #include <memory>
@@ -28,7 +33,9 @@ struct CsvMetadata {
 /**
  * ArangoDB graph loader.
  * Handles loading graph data from CSV files and creating indexes for property queries.
- * Uses batch insertion for optimal performance.
+ * Documents are streamed to /_api/import as JSON lines with several imports in
+ * flight (see ArangoDBBulkImporter) while the CSV reader parses the next chunks.
+ * Property indexes are only created once all documents are in.
  */
 class ArangoDBGraphLoader {
 public:
@@ -50,21 +57,29 @@ public:
 
     /**
      * Load graph from CSV files (nodes.csv and edges.csv).
-     * Reads CSV files in batches and inserts into ArangoDB collections using batch AQL queries.
-     * This is much faster than individual inserts.
+     * Reads CSV files in batches and bulk-imports them into the ArangoDB collections.
      * @param datasetPath Path to dataset directory containing nodes.csv and edges.csv
      * @return Map containing load statistics (nodes count, edges count, duration in seconds)
      */
     std::map<std::string, std::any> load(const std::string& datasetPath) {
         auto startTime = std::chrono::high_resolution_clock::now();
 
+        // Generator of a synthetic dataset, else the binary graph cache, or nullptr for both to parse the CSV files
+        std::unique_ptr<SyntheticGraph> synthetic = SyntheticGraph::open(datasetPath);
+        std::unique_ptr<BinaryGraphCache> cache = synthetic ? nullptr : BinaryGraphCache::open(datasetPath);
+        if (synthetic) {
+            progressCallback_->sendLogMessage("Generating synthetic graph: " + synthetic->describe(), "INFO");
+        } else if (cache) {
+            progressCallback_->sendLogMessage("Reading graph from binary cache " + cache->path(), "INFO");
+        }
+
         // Load nodes from nodes.csv
         std::string nodesFile = datasetPath + "/nodes.csv";
-        int nodeCount = loadNodes(nodesFile);
+        int nodeCount = loadNodes(nodesFile, synthetic.get(), cache.get());
 
         // Load edges from edges.csv
         std::string edgesFile = datasetPath + "/edges.csv";
-        int edgeCount = loadEdges(edgesFile);
+        int edgeCount = loadEdges(edgesFile, synthetic.get(), cache.get());
 
         auto endTime = std::chrono::high_resolution_clock::now();
         double duration = std::chrono::duration<double>(endTime - startTime).count();
@@ -79,7 +94,8 @@ public:
 
     /**
      * Create property indexes for efficient property-based queries.
-     * Should be called after load() for property benchmark executors.
+     * Should be called after load() for property benchmark executors, so the indexes
+     * are built once over the loaded collections instead of maintained per import.
      * Creates persistent indexes on all property columns.
      * @param metadata CSV metadata containing property column information
      */
@@ -98,10 +114,10 @@ public:
     }
 
     /**
-     * Get the node IDs mapping (originId -> systemId).
+     * Hand over the node IDs mapping (originId -> document key).
      * Used for converting dataset IDs to ArangoDB document keys.
      */
-    const NodeIdMapping<std::string>& getNodeIdMapping() const { return *nodeIdMapping_; }
+    std::unique_ptr<StringKeyMapping> releaseNodeIdMapping() { return std::move(nodeIdMapping_); }
 
     /**
      * Get CSV metadata containing property type information.
@@ -111,171 +127,144 @@ public:
 private:
     static constexpr const char* VERTEX_COLLECTION = "vertices";
     static constexpr const char* EDGE_COLLECTION = "edges";
+    static constexpr const char* VERTEX_KEY_PREFIX = "v";
     static constexpr int LOAD_BATCH_SIZE = 10000;
 
     std::shared_ptr<ArangoDBClient> arangoUtils_;
     std::string dbName_;
     std::shared_ptr<ProgressCallback> progressCallback_;
     bool loadProperties_;
-    std::unique_ptr<NodeIdMapping<std::string>> nodeIdMapping_;
+    std::unique_ptr<StringKeyMapping> nodeIdMapping_;
     CsvMetadata metadata_;
 
     /**
      * Load nodes from CSV file in batches.
-     * Parses nodes.csv and inserts documents into vertex collection.
+     * Parses nodes.csv with the parallel memory-mapped reader and inserts documents into vertex collection.
      * First column is always the node ID (originId).
      * Additional columns are treated as properties if loadProperties_ is true.
      * @param nodesFile Path to nodes.csv
+     * @param synthetic Synthetic graph to generate instead of reading nodesFile, or nullptr
+     * @param cache Binary graph cache to read instead of nodesFile, or nullptr
      * @return Number of nodes loaded
      */
-    int loadNodes(const std::string& nodesFile) {
+    int loadNodes(const std::string& nodesFile, const SyntheticGraph* synthetic, const BinaryGraphCache* cache) {
         // Pre-allocate node ID mapping
         std::string datasetPath = nodesFile.substr(0, nodesFile.find_last_of("/\\"));
-        size_t nodeCount = NodeIdMapping<std::string>::count_nodes_from_csv(datasetPath);
-        nodeIdMapping_ = std::make_unique<NodeIdMapping<std::string>>(nodeCount, "", progressCallback_.get());
+        size_t nodeCount = StringKeyMapping::count_nodes_from_csv(datasetPath);
+        // Keys are "v" + originId, so the computed strategy stores none of them
+        nodeIdMapping_ = std::make_unique<StringKeyMapping>(nodeCount, StringKeyMapping::strategyFromEnv(),
+                                                            VERTEX_KEY_PREFIX, progressCallback_.get());
+
+        int loadedCount = 0;
+        ArangoDBBulkImporter importer(*arangoUtils_, VERTEX_COLLECTION, LOAD_BATCH_SIZE);
+
+        auto appendBatch = [&](const CsvBatch& batch) {
+            for (size_t row = 0; row < batch.rows; row++) {
+                int64_t originId = batch.id(row);
+                std::string vertexKey = VERTEX_KEY_PREFIX + std::to_string(originId);
+
+                // Node document: {"_key":...,"originId":...,<properties>}
+                std::string& doc = importer.document();
+                doc.append("{\"_key\":");
+                appendJsonString(doc, vertexKey);
+                doc.append(",\"originId\":").append(std::to_string(originId));
+
+                // Add properties (only collected when loadProperties_ is set)
+                for (size_t column = 0; column < batch.propertyColumns; column++) {
+                    appendProperty(doc, batch, row, column);
+                }
+                doc.push_back('}');
+                importer.endDocument();
 
-        // Create CSV reader
-        csv::CSVReader reader(nodesFile);
+                nodeIdMapping_->set(originId, vertexKey);
+                loadedCount++;
+            }
+        };
+        std::vector<std::string> headers = synthetic ? synthetic->readNodes(loadProperties_, appendBatch)
+                                           : cache ? cache->readNodes(loadProperties_, appendBatch)
+                                                   : ParallelCsvReader().read(nodesFile, 1, loadProperties_, appendBatch);
 
-        // Get column names from header
-        std::vector<std::string> headers = reader.get_col_names();
-        std::vector<std::string> propertyColumns;
+        // Import remaining nodes and wait for the imports in flight
+        importer.finish();
 
         // First column is always node ID, rest are properties
-        if (loadProperties_ && headers.size() > 1) {
+        if (loadProperties_) {
             for (size_t i = 1; i < headers.size(); i++) {
-                propertyColumns.push_back(headers[i]);
                 // Infer type as string by default (can be enhanced with type detection)
                 metadata_.vertexPropertyTypes[headers[i]] = "string";
             }
         }
 
-        int loadedCount = 0;
-        json nodeBatch = json::array();
-
-        // Read CSV rows
-        for (csv::CSVRow& row : reader) {
-            // Parse node ID from first column
-            int64_t originId = row[0].get<int64_t>();
-            std::string vertexKey = "v" + std::to_string(originId);
-
-            // Build node document
-            json nodeDoc = {
-                {"_key", vertexKey},
-                {"originId", originId}
-            };
-
-            // Add properties if enabled
-            if (loadProperties_) {
-                for (size_t i = 0; i < propertyColumns.size() && i + 1 < row.size(); i++) {
-                    nodeDoc[propertyColumns[i]] = row[i + 1].get<>();
-                }
-            }
-
-            nodeBatch.push_back(nodeDoc);
-            nodeIdMapping_->set(originId, vertexKey);
-            loadedCount++;
-
-            // Batch insert when batch size reached
-            if (nodeBatch.size() >= LOAD_BATCH_SIZE) {
-                insertBatch(VERTEX_COLLECTION, nodeBatch);
-                nodeBatch.clear();
-            }
-        }
-
-        // Insert remaining nodes
-        if (!nodeBatch.empty()) {
-            insertBatch(VERTEX_COLLECTION, nodeBatch);
-        }
-
-        progressCallback_->sendLogMessage("Loaded " + std::to_string(loadedCount) + " nodes", "INFO");
+        progressCallback_->sendLogMessage("Loaded " + std::to_string(loadedCount) + " nodes (key mapping: " +
+                                          std::to_string(nodeIdMapping_->memoryBytes()) + " bytes)", "INFO");
         return loadedCount;
     }
 
     /**
      * Load edges from CSV file in batches.
-     * Parses edges.csv and inserts documents into edge collection.
+     * Parses edges.csv with the parallel memory-mapped reader and inserts documents into edge collection.
      * First two columns are source and destination node IDs.
      * Additional columns are treated as properties if loadProperties_ is true.
      * @param edgesFile Path to edges.csv
+     * @param synthetic Synthetic graph to generate instead of reading edgesFile, or nullptr
+     * @param cache Binary graph cache to read instead of edgesFile, or nullptr
      * @return Number of edges loaded
      */
-    int loadEdges(const std::string& edgesFile) {
-        // Create CSV reader
-        csv::CSVReader reader(edgesFile);
-
-        // Get column names from header
-        std::vector<std::string> headers = reader.get_col_names();
-        std::vector<std::string> propertyColumns;
-
-        // First two columns are src/dst, rest are properties
-        if (loadProperties_ && headers.size() > 2) {
-            for (size_t i = 2; i < headers.size(); i++) {
-                propertyColumns.push_back(headers[i]);
-                metadata_.edgePropertyTypes[headers[i]] = "string";
-            }
-        }
-
+    int loadEdges(const std::string& edgesFile, const SyntheticGraph* synthetic, const BinaryGraphCache* cache) {
         int edgeCount = 0;
-        json edgeBatch = json::array();
-
-        // Read CSV rows
-        for (csv::CSVRow& row : reader) {
-            if (row.size() < 2) continue;
-
-            // Parse source and destination IDs
-            int64_t srcId = row[0].get<int64_t>();
-            int64_t dstId = row[1].get<int64_t>();
-
-            // Get internal node keys with validation
-            std::string srcKey = nodeIdMapping_->get(srcId, "src");
-            std::string dstKey = nodeIdMapping_->get(dstId, "dst");
-
-            // Build edge document with _from and _to
-            json edgeDoc = {
-                {"_from", std::string(VERTEX_COLLECTION) + "/" + srcKey},
-                {"_to", std::string(VERTEX_COLLECTION) + "/" + dstKey}
-            };
-
-            // Add properties if enabled
-            if (loadProperties_) {
-                for (size_t i = 0; i < propertyColumns.size() && i + 2 < row.size(); i++) {
-                    edgeDoc[propertyColumns[i]] = row[i + 2].get<>();
+        ArangoDBBulkImporter importer(*arangoUtils_, EDGE_COLLECTION, LOAD_BATCH_SIZE);
+        const std::string vertexPrefix = std::string(VERTEX_COLLECTION) + "/";
+
+        auto appendBatch = [&](const CsvBatch& batch) {
+            DegreeRecorder::recordEdges(batch);
+            for (size_t row = 0; row < batch.rows; row++) {
+                // Get internal node keys with validation
+                StringKey srcKey = nodeIdMapping_->get(batch.id(row, 0), "src");
+                StringKey dstKey = nodeIdMapping_->get(batch.id(row, 1), "dst");
+
+                // Edge document: {"_from":...,"_to":...,<properties>}
+                std::string& doc = importer.document();
+                doc.append("{\"_from\":");
+                appendJsonString(doc, *srcKey, vertexPrefix);
+                doc.append(",\"_to\":");
+                appendJsonString(doc, *dstKey, vertexPrefix);
+
+                // Add properties (only collected when loadProperties_ is set)
+                for (size_t column = 0; column < batch.propertyColumns; column++) {
+                    appendProperty(doc, batch, row, column);
                 }
+                doc.push_back('}');
+                importer.endDocument();
+
+                edgeCount++;
             }
+        };
+        std::vector<std::string> headers = synthetic ? synthetic->readEdges(loadProperties_, appendBatch)
+                                           : cache ? cache->readEdges(loadProperties_, appendBatch)
+                                                   : ParallelCsvReader().read(edgesFile, 2, loadProperties_, appendBatch);
 
-            edgeBatch.push_back(edgeDoc);
-            edgeCount++;
+        // Import remaining edges and wait for the imports in flight
+        importer.finish();
 
-            // Batch insert when batch size reached
-            if (edgeBatch.size() >= LOAD_BATCH_SIZE) {
-                insertBatch(EDGE_COLLECTION, edgeBatch);
-                edgeBatch.clear();
+        // First two columns are src/dst, rest are properties
+        if (loadProperties_) {
+            for (size_t i = 2; i < headers.size(); i++) {
+                metadata_.edgePropertyTypes[headers[i]] = "string";
             }
         }
 
-        // Insert remaining edges
-        if (!edgeBatch.empty()) {
-            insertBatch(EDGE_COLLECTION, edgeBatch);
-        }
-
         progressCallback_->sendLogMessage("Loaded " + std::to_string(edgeCount) + " edges", "INFO");
         return edgeCount;
     }
 
     /**
-     * Insert a batch of documents into a collection using a single AQL query.
-     * This is the key optimization: instead of N individual inserts, we do 1 batch insert.
-     * Uses AQL FOR loop to iterate over documents array and insert each one.
-     * @param collection Collection name
-     * @param documents JSON array of documents to insert
+     * Append one property column of a CSV row to a document as a string field.
      */
-    void insertBatch(const std::string& collection, const json& documents) {
-        // Use AQL FOR loop to insert all documents in one query
-        // This is much faster than individual INSERT statements
-        std::string query = "FOR doc IN @docs INSERT doc INTO " + collection;
-        json bindVars = {{"docs", documents}};
-        arangoUtils_->executeAQL(query, bindVars);
+    static void appendProperty(std::string& doc, const CsvBatch& batch, size_t row, size_t column) {
+        doc.push_back(',');
+        appendJsonString(doc, batch.propertyName(column));
+        doc.push_back(':');
+        appendJsonString(doc, batch.propertyString(row, column));
     }
 };
 
@@ -11,20 +11,20 @@ namespace graphbench {
  * Extends structural executor with property-related operations.
  * Loads graph with properties and creates indexes for efficient property queries.
  */
-class ArangoDBPropertyBenchmarkExecutor : public PropertyBenchmarkExecutor<ArangoDBPropertyBenchmarkExecutor>,
+class ArangoDBPropertyBenchmarkExecutor : public PropertyBenchmarkExecutor<ArangoDBPropertyBenchmarkExecutor, ArangoDBSystemId>,
                                           public ArangoDBBenchmarkExecutor {
 public:
-    std::string getDatabaseNameImpl() const { return "arangodb-property"; }
+    std::string getDatabaseNameImpl() const override { return "arangodb-property"; }
 
     /**
      * Load graph with properties from CSV files.
      * Creates property indexes after loading for efficient queries.
      */
-    std::map<std::string, std::any> loadGraphImpl(const std::string& datasetPath) {
+    std::map<std::string, std::any> loadGraphImpl(const std::string& datasetPath) override {
         // Load graph with properties enabled
         ArangoDBGraphLoader loader(arangoUtils_, DB_NAME, progressCallback_, true);
         auto result = loader.load(datasetPath);
-        nodeIdMapping_ = std::make_unique<NodeIdMapping<std::string>>(loader.getNodeIdMapping());
+        nodeIdMapping_ = loader.releaseNodeIdMapping();
         metadata_ = loader.getMetadata();
 
         // Create property indexes for efficient queries
@@ -35,30 +35,31 @@ public:
 
     /**
      * Update vertex properties in batches.
-     * Uses batch AQL UPDATE to modify multiple vertices in one query.
+     * Uses batch AQL UPDATE to modify multiple vertices in one query; all properties
+     * of one vertex are merged by the same UPDATE.
      */
-    std::vector<double> updateVertexPropertyImpl(const std::vector<VertexUpdate>& updates, int batchSize) {
-        return executeBatchOperation(updates, batchSize, [this](const std::vector<VertexUpdate>& batch) {
-            // Build array of update specifications
-            json updateSpecs = json::array();
-            for (const auto& update : batch) {
-                json spec = {
-                    {"_key", std::any_cast<std::string>(update.systemId)}
-                };
-                // Add properties to update
-                for (const auto& [key, value] : update.properties) {
-                    spec[key] = convertAnyToJson(value);
+    std::vector<double> updateVertexPropertyImpl(BatchView<VertexUpdate<ArangoDBSystemId>> updates, int batchSize) {
+        // Single batch UPDATE query
+        const std::string query =
+            "FOR spec IN @specs "
+            "  UPDATE spec._key WITH spec IN " + std::string(VERTEX_COLLECTION);
+        undoLog_.touchVertices(updates, [](const VertexUpdate<ArangoDBSystemId>& update) { return update.systemId; });
+
+        return executeRequestBatches(updates, batchSize,
+            [&query](std::string& body, BatchView<VertexUpdate<ArangoDBSystemId>> batch) {
+                // One update specification per vertex: its key and the properties to merge
+                AqlRequestWriter writer(body);
+                writer.beginRequest(query).beginArray("specs");
+                for (const auto& update : batch) {
+                    writer.beginObject().field("_key", *update.systemId);
+                    for (const auto& [key, value] : update.properties) {
+                        writer.anyField(key, value);
+                    }
+                    writer.endObject();
                 }
-                updateSpecs.push_back(spec);
-            }
-
-            // Single batch UPDATE query
-            std::string query =
-                "FOR spec IN @specs "
-                "  UPDATE spec._key WITH spec IN " + std::string(VERTEX_COLLECTION);
-            json bindVars = {{"specs", updateSpecs}};
-            arangoUtils_->executeAQL(query, bindVars);
-        });
+                writer.endArray().finish();
+            },
+            countedRequest());
     }
 
     /**
@@ -66,121 +67,89 @@ public:
      * Uses batch AQL to find edges and update their properties in one query.
      */
     std::vector<double> updateEdgePropertyImpl(const std::string& label,
-                                               const std::vector<EdgeUpdate>& updates,
+                                               BatchView<EdgeUpdate<ArangoDBSystemId>> updates,
                                                int batchSize) {
-        return executeBatchOperation(updates, batchSize, [this, &label](const std::vector<EdgeUpdate>& batch) {
-            // Build array of update specifications
-            json updateSpecs = json::array();
-            for (const auto& update : batch) {
-                json spec = {
-                    {"from", std::string(VERTEX_COLLECTION) + "/" + std::any_cast<std::string>(update.srcSystemId)},
-                    {"to", std::string(VERTEX_COLLECTION) + "/" + std::any_cast<std::string>(update.dstSystemId)},
-                    {"props", json::object()}
-                };
-                // Add properties to update
-                for (const auto& [key, value] : update.properties) {
-                    spec["props"][key] = convertAnyToJson(value);
-                }
-                updateSpecs.push_back(spec);
-            }
-
-            // Single batch UPDATE query
-            std::string query =
-                "FOR spec IN @specs "
-                "  FOR e IN " + std::string(EDGE_COLLECTION) + " "
-                "    FILTER e._from == spec.from AND e._to == spec.to AND e.label == @label "
-                "    UPDATE e WITH spec.props IN " + std::string(EDGE_COLLECTION);
-            json bindVars = {{"specs", updateSpecs}, {"label", label}};
-            arangoUtils_->executeAQL(query, bindVars);
+        // Single batch UPDATE query
+        const std::string query =
+            "FOR spec IN @specs "
+            "  FOR e IN " + std::string(EDGE_COLLECTION) + " "
+            "    FILTER e._from == spec.from AND e._to == spec.to AND e.label == @label "
+            "    UPDATE e WITH spec.props IN " + std::string(EDGE_COLLECTION);
+        undoLog_.touchEdges(label, updates, [](const EdgeUpdate<ArangoDBSystemId>& update) {
+            return std::make_pair(update.srcSystemId, update.dstSystemId);
         });
+
+        const std::string vertexPrefix = std::string(VERTEX_COLLECTION) + "/";
+
+        return executeRequestBatches(updates, batchSize,
+            [&query, &label, &vertexPrefix](std::string& body, BatchView<EdgeUpdate<ArangoDBSystemId>> batch) {
+                // One update specification per edge: its endpoints and the properties to merge
+                AqlRequestWriter writer(body);
+                writer.beginRequest(query).beginArray("specs");
+                for (const auto& update : batch) {
+                    writer.beginObject()
+                          .field("from", *update.srcSystemId, vertexPrefix)
+                          .field("to", *update.dstSystemId, vertexPrefix)
+                          .beginObject("props");
+                    for (const auto& [key, value] : update.properties) {
+                        writer.anyField(key, value);
+                    }
+                    writer.endObject().endObject();
+                }
+                writer.endArray().field("label", label).finish();
+            },
+            countedRequest());
     }
 
     /**
      * Get vertices by property in batches.
      * Uses batch AQL to query multiple property values in one query.
      */
-    std::vector<double> getVertexByPropertyImpl(const std::vector<PropertyQuery>& queries, int batchSize) {
-        return executeBatchOperation(queries, batchSize, [this](const std::vector<PropertyQuery>& batch) {
-            // Build array of query specifications
-            json querySpecs = json::array();
-            for (const auto& query : batch) {
-                querySpecs.push_back({
-                    {"key", query.key},
-                    {"value", convertAnyToJson(query.value)}
-                });
-            }
-
-            // Single batch query using FOR loop
-            std::string aql =
-                "FOR spec IN @specs "
-                "  FOR v IN " + std::string(VERTEX_COLLECTION) + " "
-                "    FILTER v[spec.key] == spec.value "
-                "    RETURN v";
-            json bindVars = {{"specs", querySpecs}};
-            arangoUtils_->executeAQLWithResults(aql, bindVars);
-        });
+    std::vector<double> getVertexByPropertyImpl(BatchView<PropertyQuery> queries, int batchSize) {
+        // Single batch query using FOR loop
+        const std::string aql =
+            "FOR spec IN @specs "
+            "  FOR v IN " + std::string(VERTEX_COLLECTION) + " "
+            "    FILTER v[spec.key] == spec.value "
+            "    RETURN v";
+
+        return executeRequestBatches(queries, batchSize, PropertyQueryRequest{aql}, countedRequest());
     }
 
     /**
      * Get edges by property in batches.
      * Uses batch AQL to query multiple property values in one query.
      */
-    std::vector<double> getEdgeByPropertyImpl(const std::vector<PropertyQuery>& queries, int batchSize) {
-        return executeBatchOperation(queries, batchSize, [this](const std::vector<PropertyQuery>& batch) {
-            // Build array of query specifications
-            json querySpecs = json::array();
-            for (const auto& query : batch) {
-                querySpecs.push_back({
-                    {"key", query.key},
-                    {"value", convertAnyToJson(query.value)}
-                });
-            }
-
-            // Single batch query using FOR loop
-            std::string aql =
-                "FOR spec IN @specs "
-                "  FOR e IN " + std::string(EDGE_COLLECTION) + " "
-                "    FILTER e[spec.key] == spec.value "
-                "    RETURN e";
-            json bindVars = {{"specs", querySpecs}};
-            arangoUtils_->executeAQLWithResults(aql, bindVars);
-        });
+    std::vector<double> getEdgeByPropertyImpl(BatchView<PropertyQuery> queries, int batchSize) {
+        // Single batch query using FOR loop
+        const std::string aql =
+            "FOR spec IN @specs "
+            "  FOR e IN " + std::string(EDGE_COLLECTION) + " "
+            "    FILTER e[spec.key] == spec.value "
+            "    RETURN e";
+
+        return executeRequestBatches(queries, batchSize, PropertyQueryRequest{aql}, countedRequest());
     }
 
 private:
     CsvMetadata metadata_;
 
-    /**
-     * Convert std::any to JSON value.
-     * Handles common types: string, int, double, bool.
-     */
-    json convertAnyToJson(const std::any& value) const {
-        if (!value.has_value()) {
-            return nullptr;
-        }
+    /** Request renderer binding a batch of {key, value} property queries as @specs */
+    struct PropertyQueryRequest {
+        const std::string& aql;
 
-        // Try common types
-        try {
-            if (value.type() == typeid(std::string)) {
-                return std::any_cast<std::string>(value);
-            } else if (value.type() == typeid(int)) {
-                return std::any_cast<int>(value);
-            } else if (value.type() == typeid(int64_t)) {
-                return std::any_cast<int64_t>(value);
-            } else if (value.type() == typeid(double)) {
-                return std::any_cast<double>(value);
-            } else if (value.type() == typeid(bool)) {
-                return std::any_cast<bool>(value);
-            } else if (value.type() == typeid(const char*)) {
-                return std::string(std::any_cast<const char*>(value));
+        void operator()(std::string& body, BatchView<PropertyQuery> batch) const {
+            AqlRequestWriter writer(body);
+            writer.beginRequest(aql).beginArray("specs");
+            for (const auto& query : batch) {
+                writer.beginObject()
+                      .field("key", query.key)
+                      .anyField("value", query.value)
+                      .endObject();
             }
-        } catch (const std::bad_any_cast&) {
-            // Fall through to default
+            writer.endArray().finish();
         }
-
-        // Default: return null for unknown types
-        return nullptr;
-    }
+    };
 };
 
 } // namespace graphbench
@@ -0,0 +1,241 @@
+#pragma once
+
+#include "arangodb_client.hpp"
+#include "aql_request_writer.hpp"
+#include <graphbench/batch_view.hpp>
+#include <graphbench/restore_strategy.hpp>
+#include <graphbench/string_key_mapping.hpp>
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace graphbench {
+
+using json = nlohmann::json;
+
+/**
+ * Server-side snapshot and delta-undo restore for ArangoDB.
+ *
+ * The graph lives in arangod's data directory, so the executor's directory-based
+ * snapshot cannot reset it. Instead, snapshot() copies both collections once,
+ * server side, into "<collection>_snapshot" collections (the edge copy keeps an
+ * edge index), and the executors log what each operation changes:
+ *
+ *   - inserted vertices and edges get keys from counters ("new_v<N>", "new_e<N>"),
+ *     so reverting them removes a key range without logging anything;
+ *   - removed or updated vertices are logged by key, removed or updated edges by
+ *     (from, to, label); reverting puts their snapshot documents back.
+ *
+ * A restore therefore costs time proportional to what the batch size changed,
+ * not to the size of the graph. Logging appends the IDs of one executor call
+ * under a mutex, before its batches are timed.
+ */
+class ArangoDBUndoLog {
+public:
+    using Key = StringKey;  // Document key handle (ArangoDBSystemId)
+    using EdgeEnds = std::pair<Key, Key>;
+
+    static constexpr const char* VERTEX_KEY_PREFIX = "new_v";
+    static constexpr const char* EDGE_KEY_PREFIX = "new_e";
+
+    ArangoDBUndoLog(std::string vertexCollection, std::string edgeCollection)
+        : vertexCollection_(std::move(vertexCollection)), edgeCollection_(std::move(edgeCollection)),
+          vertexPrefix_(vertexCollection_ + "/") {}
+
+    /** Reserve count keys for inserted vertices; returns the number of the first */
+    uint64_t reserveVertexKeys(uint64_t count) {
+        return nextVertexKey_.fetch_add(count, std::memory_order_relaxed);
+    }
+
+    /** Reserve count keys for inserted edges; returns the number of the first */
+    uint64_t reserveEdgeKeys(uint64_t count) {
+        return nextEdgeKey_.fetch_add(count, std::memory_order_relaxed);
+    }
+
+    /** Log existing vertices an operation removes or updates; keyOf(item) -> Key */
+    template<typename T, typename KeyOf>
+    void touchVertices(BatchView<T> items, KeyOf keyOf) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const T& item : items) {
+            touchedVertices_.push_back(keyOf(item));
+        }
+    }
+
+    /** Log existing edges an operation removes or updates; endsOf(item) -> EdgeEnds */
+    template<typename T, typename EndsOf>
+    void touchEdges(const std::string& label, BatchView<T> items, EndsOf endsOf) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::vector<EdgeEnds>& edges = touchedEdges_[label];
+        for (const T& item : items) {
+            edges.push_back(endsOf(item));
+        }
+    }
+
+    /**
+     * Copy both collections into their snapshot collections (replacing old ones)
+     * and start an empty log.
+     */
+    RestoreStats snapshot(ArangoDBClient& client, const std::string& dbName) {
+        auto start = std::chrono::steady_clock::now();
+        for (const auto& [collection, isEdge] : {std::make_pair(vertexCollection_, false),
+                                                 std::make_pair(edgeCollection_, true)}) {
+            std::string copy = snapshotName(collection);
+            try {
+                client.executeRequest("DELETE", "/_db/" + dbName + "/_api/collection/" + copy);
+            } catch (const std::exception&) {
+                // No snapshot yet
+            }
+            client.createCollection(dbName, copy, isEdge);
+            client.executeAQLCounted(writeQuery("FOR d IN " + collection + " INSERT " + stripSystem("d") + " INTO " + copy));
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        clearLocked();
+
+        RestoreStats stats;
+        stats.strategy = "undo_log";
+        stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return stats;
+    }
+
+    /**
+     * Revert everything logged since the last snapshot or restore. The log is only
+     * cleared once every revert query succeeded, so a failed restore can be retried.
+     */
+    RestoreStats revert(ArangoDBClient& client) {
+        auto start = std::chrono::steady_clock::now();
+        std::lock_guard<std::mutex> lock(mutex_);
+        RestoreStats stats;
+        stats.strategy = "undo_log";
+
+        // Documents inserted since the snapshot
+        uint64_t nextEdge = nextEdgeKey_.load();
+        uint64_t nextVertex = nextVertexKey_.load();
+        stats.itemsReverted += removeKeyRange(client, edgeCollection_, EDGE_KEY_PREFIX, edgeKeyMark_, nextEdge);
+        stats.itemsReverted += removeKeyRange(client, vertexCollection_, VERTEX_KEY_PREFIX, vertexKeyMark_, nextVertex);
+
+        // Existing documents removed or updated since the snapshot
+        std::sort(touchedVertices_.begin(), touchedVertices_.end());
+        touchedVertices_.erase(std::unique(touchedVertices_.begin(), touchedVertices_.end()), touchedVertices_.end());
+        BatchView<Key> vertices(touchedVertices_);
+        for (size_t i = 0; i < vertices.size(); i += REVERT_CHUNK) {
+            stats.itemsReverted += restoreVertices(client, vertices.slice(i, REVERT_CHUNK));
+        }
+        for (auto& [label, edgeList] : touchedEdges_) {
+            std::sort(edgeList.begin(), edgeList.end());
+            edgeList.erase(std::unique(edgeList.begin(), edgeList.end()), edgeList.end());
+            BatchView<EdgeEnds> edges(edgeList);
+            for (size_t i = 0; i < edges.size(); i += REVERT_CHUNK) {
+                stats.itemsReverted += restoreEdges(client, label, edges.slice(i, REVERT_CHUNK));
+            }
+        }
+
+        edgeKeyMark_ = nextEdge;
+        vertexKeyMark_ = nextVertex;
+        clearLocked();
+        stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return stats;
+    }
+
+private:
+    // Logged documents reverted per query
+    static constexpr size_t REVERT_CHUNK = 10000;
+    // Intermediate commits keep server-side copies of large collections out of one huge transaction
+    static constexpr uint64_t INTERMEDIATE_COMMIT_COUNT = 100000;
+
+    std::string vertexCollection_;
+    std::string edgeCollection_;
+    std::string vertexPrefix_;
+
+    // Key counters keep growing across restores, so reverted keys are never reused
+    std::atomic<uint64_t> nextVertexKey_{0};
+    std::atomic<uint64_t> nextEdgeKey_{0};
+    uint64_t vertexKeyMark_ = 0;  // First counter value inserted since the snapshot / last restore
+    uint64_t edgeKeyMark_ = 0;
+
+    std::mutex mutex_;
+    std::vector<Key> touchedVertices_;
+    std::map<std::string, std::vector<EdgeEnds>> touchedEdges_;  // By edge label
+
+    /** Copy of a document without the attributes arangod derives itself (_key and _from/_to stay) */
+    static std::string stripSystem(const char* variable) {
+        return std::string("UNSET(") + variable + ", \"_id\", \"_rev\")";
+    }
+
+    static std::string snapshotName(const std::string& collection) {
+        return collection + "_snapshot";
+    }
+
+    void clearLocked() {
+        vertexKeyMark_ = nextVertexKey_.load();
+        edgeKeyMark_ = nextEdgeKey_.load();
+        touchedVertices_.clear();
+        touchedEdges_.clear();
+    }
+
+    /** Cursor request body for a write query, committing every INTERMEDIATE_COMMIT_COUNT documents */
+    static std::string writeQuery(const std::string& query, json bindVars = json::object()) {
+        json body = {
+            {"query", query},
+            {"bindVars", std::move(bindVars)},
+            {"options", {{"intermediateCommitCount", INTERMEDIATE_COMMIT_COUNT}}}
+        };
+        return body.dump();
+    }
+
+    static uint64_t removeKeyRange(ArangoDBClient& client, const std::string& collection, const char* prefix,
+                                   uint64_t first, uint64_t end) {
+        if (end <= first) {
+            return 0;
+        }
+        // The key range is generated server side; keys that were never inserted are skipped
+        client.executeAQLCounted(writeQuery(
+            "FOR i IN @first..@last REMOVE CONCAT(@prefix, i) IN " + collection + " OPTIONS {ignoreErrors: true}",
+            {{"first", first}, {"last", end - 1}, {"prefix", prefix}}));
+        return end - first;
+    }
+
+    uint64_t restoreVertices(ArangoDBClient& client, BatchView<Key> keys) {
+        std::string body;
+        AqlRequestWriter writer(body);
+        writer.beginRequest(
+            "FOR k IN @keys LET d = DOCUMENT(\"" + snapshotName(vertexCollection_) + "\", k) FILTER d != null "
+            "INSERT " + stripSystem("d") + " INTO " + vertexCollection_ + " OPTIONS {overwriteMode: \"replace\"}")
+              .beginArray("keys");
+        for (Key key : keys) {
+            writer.element(*key);
+        }
+        writer.endArray();
+        client.executeAQLCounted(writer.finish());
+        return keys.size();
+    }
+
+    uint64_t restoreEdges(ArangoDBClient& client, const std::string& label, BatchView<EdgeEnds> edges) {
+        // Put back every snapshot edge between the ends: removed ones are re-inserted,
+        // updated ones replaced by key
+        std::string body;
+        AqlRequestWriter writer(body);
+        writer.beginRequest(
+            "FOR spec IN @specs FOR e IN " + snapshotName(edgeCollection_) + " "
+            "FILTER e._from == spec.from AND e._to == spec.to AND e.label == @label "
+            "INSERT " + stripSystem("e") + " INTO " + edgeCollection_ + " OPTIONS {overwriteMode: \"replace\"}")
+              .beginArray("specs");
+        for (const auto& [src, dst] : edges) {
+            writer.beginObject()
+                  .field("from", *src, vertexPrefix_)
+                  .field("to", *dst, vertexPrefix_)
+                  .endObject();
+        }
+        writer.endArray().field("label", label);
+        client.executeAQLCounted(writer.finish());
+        return edges.size();
+    }
+};
+
+} // namespace graphbench
@@ -4,7 +4,13 @@
 #include <graphbench/progress_callback.hpp>
 #include <graphbench/benchmark_utils.hpp>
 #include <graphbench/node_id_mapping.hpp>
+#include <graphbench/latency_histogram.hpp>
+#include <graphbench/cycle_clock.hpp>
+#include <graphbench/traversal.hpp>
 #include "aster_graph_loader.hpp"
+#include "aster_options.hpp"
+#include "aster_property_index.hpp"
+#include "aster_neighbor_batch.hpp"
 #include <rocksdb/db.h>
 #include <rocksdb/graph.h>
 #include <rocksdb/options.h>
@@ -12,10 +18,14 @@
 #include <vector>
 #include <map>
 #include <any>
+#include <optional>
+#include <algorithm>
 #include <memory>
+#include <atomic>
 #include <chrono>
 #include <iostream>
 #include <stdexcept>
+#include <utility>
 
 using namespace ROCKSDB_NAMESPACE;
 
@@ -25,7 +35,7 @@ namespace graphbench {
  * Aster benchmark executor for structural operations.
  * Implements graph operations using Aster's RocksGraph API.
  */
-class AsterBenchmarkExecutor : public BenchmarkExecutor<AsterBenchmarkExecutor> {
+class AsterBenchmarkExecutor : public BenchmarkExecutor<AsterBenchmarkExecutor, node_id_t> {
 public:
     AsterBenchmarkExecutor()
         : dbPath_("/tmp/aster-benchmark-db"),
@@ -49,18 +59,13 @@ public:
                 BenchmarkUtils::deleteDirectory(dbPath_);
             }
 
-            // Setup RocksDB options
-            Options options;
-            options.create_if_missing = true;
-            options.level_compaction_dynamic_level_bytes = false;
-            options.write_buffer_size = 4 * 1024 * 1024;
-            options.max_bytes_for_level_base = options.write_buffer_size * options.max_bytes_for_level_multiplier;
-
-            // Create RocksGraph instance with EDGE_UPDATE_ADAPTIVE policy, auto_reinitialize=true, and db_path
-            graph_ = new RocksGraph(options, EDGE_UPDATE_ADAPTIVE, ENCODING_TYPE_NONE, true, dbPath_);
+            // Create the RocksGraph instance with auto_reinitialize=true under the engine profile
+            graph_ = AsterOptions::openGraph(AsterOptions::benchmarkProfile(true), true, dbPath_);
+            openPropertyIndex();
 
             if (progressCallback_) {
-                progressCallback_->sendLogMessage("Aster database initialized at " + dbPath_, "INFO");
+                progressCallback_->sendLogMessage("Aster database initialized at " + dbPath_ + ", engine profile " +
+                                                  AsterOptions::profile().describe(), "INFO");
             }
         } catch (const std::exception& e) {
             throw std::runtime_error("Failed to initialize Aster database: " + std::string(e.what()));
@@ -68,6 +73,7 @@ public:
     }
 
     void shutdownImpl() {
+        propertyIndex_.reset();
         if (graph_) {
             delete graph_;
             graph_ = nullptr;
@@ -77,12 +83,41 @@ public:
         }
     }
 
-    std::map<std::string, std::any> loadGraphImpl(const std::string& datasetPath) {
-        return AsterGraphLoader<AsterBenchmarkExecutor>::loadGraph(this, datasetPath);
+    /**
+     * Load the dataset, under the load option profile when bulk loading is enabled.
+     * The database is then closed (flushing all memtables to SST files) and reopened
+     * with the benchmark profile before any operation is measured.
+     * Virtual (like getDatabaseNameImpl) so the property executor, which is
+     * dispatched through this type, can extend it.
+     */
+    virtual std::map<std::string, std::any> loadGraphImpl(const std::string& datasetPath) {
+        bool bulk = AsterOptions::bulkLoadEnabled();
+        if (bulk) {
+            closeDatabaseImpl();
+            graph_ = AsterOptions::openGraph(AsterOptions::loadProfile(), false, dbPath_);
+            openPropertyIndex();
+        }
+
+        auto result = AsterGraphLoader<AsterBenchmarkExecutor>::loadGraph(this, datasetPath, true,
+                                                                         bulk ? AsterOptions::loadSortRunEdges() : 0);
+
+        if (bulk) {
+            auto flushStart = std::chrono::high_resolution_clock::now();
+            closeDatabaseImpl();
+            openDatabaseImpl();
+            double flushSeconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - flushStart).count();
+            result["flush_seconds"] = flushSeconds;
+            result["duration_seconds"] = std::any_cast<double>(result["duration_seconds"]) + flushSeconds;
+        }
+        result["load_mode"] = std::string(bulk ? "bulk" : "incremental");
+        result["property_index"] = std::string(propertyIndexEnabled_ ? "on" : "off");
+        result["engine_profile"] = AsterOptions::profile().name;
+        return result;
     }
 
     // Helper function: execute operation in batches (count-based)
-    // Measures latency per operation
+    // Measures latency per operation; each op is also recorded into the active LatencyRecorder.
+    // Timestamps are chained so every op costs a single CycleClock read.
     template<typename Operation>
     std::vector<double> executeBatchOperation(int count, int batchSize, Operation op) {
         std::vector<double> latencies;
@@ -91,7 +126,8 @@ public:
         while (processed < count) {
             int batchCount = std::min(batchSize, count - processed);
 
-            auto start = std::chrono::high_resolution_clock::now();
+            uint64_t start = CycleClock::now();
+            uint64_t opStart = start;
 
             for (int i = 0; i < batchCount; i++) {
                 try {
@@ -99,10 +135,12 @@ public:
                 } catch (const std::exception& e) {
                     errorCount_++;
                 }
+                uint64_t opEnd = CycleClock::now();
+                LatencyRecorder::record(CycleClock::toNs(opEnd - opStart));
+                opStart = opEnd;
             }
 
-            auto end = std::chrono::high_resolution_clock::now();
-            double totalLatency = std::chrono::duration<double, std::micro>(end - start).count();
+            double totalLatency = CycleClock::toUs(opStart - start);
             double perOpLatency = totalLatency / batchCount;
             latencies.push_back(perOpLatency);
 
@@ -112,8 +150,33 @@ public:
         return latencies;
     }
 
+    // Helper function: execute each batch as one operation (item-based)
+    // The batch latency is recorded into the active LatencyRecorder amortized over its items.
+    template<typename Container, typename Operation>
+    std::vector<double> executeBatchedOperation(const Container& items, int batchSize, Operation op) {
+        std::vector<double> latencies;
+        size_t step = static_cast<size_t>(std::max(batchSize, 1));
+
+        for (size_t processed = 0; processed < items.size(); processed += step) {
+            size_t batchCount = std::min(step, items.size() - processed);
+
+            uint64_t start = CycleClock::now();
+            try {
+                op(items.data() + processed, batchCount);
+            } catch (const std::exception& e) {
+                errorCount_++;
+            }
+            uint64_t elapsed = CycleClock::now() - start;
+
+            LatencyRecorder::record(CycleClock::toNs(elapsed) / batchCount, batchCount);
+            latencies.push_back(CycleClock::toUs(elapsed) / batchCount);
+        }
+
+        return latencies;
+    }
+
     // Helper function: execute operation in batches (item-based)
-    // Measures latency per item
+    // Measures latency per item; each item is also recorded into the active LatencyRecorder.
     template<typename Container, typename Operation>
     std::vector<double> executeBatchOperation(const Container& items, int batchSize, Operation op) {
         std::vector<double> latencies;
@@ -122,7 +185,8 @@ public:
         while (processed < items.size()) {
             size_t batchCount = std::min(static_cast<size_t>(batchSize), items.size() - processed);
 
-            auto start = std::chrono::high_resolution_clock::now();
+            uint64_t start = CycleClock::now();
+            uint64_t opStart = start;
 
             for (size_t i = 0; i < batchCount; i++) {
                 try {
@@ -130,10 +194,12 @@ public:
                 } catch (const std::exception& e) {
                     errorCount_++;
                 }
+                uint64_t opEnd = CycleClock::now();
+                LatencyRecorder::record(CycleClock::toNs(opEnd - opStart));
+                opStart = opEnd;
             }
 
-            auto end = std::chrono::high_resolution_clock::now();
-            double totalLatency = std::chrono::duration<double, std::micro>(end - start).count();
+            double totalLatency = CycleClock::toUs(opStart - start);
             double perOpLatency = totalLatency / batchCount;
             latencies.push_back(perOpLatency);
 
@@ -153,22 +219,18 @@ public:
         });
     }
 
-    std::vector<double> removeVertexImpl(const std::vector<std::any>& systemIds, int batchSize) {
-        return executeBatchOperation(systemIds, batchSize, [this](const std::any& systemId) {
-            node_id_t nodeId = std::any_cast<node_id_t>(systemId);
+    std::vector<double> removeVertexImpl(BatchView<node_id_t> systemIds, int batchSize) {
+        return executeBatchOperation(systemIds, batchSize, [this](node_id_t nodeId) {
             // Aster doesn't have explicit DeleteVertex, vertices are implicitly removed when all edges are deleted
             // For now, we'll just track the operation
         });
     }
 
     std::vector<double> addEdgeImpl(const std::string& label,
-                                    const std::vector<std::pair<std::any, std::any>>& pairs,
+                                    BatchView<std::pair<node_id_t, node_id_t>> pairs,
                                     int batchSize) {
-        return executeBatchOperation(pairs, batchSize, [this](const std::pair<std::any, std::any>& pair) {
-            node_id_t src = std::any_cast<node_id_t>(pair.first);
-            node_id_t dst = std::any_cast<node_id_t>(pair.second);
-
-            Status s = graph_->AddEdge(src, dst);
+        return executeBatchOperation(pairs, batchSize, [this](const std::pair<node_id_t, node_id_t>& pair) {
+            Status s = graph_->AddEdge(pair.first, pair.second);
             if (!s.ok()) {
                 errorCount_++;
             }
@@ -176,13 +238,10 @@ public:
     }
 
     std::vector<double> removeEdgeImpl(const std::string& label,
-                                       const std::vector<std::pair<std::any, std::any>>& pairs,
+                                       BatchView<std::pair<node_id_t, node_id_t>> pairs,
                                        int batchSize) {
-        return executeBatchOperation(pairs, batchSize, [this](const std::pair<std::any, std::any>& pair) {
-            node_id_t src = std::any_cast<node_id_t>(pair.first);
-            node_id_t dst = std::any_cast<node_id_t>(pair.second);
-
-            Status s = graph_->DeleteEdge(src, dst);
+        return executeBatchOperation(pairs, batchSize, [this](const std::pair<node_id_t, node_id_t>& pair) {
+            Status s = graph_->DeleteEdge(pair.first, pair.second);
             if (!s.ok()) {
                 errorCount_++;
             }
@@ -190,42 +249,63 @@ public:
     }
 
     std::vector<double> getNbrsImpl(const std::string& direction,
-                                    const std::vector<std::any>& systemIds,
+                                    BatchView<node_id_t> systemIds,
                                     int batchSize) {
-        return executeBatchOperation(systemIds, batchSize, [this, &direction](const std::any& systemId) {
-            node_id_t nodeId = std::any_cast<node_id_t>(systemId);
-            Edges edges;
-            Status s = graph_->GetAllEdges(nodeId, &edges);
-
-            if (s.ok()) {
-                // Consume the edges based on direction
-                if (direction == "OUT" || direction == "OUTGOING") {
-                    for (uint32_t j = 0; j < edges.num_edges_out; j++) {
-                        volatile node_id_t neighbor = edges.nxts_out[j].nxt;
-                        (void)neighbor;
-                    }
-                } else if (direction == "IN" || direction == "INCOMING") {
-                    for (uint32_t j = 0; j < edges.num_edges_in; j++) {
-                        volatile node_id_t neighbor = edges.nxts_in[j].nxt;
-                        (void)neighbor;
-                    }
-                } else { // BOTH
-                    for (uint32_t j = 0; j < edges.num_edges_out; j++) {
-                        volatile node_id_t neighbor = edges.nxts_out[j].nxt;
-                        (void)neighbor;
-                    }
-                    for (uint32_t j = 0; j < edges.num_edges_in; j++) {
-                        volatile node_id_t neighbor = edges.nxts_in[j].nxt;
-                        (void)neighbor;
-                    }
-                }
-            } else {
-                errorCount_++;
+        bool out = direction != "IN" && direction != "INCOMING";
+        bool in = direction != "OUT" && direction != "OUTGOING";
+        auto consume = [out, in](node_id_t, const Edges& edges) {
+            // Touch every neighbor of the requested direction
+            for (uint32_t j = 0; out && j < edges.num_edges_out; j++) {
+                volatile node_id_t neighbor = edges.nxts_out[j].nxt;
+                (void)neighbor;
             }
+            for (uint32_t j = 0; in && j < edges.num_edges_in; j++) {
+                volatile node_id_t neighbor = edges.nxts_in[j].nxt;
+                (void)neighbor;
+            }
+            return true;
+        };
+
+        if (batchSize <= 1) {
+            return executeBatchOperation(systemIds, batchSize, [this, &consume](node_id_t nodeId) {
+                errorCount_ += static_cast<int>(AsterNeighborBatch::fetch(graph_, &nodeId, 1, consume));
+            });
+        }
+        // A batch is one fetch in sorted order
+        return executeBatchedOperation(systemIds, batchSize, [this, &consume](const node_id_t* ids, size_t count) {
+            errorCount_ += static_cast<int>(AsterNeighborBatch::fetch(graph_, ids, count, consume));
+        });
+    }
+
+    // Multi-hop traversals run in the harness, one frontier level at a time (RocksGraph
+    // has no traversal API). Visited counts go to the active TraversalRecorder.
+    std::vector<double> kHopImpl(const std::string& direction, int depth,
+                                 BatchView<node_id_t> systemIds,
+                                 int batchSize) {
+        return executeBatchOperation(systemIds, batchSize, [this, &direction, depth](node_id_t start) {
+            TraversalRecorder::recordQuery(traverse(start, direction, depth, std::nullopt).visited);
         });
     }
 
-    std::string getDatabaseNameImpl() const {
+    std::vector<double> bfsImpl(const std::string& direction, int maxDepth,
+                                BatchView<node_id_t> systemIds,
+                                int batchSize) {
+        return executeBatchOperation(systemIds, batchSize, [this, &direction, maxDepth](node_id_t start) {
+            TraversalRecorder::recordQuery(traverse(start, direction, maxDepth, std::nullopt).visited);
+        });
+    }
+
+    std::vector<double> shortestPathImpl(const std::string& direction, int maxDepth,
+                                         BatchView<std::pair<node_id_t, node_id_t>> pairs,
+                                         int batchSize) {
+        return executeBatchOperation(pairs, batchSize, [this, &direction, maxDepth](const std::pair<node_id_t, node_id_t>& pair) {
+            TraversalResult found = traverse(pair.first, direction, maxDepth, pair.second);
+            TraversalRecorder::recordQuery(found.visited);
+            TraversalRecorder::recordPath(found.targetDepth >= 0, static_cast<uint64_t>(std::max(found.targetDepth, 0)));
+        });
+    }
+
+    virtual std::string getDatabaseNameImpl() const {
         return "Aster";
     }
 
@@ -238,6 +318,7 @@ public:
     }
 
     void closeDatabaseImpl() {
+        propertyIndex_.reset();
         if (graph_) {
             delete graph_;
             graph_ = nullptr;
@@ -245,13 +326,66 @@ public:
     }
 
     void openDatabaseImpl() {
-        Options options;
-        options.create_if_missing = false;
-        options.level_compaction_dynamic_level_bytes = false;
-        options.write_buffer_size = 4 * 1024 * 1024;
-        options.max_bytes_for_level_base = options.write_buffer_size * options.max_bytes_for_level_multiplier;
+        graph_ = AsterOptions::openGraph(AsterOptions::benchmarkProfile(false), false, dbPath_);
+        openPropertyIndex();
+    }
+
+    /**
+     * RocksDB tickers and flush/compaction counts (ENGINE_STATS=on), by RocksDB's
+     * statistic names.
+     */
+    EngineCounters engineStatsImpl() {
+        EngineCounters counters;
+        std::shared_ptr<Statistics> statistics = AsterOptions::statistics();
+        if (!statistics) {
+            return counters;
+        }
+        for (const auto& [name, ticker] : ENGINE_TICKERS) {
+            counters[name] = static_cast<double>(statistics->getTickerCount(ticker));
+        }
+        HistogramData flushes;
+        statistics->histogramData(FLUSH_TIME, &flushes);
+        counters["rocksdb.db.flush.count"] = static_cast<double>(flushes.count);
+        HistogramData compactions;
+        statistics->histogramData(COMPACTION_TIME, &compactions);
+        counters["rocksdb.compaction.count"] = static_cast<double>(compactions.count);
+        return counters;
+    }
+
+    /**
+     * Reopen the database: every open builds its options afresh, so this discards
+     * the block cache and the table reader cache.
+     */
+    bool resetEngineCacheImpl() {
+        closeDatabaseImpl();
+        openDatabaseImpl();
+        return true;
+    }
 
-        graph_ = new RocksGraph(options, EDGE_UPDATE_ADAPTIVE, ENCODING_TYPE_NONE, false, dbPath_);
+    /**
+     * Fetch the adjacency list of every loaded vertex once, in ascending vertex order
+     * and PREWARM_BATCH vertices per batch, so data and index blocks are read in key
+     * order. The block cache keeps what fits; the rest stays in the page cache.
+     */
+    bool prewarmCacheImpl() {
+        if (!nodeIdMapping_) {
+            return false;
+        }
+        std::vector<node_id_t> batch;
+        batch.reserve(PREWARM_BATCH);
+        auto touch = [](node_id_t, const Edges&) { return true; };
+        for (size_t originId = 0; originId < nodeIdMapping_->size(); originId++) {
+            bool found = false;
+            node_id_t vertex = nodeIdMapping_->get_or_default(static_cast<int64_t>(originId), &found);
+            if (found) {
+                batch.push_back(vertex);
+            }
+            if (batch.size() == PREWARM_BATCH || (originId + 1 == nodeIdMapping_->size() && !batch.empty())) {
+                AsterNeighborBatch::fetch(graph_, batch.data(), batch.size(), touch);
+                batch.clear();
+            }
+        }
+        return true;
     }
 
     int getErrorCountImpl() const {
@@ -262,15 +396,15 @@ public:
         errorCount_ = 0;
     }
 
-    std::any getSystemIdImpl(int64_t originId) const {
+    std::optional<node_id_t> getSystemIdImpl(int64_t originId) const {
         if (nodeIdMapping_) {
             bool found = false;
-            auto result = nodeIdMapping_->get_or_default(originId, &found);
+            node_id_t result = nodeIdMapping_->get_or_default(originId, &found);
             if (found) {
                 return result;
             }
         }
-        return std::any();
+        return std::nullopt;
     }
 
     ProgressCallback* getProgressCallback() {
@@ -282,13 +416,118 @@ public:
     }
 
 protected:
+    static constexpr std::pair<const char*, Tickers> ENGINE_TICKERS[] = {
+        {"rocksdb.block.cache.hit", BLOCK_CACHE_HIT},
+        {"rocksdb.block.cache.miss", BLOCK_CACHE_MISS},
+        {"rocksdb.block.cache.data.hit", BLOCK_CACHE_DATA_HIT},
+        {"rocksdb.block.cache.data.miss", BLOCK_CACHE_DATA_MISS},
+        {"rocksdb.block.cache.index.miss", BLOCK_CACHE_INDEX_MISS},
+        {"rocksdb.block.cache.filter.miss", BLOCK_CACHE_FILTER_MISS},
+        {"rocksdb.bloom.filter.useful", BLOOM_FILTER_USEFUL},
+        {"rocksdb.memtable.hit", MEMTABLE_HIT},
+        {"rocksdb.memtable.miss", MEMTABLE_MISS},
+        {"rocksdb.bytes.read", BYTES_READ},
+        {"rocksdb.db.iter.bytes.read", ITER_BYTES_READ},
+        {"rocksdb.bytes.written", BYTES_WRITTEN},
+        {"rocksdb.compact.read.bytes", COMPACT_READ_BYTES},
+        {"rocksdb.compact.write.bytes", COMPACT_WRITE_BYTES},
+        {"rocksdb.flush.write.bytes", FLUSH_WRITE_BYTES},
+        {"rocksdb.stall.micros", STALL_MICROS},
+    };
+    // Vertices fetched per batch when pre-warming
+    static constexpr size_t PREWARM_BATCH = 4096;
+
     std::string dbPath_;
     std::string snapshotPath_;
     RocksGraph* graph_;
     std::unique_ptr<ProgressCallback> progressCallback_;
-    int errorCount_;
-    node_id_t nextVertexId_ = 1;
+    std::atomic<int> errorCount_;            // Shared by concurrent client threads
+    std::atomic<node_id_t> nextVertexId_{1};
     std::unique_ptr<NodeIdMapping<node_id_t>> nodeIdMapping_;
+    bool propertyIndexEnabled_ = false;                  // Set by the property executor (PROPERTY_INDEX)
+    std::unique_ptr<AsterPropertyIndex> propertyIndex_;  // Open while the database is open, if enabled
+
+    struct TraversalResult {
+        uint64_t visited = 0;  // Distinct vertices reached, excluding the start
+        int targetDepth = -1;  // Hops to the target, -1 if not reached
+    };
+
+    // Reused per client thread so traversals do not allocate in the timed loop
+    struct TraversalState {
+        VisitedBitmap visited;
+        std::vector<node_id_t> frontier;
+        std::vector<node_id_t> next;
+    };
+
+    static TraversalState& traversalState() {
+        static thread_local TraversalState state;
+        return state;
+    }
+
+    /**
+     * Level-synchronous BFS from start over at most maxDepth levels (0 = until the
+     * frontier is empty), stopping as soon as target is reached. Each level is
+     * one AsterNeighborBatch fetch.
+     */
+    TraversalResult traverse(node_id_t start, const std::string& direction, int maxDepth,
+                             std::optional<node_id_t> target) {
+        bool out = direction != "IN" && direction != "INCOMING";
+        bool in = direction != "OUT" && direction != "OUTGOING";
+
+        TraversalResult result;
+        if (target && *target == start) {
+            result.targetDepth = 0;
+            return result;
+        }
+
+        TraversalState& state = traversalState();
+        state.visited.clear();
+        state.frontier.clear();
+        state.visited.insert(start);
+        state.frontier.push_back(start);
+
+        for (int depth = 1; !state.frontier.empty() && (maxDepth == 0 || depth <= maxDepth); depth++) {
+            state.next.clear();
+            auto visit = [&](node_id_t neighbor) {
+                if (state.visited.insert(neighbor)) {
+                    state.next.push_back(neighbor);
+                    result.visited++;
+                }
+                return target && neighbor == *target;
+            };
+            errorCount_ += static_cast<int>(AsterNeighborBatch::fetch(graph_, state.frontier.data(), state.frontier.size(),
+                [&](node_id_t, const Edges& edges) {
+                    for (uint32_t j = 0; out && j < edges.num_edges_out; j++) {
+                        if (visit(edges.nxts_out[j].nxt)) {
+                            result.targetDepth = depth;
+                            return false;
+                        }
+                    }
+                    for (uint32_t j = 0; in && j < edges.num_edges_in; j++) {
+                        if (visit(edges.nxts_in[j].nxt)) {
+                            result.targetDepth = depth;
+                            return false;
+                        }
+                    }
+                    return true;
+                }));
+            if (result.targetDepth >= 0) {
+                return result;
+            }
+            std::swap(state.frontier, state.next);
+        }
+        return result;
+    }
+
+    /**
+     * Open the property index when enabled. It lives inside the database directory,
+     * so snapshot and restore replicate it together with the graph.
+     */
+    void openPropertyIndex() {
+        if (propertyIndexEnabled_ && !propertyIndex_) {
+            propertyIndex_ = AsterPropertyIndex::open(dbPath_ + "/property_index");
+        }
+    }
 
     template<typename ExecutorType>
     friend class AsterGraphLoader;
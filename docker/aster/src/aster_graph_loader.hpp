@@ -2,10 +2,16 @@
 
 #include <graphbench/csv_graph_reader.hpp>
 #include <graphbench/benchmark_utils.hpp>
+#include <graphbench/degree_counts.hpp>
 #include <graphbench/node_id_mapping.hpp>
+#include <graphbench/property_schema.hpp>
+#include <graphbench/type_converter.hpp>
 #include <rocksdb/graph.h>
+#include "aster_property_index.hpp"
 #include <string>
 #include <map>
+#include <vector>
+#include <algorithm>
 #include <chrono>
 #include <iostream>
 
@@ -26,10 +32,18 @@ public:
      * Load graph from dataset directory.
      * Reads nodes.csv and edges.csv and populates the Aster database.
      * Properties in CSV columns are automatically loaded if present.
+     * With sortRunEdges > 0, edges are inserted grouped by source vertex, so consecutive
+     * AddEdge calls update the same adjacency record. Edges that already arrive grouped
+     * (the binary graph cache's CSR order, source-sorted CSVs) are inserted directly;
+     * after the first out-of-order source, the rest are buffered in runs of at most
+     * sortRunEdges edges, each sorted and inserted before the next is read.
+     * When the executor has a property index open, loaded properties are added to
+     * it in bulk, typed by the dataset's type_meta.json.
      */
     static std::map<std::string, std::any> loadGraph(ExecutorType* executor,
                                                       const std::string& datasetPath,
-                                                      bool loadProperties = true) {
+                                                      bool loadProperties = true,
+                                                      size_t sortRunEdges = 0) {
         auto startTime = std::chrono::high_resolution_clock::now();
 
         if (executor->progressCallback_) {
@@ -49,60 +63,157 @@ public:
         int64_t vertexPropCount = 0;
         int64_t edgePropCount = 0;
 
-        // Load nodes and edges with properties
-        CsvGraphReader::read(
-            datasetPath,
-            // Node callback
-            [&](int64_t nodeId, const std::map<std::string, std::string>& properties) {
-                node_id_t systemId = static_cast<node_id_t>(nodeId);
-                executor->nodeIdMapping_->set(nodeId, systemId);
+        AsterPropertyIndex* index = executor->propertyIndex_.get();
+        PropertySchema schema = index ? PropertySchema::read(datasetPath) : PropertySchema();
+
+        auto addEdge = [&](node_id_t srcSystemId, node_id_t dstSystemId, auto&& propertyAt, size_t propertyCount) {
+            Status s = executor->graph_->AddEdge(srcSystemId, dstSystemId);
+            if (!s.ok()) {
+                std::cerr << "Failed to add edge " << srcSystemId << " -> " << dstSystemId
+                         << ": " << s.ToString() << std::endl;
+                return;
+            }
+            edgeCount++;
 
-                Status s = executor->graph_->AddVertex(systemId);
-                if (s.ok()) {
+            for (size_t column = 0; column < propertyCount; column++) {
+                Property prop = propertyAt(column);
+                if (prop.value.empty()) {
+                    continue;
+                }
+                Status propStatus = executor->graph_->AddEdgeProperty(srcSystemId, dstSystemId, prop);
+                if (propStatus.ok()) {
+                    edgePropCount++;
+                    if (index) {
+                        index->addEdgeProperty(srcSystemId, dstSystemId, prop.name,
+                            TypeConverter::convertFromString(prop.value, schema.edgePropertyType(prop.name)));
+                    }
+                }
+            }
+        };
+
+        // Run of out-of-order edges; property values of a run share one arena
+        struct PendingEdge {
+            node_id_t src;
+            node_id_t dst;
+            size_t row;
+        };
+        std::vector<PendingEdge> run;
+        std::string runValues;
+        std::vector<size_t> runValueEnds;
+        std::vector<std::string> edgePropertyNames;
+        bool edgesGrouped = true;
+        bool haveLastSource = false;
+        node_id_t lastSource = 0;
+        size_t sortedRuns = 0;
+
+        auto flushRun = [&]() {
+            if (run.empty()) {
+                return;
+            }
+            std::stable_sort(run.begin(), run.end(),
+                             [](const PendingEdge& a, const PendingEdge& b) { return a.src < b.src; });
+            size_t propertyCount = edgePropertyNames.size();
+            for (const PendingEdge& edge : run) {
+                addEdge(edge.src, edge.dst, [&](size_t column) {
+                    size_t cell = edge.row * propertyCount + column;
+                    size_t begin = cell == 0 ? 0 : runValueEnds[cell - 1];
+                    return Property{edgePropertyNames[column], runValues.substr(begin, runValueEnds[cell] - begin)};
+                }, propertyCount);
+            }
+            run.clear();
+            runValues.clear();
+            runValueEnds.clear();
+            sortedRuns++;
+        };
+
+        // Load nodes and edges batch by batch (parsed in parallel from the memory-mapped CSVs)
+        CsvGraphReader::readBatches(
+            datasetPath,
+            loadProperties,
+            // Node batch callback
+            [&](const CsvBatch& batch) {
+                for (size_t row = 0; row < batch.rows; row++) {
+                    int64_t nodeId = batch.id(row);
+                    node_id_t systemId = static_cast<node_id_t>(nodeId);
+                    executor->nodeIdMapping_->set(nodeId, systemId);
+
+                    Status s = executor->graph_->AddVertex(systemId);
+                    if (!s.ok()) {
+                        std::cerr << "Failed to add vertex " << systemId << ": " << s.ToString() << std::endl;
+                        continue;
+                    }
                     loadedNodeCount++;
                     if (systemId >= executor->nextVertexId_) {
                         executor->nextVertexId_ = systemId + 1;
                     }
 
-                    // Load vertex properties if enabled and properties exist
-                    if (loadProperties && !properties.empty()) {
-                        for (const auto& [key, value] : properties) {
-                            Property prop{key, value};
-                            Status propStatus = executor->graph_->AddVertexProperty(systemId, prop);
-                            if (propStatus.ok()) {
-                                vertexPropCount++;
+                    // Load vertex properties (only collected when loadProperties is set)
+                    for (size_t column = 0; column < batch.propertyColumns; column++) {
+                        if (batch.property(row, column).empty()) {
+                            continue;
+                        }
+                        Property prop{batch.propertyName(column), batch.propertyString(row, column)};
+                        Status propStatus = executor->graph_->AddVertexProperty(systemId, prop);
+                        if (propStatus.ok()) {
+                            vertexPropCount++;
+                            if (index) {
+                                index->addVertexProperty(systemId, prop.name,
+                                    TypeConverter::convertFromString(prop.value, schema.vertexPropertyType(prop.name)));
                             }
                         }
                     }
-                } else {
-                    std::cerr << "Failed to add vertex " << systemId << ": " << s.ToString() << std::endl;
                 }
             },
-            // Edge callback
-            [&](int64_t srcId, int64_t dstId, const std::map<std::string, std::string>& properties) {
-                node_id_t srcSystemId = executor->nodeIdMapping_->get(srcId, "src");
-                node_id_t dstSystemId = executor->nodeIdMapping_->get(dstId, "dst");
-
-                Status s = executor->graph_->AddEdge(srcSystemId, dstSystemId);
-                if (s.ok()) {
-                    edgeCount++;
-
-                    // Load edge properties if enabled and properties exist
-                    if (loadProperties && !properties.empty()) {
-                        for (const auto& [key, value] : properties) {
-                            Property prop{key, value};
-                            Status propStatus = executor->graph_->AddEdgeProperty(srcSystemId, dstSystemId, prop);
-                            if (propStatus.ok()) {
-                                edgePropCount++;
-                            }
+            // Edge batch callback
+            [&](const CsvBatch& batch) {
+                DegreeRecorder::recordEdges(batch);
+                for (size_t row = 0; row < batch.rows; row++) {
+                    node_id_t srcSystemId = executor->nodeIdMapping_->get(batch.id(row, 0), "src");
+                    node_id_t dstSystemId = executor->nodeIdMapping_->get(batch.id(row, 1), "dst");
+
+                    // Edge properties are only collected when loadProperties is set
+                    auto propertyAt = [&](size_t column) {
+                        return Property{batch.propertyName(column),
+                                        batch.property(row, column).empty() ? std::string() : batch.propertyString(row, column)};
+                    };
+
+                    if (sortRunEdges == 0 ||
+                        (edgesGrouped && (!haveLastSource || srcSystemId >= lastSource))) {
+                        addEdge(srcSystemId, dstSystemId, propertyAt, batch.propertyColumns);
+                        haveLastSource = true;
+                        lastSource = srcSystemId;
+                        continue;
+                    }
+
+                    if (edgesGrouped) {
+                        edgesGrouped = false;
+                        if (executor->progressCallback_) {
+                            executor->progressCallback_->sendLogMessage(
+                                "Edges are not grouped by source, sorting the rest in runs of " +
+                                std::to_string(sortRunEdges) + " edges", "INFO");
+                        }
+                    }
+                    for (size_t column = edgePropertyNames.size(); column < batch.propertyColumns; column++) {
+                        edgePropertyNames.push_back(batch.propertyName(column));
+                    }
+                    run.push_back({srcSystemId, dstSystemId, run.size()});
+                    for (size_t column = 0; column < batch.propertyColumns; column++) {
+                        if (!batch.property(row, column).empty()) {
+                            runValues += batch.propertyString(row, column);
                         }
+                        runValueEnds.push_back(runValues.size());
+                    }
+                    if (run.size() >= sortRunEdges) {
+                        flushRun();
                     }
-                } else {
-                    std::cerr << "Failed to add edge " << srcSystemId << " -> " << dstSystemId
-                             << ": " << s.ToString() << std::endl;
                 }
             }
         );
+        flushRun();
+
+        if (index) {
+            index->finishLoad();
+        }
 
         auto endTime = std::chrono::high_resolution_clock::now();
         double durationSeconds = std::chrono::duration<double>(endTime - startTime).count();
@@ -114,6 +225,12 @@ public:
                 msg += " (" + std::to_string(vertexPropCount) + " vertex props, " +
                        std::to_string(edgePropCount) + " edge props)";
             }
+            if (index) {
+                msg += ", " + std::to_string(index->loadedEntries()) + " property index entries";
+            }
+            if (sortedRuns > 0) {
+                msg += ", out-of-order edges sorted in " + std::to_string(sortedRuns) + " runs";
+            }
             msg += " in " + std::to_string(durationSeconds) + " seconds";
             executor->progressCallback_->sendLogMessage(msg, "INFO");
         }
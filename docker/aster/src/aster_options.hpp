@@ -0,0 +1,256 @@
+#pragma once
+
+#include <graphbench/benchmark_utils.hpp>
+#include <nlohmann/json.hpp>
+#include <rocksdb/cache.h>
+#include <rocksdb/filter_policy.h>
+#include <rocksdb/graph.h>
+#include <rocksdb/options.h>
+#include <rocksdb/statistics.h>
+#include <rocksdb/table.h>
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+using namespace ROCKSDB_NAMESPACE;
+
+namespace graphbench {
+
+/**
+ * Engine tuning profile for Aster, from the ENGINE_PROFILE environment variable:
+ * a JSON object that the host builds from a named profile (or a point of a profile
+ * sweep) in the database config or the workload file. Every field is optional:
+ *
+ *   name                 reported as engine_profile with the LOAD_GRAPH result
+ *   block_cache_mb       LRU block cache per open of the database (0 = RocksDB's default)
+ *   bloom_bits_per_key   bloom filter bits per key (0 = no filter)
+ *   write_buffer_mb      memtable size of the benchmark profile (default 4)
+ *   compaction_style     level (default), level_dynamic (level_compaction_dynamic_level_bytes),
+ *                        universal or fifo
+ *   background_jobs      RocksDB background flush and compaction jobs (default 2)
+ *   edge_update_policy   adaptive (default), eager or lazy
+ *   encoding             adjacency list encoding: none (default) or efp (Elias-Fano)
+ *
+ * The defaults are the settings the executor used before profiles existed.
+ */
+struct AsterProfile {
+    std::string name = "default";
+    size_t blockCacheMB = 0;
+    int bloomBitsPerKey = 0;
+    size_t writeBufferMB = 4;
+    std::string compactionStyle = "level";
+    int backgroundJobs = 2;
+    std::string edgeUpdatePolicy = "adaptive";
+    std::string encoding = "none";
+
+    static AsterProfile parse(const std::string& text) {
+        AsterProfile profile;
+        if (text.empty()) {
+            return profile;
+        }
+        nlohmann::json spec;
+        try {
+            spec = nlohmann::json::parse(text);
+        } catch (const nlohmann::json::exception& e) {
+            throw std::runtime_error("Invalid ENGINE_PROFILE: " + std::string(e.what()));
+        }
+        if (!spec.is_object()) {
+            throw std::runtime_error("ENGINE_PROFILE must be a JSON object");
+        }
+        for (const auto& [key, value] : spec.items()) {
+            if (key == "name") {
+                profile.name = value.get<std::string>();
+            } else if (key == "block_cache_mb") {
+                profile.blockCacheMB = value.get<size_t>();
+            } else if (key == "bloom_bits_per_key") {
+                profile.bloomBitsPerKey = value.get<int>();
+            } else if (key == "write_buffer_mb") {
+                profile.writeBufferMB = value.get<size_t>();
+            } else if (key == "compaction_style") {
+                profile.compactionStyle = value.get<std::string>();
+            } else if (key == "background_jobs") {
+                profile.backgroundJobs = value.get<int>();
+            } else if (key == "edge_update_policy") {
+                profile.edgeUpdatePolicy = value.get<std::string>();
+            } else if (key == "encoding") {
+                profile.encoding = value.get<std::string>();
+            } else {
+                throw std::runtime_error("Unknown engine profile field: " + key);
+            }
+        }
+        if (profile.bloomBitsPerKey < 0 || profile.writeBufferMB == 0 || profile.backgroundJobs < 1) {
+            throw std::runtime_error("Engine profile needs bloom_bits_per_key >= 0, write_buffer_mb >= 1 "
+                                     "and background_jobs >= 1");
+        }
+        // Resolve the names once, so a typo fails before the database is created
+        profile.compactionStyleValue();
+        profile.edgeUpdatePolicyValue();
+        profile.encodingValue();
+        return profile;
+    }
+
+    CompactionStyle compactionStyleValue() const {
+        if (compactionStyle == "level" || compactionStyle == "level_dynamic") {
+            return kCompactionStyleLevel;
+        }
+        if (compactionStyle == "universal") {
+            return kCompactionStyleUniversal;
+        }
+        if (compactionStyle == "fifo") {
+            return kCompactionStyleFIFO;
+        }
+        throw std::runtime_error("Unknown compaction_style: " + compactionStyle +
+                                 " (expected level, level_dynamic, universal or fifo)");
+    }
+
+    int edgeUpdatePolicyValue() const {
+        if (edgeUpdatePolicy == "adaptive") {
+            return EDGE_UPDATE_ADAPTIVE;
+        }
+        if (edgeUpdatePolicy == "eager") {
+            return EDGE_UPDATE_EAGER;
+        }
+        if (edgeUpdatePolicy == "lazy") {
+            return EDGE_UPDATE_LAZY;
+        }
+        throw std::runtime_error("Unknown edge_update_policy: " + edgeUpdatePolicy +
+                                 " (expected adaptive, eager or lazy)");
+    }
+
+    int encodingValue() const {
+        if (encoding == "none") {
+            return ENCODING_TYPE_NONE;
+        }
+        if (encoding == "efp") {
+            return ENCODING_TYPE_EFP;
+        }
+        throw std::runtime_error("Unknown encoding: " + encoding + " (expected none or efp)");
+    }
+
+    /** e.g. "default (block cache default, bloom off, write buffer 4 MB, level, 2 jobs, adaptive, none)" */
+    std::string describe() const {
+        return name + " (block cache " + (blockCacheMB ? std::to_string(blockCacheMB) + " MB" : "default") +
+               ", bloom " + (bloomBitsPerKey ? std::to_string(bloomBitsPerKey) + " bits" : "off") +
+               ", write buffer " + std::to_string(writeBufferMB) + " MB, " + compactionStyle + ", " +
+               std::to_string(backgroundJobs) + " jobs, " + edgeUpdatePolicy + ", " + encoding + ")";
+    }
+};
+
+/**
+ * RocksDB option profiles for Aster.
+ *
+ * The benchmark profile is used for every measured operation. The load profile
+ * is only active during LOAD_GRAPH: large memtables and relaxed L0 write stalls,
+ * so the load is not throttled by constant 4 MB flushes, and manual_wal_flush.
+ * RocksGraph's AddVertex/AddEdge take no WriteOptions, so the WAL cannot be
+ * disabled: every record is still written to the WAL, manual_wal_flush only keeps
+ * it in RocksDB's WAL buffer until the buffer fills instead of handing it to the
+ * OS on every write. The memtables are flushed to SST files when the database is
+ * closed after the load. Both profiles share the level shape (max_bytes_for_level_base,
+ * target_file_size_base), so reopening with the benchmark profile does not
+ * trigger a reshaping compaction during the measured phase.
+ *
+ * Both are built from the engine tuning profile (AsterProfile), which also selects
+ * the edge update policy and encoding of every RocksGraph opened with openGraph().
+ *
+ * Environment:
+ *   ENGINE_PROFILE        engine tuning profile (JSON, see AsterProfile)
+ *   LOAD_MODE             bulk (default): load profile and source-sorted edges,
+ *                         incremental: load with the benchmark profile in file order
+ *   LOAD_WRITE_BUFFER_MB  memtable size of the load profile (default 256)
+ *   LOAD_SORT_RUN_EDGES   bulk mode: edges buffered per sorted run once the input is
+ *                         found not to be grouped by source (default 1048576)
+ *   ENGINE_STATS          on: collect rocksdb::Statistics in both profiles, reported
+ *                         per batch size as engine_stats (off by default, since the
+ *                         statistics cost a few percent of throughput)
+ */
+class AsterOptions {
+public:
+    /** The tuning profile of this process, parsed from ENGINE_PROFILE on first use */
+    static const AsterProfile& profile() {
+        static const AsterProfile parsed = AsterProfile::parse(BenchmarkUtils::getEnv("ENGINE_PROFILE", ""));
+        return parsed;
+    }
+
+    /**
+     * Every call creates a new block cache, so each open of the database starts
+     * with an empty one (see resetEngineCacheImpl()).
+     */
+    static Options benchmarkProfile(bool createIfMissing) {
+        const AsterProfile& tuning = profile();
+        size_t writeBufferSize = tuning.writeBufferMB * 1024 * 1024;
+
+        Options options;
+        options.create_if_missing = createIfMissing;
+        options.compaction_style = tuning.compactionStyleValue();
+        options.level_compaction_dynamic_level_bytes = tuning.compactionStyle == "level_dynamic";
+        options.write_buffer_size = writeBufferSize;
+        options.max_bytes_for_level_base = writeBufferSize * options.max_bytes_for_level_multiplier;
+        options.max_background_jobs = tuning.backgroundJobs;
+        if (tuning.blockCacheMB > 0 || tuning.bloomBitsPerKey > 0) {
+            BlockBasedTableOptions table;
+            if (tuning.blockCacheMB > 0) {
+                table.block_cache = NewLRUCache(tuning.blockCacheMB * 1024 * 1024);
+            }
+            if (tuning.bloomBitsPerKey > 0) {
+                table.filter_policy.reset(NewBloomFilterPolicy(tuning.bloomBitsPerKey, false));
+            }
+            options.table_factory.reset(NewBlockBasedTableFactory(table));
+        }
+        options.statistics = statistics();
+        return options;
+    }
+
+    static Options loadProfile() {
+        Options options = benchmarkProfile(false);
+        options.write_buffer_size = loadWriteBufferMB() * 1024 * 1024;
+        options.max_write_buffer_number = 4;
+        options.level0_slowdown_writes_trigger = 1 << 30;
+        options.level0_stop_writes_trigger = 1 << 30;
+        options.max_background_jobs = std::max(profile().backgroundJobs, 8);
+        options.manual_wal_flush = true;
+        return options;
+    }
+
+    /**
+     * Open the graph at path with the profile's edge update policy and encoding.
+     * @param reinitialize Create the database afresh (RocksGraph auto_reinitialize)
+     */
+    static RocksGraph* openGraph(Options options, bool reinitialize, const std::string& path) {
+        const AsterProfile& tuning = profile();
+        return new RocksGraph(options, tuning.edgeUpdatePolicyValue(), tuning.encodingValue(), reinitialize, path);
+    }
+
+    /**
+     * Statistics object shared by every open of the database, so its counters keep
+     * accumulating across restores; nullptr unless ENGINE_STATS is on.
+     */
+    static std::shared_ptr<Statistics> statistics() {
+        static const std::shared_ptr<Statistics> shared = engineStatsEnabled() ? CreateDBStatistics() : nullptr;
+        return shared;
+    }
+
+    static bool bulkLoadEnabled() {
+        return BenchmarkUtils::getEnv("LOAD_MODE", "bulk") != "incremental";
+    }
+
+    static size_t loadSortRunEdges() {
+        long value = std::atol(BenchmarkUtils::getEnv("LOAD_SORT_RUN_EDGES", "1048576").c_str());
+        return value > 0 ? static_cast<size_t>(value) : 1048576;
+    }
+
+private:
+    static bool engineStatsEnabled() {
+        std::string value = BenchmarkUtils::getEnv("ENGINE_STATS", "off");
+        return value == "on" || value == "true" || value == "1";
+    }
+
+    static size_t loadWriteBufferMB() {
+        long value = std::atol(BenchmarkUtils::getEnv("LOAD_WRITE_BUFFER_MB", "256").c_str());
+        return value > 0 ? static_cast<size_t>(value) : 256;
+    }
+};
+
+} // namespace graphbench
@@ -17,67 +17,89 @@ namespace graphbench {
  * Aster property benchmark executor.
  * Extends AsterBenchmarkExecutor with property operations.
  */
-class AsterPropertyBenchmarkExecutor : public PropertyBenchmarkExecutor<AsterPropertyBenchmarkExecutor>,
+class AsterPropertyBenchmarkExecutor : public PropertyBenchmarkExecutor<AsterPropertyBenchmarkExecutor, node_id_t>,
                                        public AsterBenchmarkExecutor {
 public:
-    AsterPropertyBenchmarkExecutor() : AsterBenchmarkExecutor() {}
+    AsterPropertyBenchmarkExecutor() : AsterBenchmarkExecutor() {
+        propertyIndexEnabled_ = AsterPropertyIndex::enabled();
+    }
 
-    std::string getDatabaseNameImpl() const {
+    std::string getDatabaseNameImpl() const override {
         return "Aster (Property)";
     }
 
     // Property operation implementations
-    std::vector<double> updateVertexPropertyImpl(
-            const std::vector<std::tuple<std::any, std::string, std::string>>& updates,
-            int batchSize) {
+    // RocksGraph stores property values as strings, so typed values are written
+    // and queried through their canonical text form.
+
+    /**
+     * Update all properties of one vertex per operation.
+     * RocksGraph only exposes single-property writes, so one update issues one
+     * AddVertexProperty per key; latency is recorded per vertex update and includes
+     * re-indexing the properties when the property index is enabled.
+     */
+    std::vector<double> updateVertexPropertyImpl(BatchView<VertexUpdate<node_id_t>> updates,
+                                                 int batchSize) {
         return executeBatchOperation(updates, batchSize,
-            [this](const std::tuple<std::any, std::string, std::string>& update) {
-                const auto& [systemId, key, value] = update;
-                node_id_t nodeId = std::any_cast<node_id_t>(systemId);
-
+            [this](const VertexUpdate<node_id_t>& update) {
                 Property prop;
-                prop.name = key;
-                prop.value = value;
-
-                Status s = graph_->AddVertexProperty(nodeId, prop);
-                if (!s.ok()) {
+                for (const auto& [key, value] : update.properties) {
+                    prop.name = key;
+                    prop.value = TypeConverter::toString(value);
+                    Status s = graph_->AddVertexProperty(update.systemId, prop);
+                    if (!s.ok()) {
+                        errorCount_++;
+                        return;
+                    }
+                }
+                if (propertyIndex_ && !propertyIndex_->updateVertex(update.systemId, update.properties).ok()) {
                     errorCount_++;
                 }
             });
     }
 
-    std::vector<double> updateEdgePropertyImpl(
-            const std::vector<std::tuple<std::any, std::any, std::string, std::string>>& updates,
-            int batchSize) {
+    /**
+     * Update all properties of one edge per operation (one AddEdgeProperty per key).
+     * Aster edges carry no label, so the label is not used.
+     */
+    std::vector<double> updateEdgePropertyImpl(const std::string& label,
+                                               BatchView<EdgeUpdate<node_id_t>> updates,
+                                               int batchSize) {
         return executeBatchOperation(updates, batchSize,
-            [this](const std::tuple<std::any, std::any, std::string, std::string>& update) {
-                const auto& [srcSystemId, dstSystemId, key, value] = update;
-                node_id_t src = std::any_cast<node_id_t>(srcSystemId);
-                node_id_t dst = std::any_cast<node_id_t>(dstSystemId);
-
+            [this](const EdgeUpdate<node_id_t>& update) {
                 Property prop;
-                prop.name = key;
-                prop.value = value;
-
-                Status s = graph_->AddEdgeProperty(src, dst, prop);
-                if (!s.ok()) {
+                for (const auto& [key, value] : update.properties) {
+                    prop.name = key;
+                    prop.value = TypeConverter::toString(value);
+                    Status s = graph_->AddEdgeProperty(update.srcSystemId, update.dstSystemId, prop);
+                    if (!s.ok()) {
+                        errorCount_++;
+                        return;
+                    }
+                }
+                if (propertyIndex_ &&
+                    !propertyIndex_->updateEdge(update.srcSystemId, update.dstSystemId, update.properties).ok()) {
                     errorCount_++;
                 }
             });
     }
 
-    std::vector<double> getVertexByPropertyImpl(
-            const std::vector<std::pair<std::string, std::string>>& queries,
-            int batchSize) {
+    /**
+     * Look up vertices by property: a prefix scan of the property index when it is
+     * enabled, otherwise RocksGraph's GetVerticesWithProperty.
+     */
+    std::vector<double> getVertexByPropertyImpl(BatchView<PropertyQuery> queries, int batchSize) {
         return executeBatchOperation(queries, batchSize,
-            [this](const std::pair<std::string, std::string>& query) {
-                const auto& [key, value] = query;
-
-                Property prop;
-                prop.name = key;
-                prop.value = value;
-
-                std::vector<node_id_t> results = graph_->GetVerticesWithProperty(prop);
+            [this](const PropertyQuery& query) {
+                std::vector<node_id_t> results;
+                if (propertyIndex_) {
+                    results = propertyIndex_->findVertices(query.key, query.value);
+                } else {
+                    Property prop;
+                    prop.name = query.key;
+                    prop.value = TypeConverter::toString(query.value);
+                    results = graph_->GetVerticesWithProperty(prop);
+                }
 
                 // Consume results
                 for (const auto& nodeId : results) {
@@ -87,18 +109,22 @@ public:
             });
     }
 
-    std::vector<double> getEdgeByPropertyImpl(
-            const std::vector<std::pair<std::string, std::string>>& queries,
-            int batchSize) {
+    /**
+     * Look up edges by property: a prefix scan of the property index when it is
+     * enabled, otherwise RocksGraph's GetEdgesWithProperty.
+     */
+    std::vector<double> getEdgeByPropertyImpl(BatchView<PropertyQuery> queries, int batchSize) {
         return executeBatchOperation(queries, batchSize,
-            [this](const std::pair<std::string, std::string>& query) {
-                const auto& [key, value] = query;
-
-                Property prop;
-                prop.name = key;
-                prop.value = value;
-
-                std::vector<std::pair<node_id_t, node_id_t>> results = graph_->GetEdgesWithProperty(prop);
+            [this](const PropertyQuery& query) {
+                std::vector<std::pair<node_id_t, node_id_t>> results;
+                if (propertyIndex_) {
+                    results = propertyIndex_->findEdges(query.key, query.value);
+                } else {
+                    Property prop;
+                    prop.name = query.key;
+                    prop.value = TypeConverter::toString(query.value);
+                    results = graph_->GetEdgesWithProperty(prop);
+                }
 
                 // Consume results
                 for (const auto& edge : results) {
@@ -0,0 +1,283 @@
+#pragma once
+
+#include <graphbench/benchmark_utils.hpp>
+#include <graphbench/type_converter.hpp>
+#include <rocksdb/db.h>
+#include <rocksdb/graph.h>
+#include <any>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace ROCKSDB_NAMESPACE;
+
+namespace graphbench {
+
+/**
+ * Secondary property index for Aster, kept in its own RocksDB instance next to the
+ * RocksGraph data (RocksGraph does not expose its DB handle, so the index cannot
+ * share it).
+ *
+ * Column families:
+ *   vertex_property_index  name \0 value \0 vertexId           -> ""
+ *   edge_property_index    name \0 value \0 srcId dstId        -> ""
+ *   vertex_property_values name \0 vertexId                    -> value
+ *   edge_property_values   name \0 srcId dstId                 -> value
+ *
+ * IDs are 8-byte big-endian so the entries of one (name, value) term are one
+ * contiguous, ordered key range. Values are encoded with a type tag and the
+ * canonical text of the typed value (TypeConverter), so "5" stored in an integer
+ * column and the integer query 5 hit the same term. The *_values families hold the
+ * current value of every indexed property, which updates need to remove the old
+ * term in the same write batch as they add the new one.
+ *
+ * Enabled with PROPERTY_INDEX=on for the aster-property executor.
+ */
+class AsterPropertyIndex {
+public:
+    using EdgeId = std::pair<node_id_t, node_id_t>;
+
+    static bool enabled() {
+        std::string value = BenchmarkUtils::getEnv("PROPERTY_INDEX", "off");
+        return value == "on" || value == "true" || value == "1";
+    }
+
+    /**
+     * Open (or create) the index at path.
+     */
+    static std::unique_ptr<AsterPropertyIndex> open(const std::string& path) {
+        DBOptions options;
+        options.create_if_missing = true;
+        options.create_missing_column_families = true;
+
+        ColumnFamilyOptions familyOptions;
+        std::vector<ColumnFamilyDescriptor> descriptors = {
+            ColumnFamilyDescriptor(kDefaultColumnFamilyName, familyOptions),
+            ColumnFamilyDescriptor("vertex_property_index", familyOptions),
+            ColumnFamilyDescriptor("edge_property_index", familyOptions),
+            ColumnFamilyDescriptor("vertex_property_values", familyOptions),
+            ColumnFamilyDescriptor("edge_property_values", familyOptions)
+        };
+
+        std::unique_ptr<AsterPropertyIndex> index(new AsterPropertyIndex());
+        DB* db = nullptr;
+        Status s = DB::Open(options, path, descriptors, &index->handles_, &db);
+        if (!s.ok()) {
+            throw std::runtime_error("Failed to open property index at " + path + ": " + s.ToString());
+        }
+        index->db_ = db;
+        return index;
+    }
+
+    ~AsterPropertyIndex() {
+        if (!db_) {
+            return;
+        }
+        for (ColumnFamilyHandle* handle : handles_) {
+            db_->DestroyColumnFamilyHandle(handle);
+        }
+        db_->Close();
+        delete db_;
+    }
+
+    AsterPropertyIndex(const AsterPropertyIndex&) = delete;
+    AsterPropertyIndex& operator=(const AsterPropertyIndex&) = delete;
+
+    // ---- Bulk build (single loader thread) ----
+
+    /** Queue the index entries of a loaded vertex property */
+    void addVertexProperty(node_id_t vertexId, const std::string& name, const std::any& value) {
+        std::string encoded = encodeValue(value);
+        loadBatch_.Put(handles_[VERTEX_INDEX], termKey(name, encoded) + encodeId(vertexId), Slice());
+        loadBatch_.Put(handles_[VERTEX_VALUES], name + '\0' + encodeId(vertexId), encoded);
+        flushLoadBatchIfFull();
+    }
+
+    /** Queue the index entries of a loaded edge property */
+    void addEdgeProperty(node_id_t src, node_id_t dst, const std::string& name, const std::any& value) {
+        std::string encoded = encodeValue(value);
+        std::string edgeId = encodeId(src) + encodeId(dst);
+        loadBatch_.Put(handles_[EDGE_INDEX], termKey(name, encoded) + edgeId, Slice());
+        loadBatch_.Put(handles_[EDGE_VALUES], name + '\0' + edgeId, encoded);
+        flushLoadBatchIfFull();
+    }
+
+    /**
+     * Write the remaining bulk entries and flush all column families to SST files.
+     * Bulk writes skip the WAL; this flush is what makes them durable.
+     */
+    void finishLoad() {
+        writeLoadBatch();
+        FlushOptions flushOptions;
+        flushOptions.wait = true;
+        for (ColumnFamilyHandle* handle : handles_) {
+            db_->Flush(flushOptions, handle);
+        }
+    }
+
+    /** Entries written by the bulk build (inverted and value entries) */
+    size_t loadedEntries() const { return loadedEntries_; }
+
+    // ---- Maintenance ----
+
+    /**
+     * Re-index the updated properties of one vertex in a single write batch.
+     */
+    Status updateVertex(node_id_t vertexId, const std::map<std::string, std::any>& properties) {
+        std::string id = encodeId(vertexId);
+        WriteBatch batch;
+        for (const auto& [name, value] : properties) {
+            Status s = stageUpdate(batch, VERTEX_INDEX, VERTEX_VALUES, name, id, encodeValue(value));
+            if (!s.ok()) {
+                return s;
+            }
+        }
+        return db_->Write(WriteOptions(), &batch);
+    }
+
+    /**
+     * Re-index the updated properties of one edge in a single write batch.
+     */
+    Status updateEdge(node_id_t src, node_id_t dst, const std::map<std::string, std::any>& properties) {
+        std::string id = encodeId(src) + encodeId(dst);
+        WriteBatch batch;
+        for (const auto& [name, value] : properties) {
+            Status s = stageUpdate(batch, EDGE_INDEX, EDGE_VALUES, name, id, encodeValue(value));
+            if (!s.ok()) {
+                return s;
+            }
+        }
+        return db_->Write(WriteOptions(), &batch);
+    }
+
+    // ---- Lookup ----
+
+    /** Vertices whose property name equals value (one prefix scan) */
+    std::vector<node_id_t> findVertices(const std::string& name, const std::any& value) const {
+        std::vector<node_id_t> result;
+        scanTerm(VERTEX_INDEX, termKey(name, encodeValue(value)), [&result](const char* id) {
+            result.push_back(decodeId(id));
+        });
+        return result;
+    }
+
+    /** Edges whose property name equals value (one prefix scan) */
+    std::vector<EdgeId> findEdges(const std::string& name, const std::any& value) const {
+        std::vector<EdgeId> result;
+        scanTerm(EDGE_INDEX, termKey(name, encodeValue(value)), [&result](const char* id) {
+            result.emplace_back(decodeId(id), decodeId(id + sizeof(node_id_t)));
+        });
+        return result;
+    }
+
+private:
+    // Index into handles_, in descriptor order
+    static constexpr size_t VERTEX_INDEX = 1;
+    static constexpr size_t EDGE_INDEX = 2;
+    static constexpr size_t VERTEX_VALUES = 3;
+    static constexpr size_t EDGE_VALUES = 4;
+
+    static constexpr size_t LOAD_BATCH_ENTRIES = 100000;
+
+    DB* db_ = nullptr;
+    std::vector<ColumnFamilyHandle*> handles_;
+    WriteBatch loadBatch_;
+    size_t loadBatchEntries_ = 0;
+    size_t loadedEntries_ = 0;
+
+    AsterPropertyIndex() = default;
+
+    static std::string encodeValue(const std::any& value) {
+        char tag = 's';
+        if (value.type() == typeid(int) || value.type() == typeid(int64_t)) {
+            tag = 'i';
+        } else if (value.type() == typeid(float) || value.type() == typeid(double)) {
+            tag = 'f';
+        } else if (value.type() == typeid(bool)) {
+            tag = 'b';
+        } else if (!value.has_value()) {
+            tag = 'n';
+        }
+        return tag + TypeConverter::toString(value);
+    }
+
+    static std::string termKey(const std::string& name, const std::string& encodedValue) {
+        std::string key;
+        key.reserve(name.size() + encodedValue.size() + 2 + 2 * sizeof(node_id_t));
+        key.append(name).push_back('\0');
+        key.append(encodedValue).push_back('\0');
+        return key;
+    }
+
+    static std::string encodeId(node_id_t id) {
+        std::string out(sizeof(node_id_t), '\0');
+        uint64_t bits = static_cast<uint64_t>(id);
+        for (size_t i = 0; i < sizeof(node_id_t); i++) {
+            out[sizeof(node_id_t) - 1 - i] = static_cast<char>(bits & 0xFF);
+            bits >>= 8;
+        }
+        return out;
+    }
+
+    static node_id_t decodeId(const char* data) {
+        uint64_t bits = 0;
+        for (size_t i = 0; i < sizeof(node_id_t); i++) {
+            bits = (bits << 8) | static_cast<unsigned char>(data[i]);
+        }
+        return static_cast<node_id_t>(bits);
+    }
+
+    Status stageUpdate(WriteBatch& batch, size_t indexFamily, size_t valuesFamily, const std::string& name,
+                       const std::string& id, const std::string& encoded) {
+        std::string valueKey = name + '\0' + id;
+        std::string previous;
+        Status s = db_->Get(ReadOptions(), handles_[valuesFamily], valueKey, &previous);
+        if (s.ok()) {
+            if (previous == encoded) {
+                return s;
+            }
+            batch.Delete(handles_[indexFamily], termKey(name, previous) + id);
+        } else if (!s.IsNotFound()) {
+            return s;
+        }
+        batch.Put(handles_[indexFamily], termKey(name, encoded) + id, Slice());
+        batch.Put(handles_[valuesFamily], valueKey, encoded);
+        return Status::OK();
+    }
+
+    template<typename Consumer>
+    void scanTerm(size_t family, const std::string& prefix, Consumer consume) const {
+        ReadOptions readOptions;
+        std::unique_ptr<Iterator> it(db_->NewIterator(readOptions, handles_[family]));
+        for (it->Seek(prefix); it->Valid() && it->key().starts_with(prefix); it->Next()) {
+            consume(it->key().data() + prefix.size());
+        }
+    }
+
+    void flushLoadBatchIfFull() {
+        loadBatchEntries_ += 2;
+        if (loadBatchEntries_ >= LOAD_BATCH_ENTRIES) {
+            writeLoadBatch();
+        }
+    }
+
+    void writeLoadBatch() {
+        if (loadBatchEntries_ == 0) {
+            return;
+        }
+        WriteOptions writeOptions;
+        writeOptions.disableWAL = true;
+        Status s = db_->Write(writeOptions, &loadBatch_);
+        if (!s.ok()) {
+            throw std::runtime_error("Failed to write property index batch: " + s.ToString());
+        }
+        loadedEntries_ += loadBatchEntries_;
+        loadBatch_.Clear();
+        loadBatchEntries_ = 0;
+    }
+};
+
+} // namespace graphbench
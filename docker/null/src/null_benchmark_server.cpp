@@ -0,0 +1,33 @@
+#include <graphbench/null_benchmark_executor.hpp>
+#include <graphbench/benchmark_main.hpp>
+
+using namespace graphbench;
+
+/**
+ * Register the reference executors (no database) and start server.
+ * This file only contains executor registration - main() is in common-cpp.
+ */
+
+// No-op executor: the harness floor
+static bool registered_null = []() {
+    ExecutorRegistry<NullBenchmarkExecutor>::registerExecutor(
+        "null",
+        "Null",
+        []() { return std::make_unique<NullBenchmarkExecutor>(NullBenchmarkExecutor::Storage::NONE); }
+    );
+    return true;
+}();
+
+// In-memory CSR executor: the speed-of-light baseline
+static bool registered_csr = []() {
+    ExecutorRegistry<NullBenchmarkExecutor>::registerExecutor(
+        "csr",
+        "In-memory CSR",
+        []() { return std::make_unique<NullBenchmarkExecutor>(NullBenchmarkExecutor::Storage::CSR); }
+    );
+    return true;
+}();
+
+int main(int argc, char* argv[]) {
+    return benchmarkMain<NullBenchmarkExecutor>(argc, argv);
+}
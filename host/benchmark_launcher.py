@@ -8,10 +8,11 @@ import os
 import sys
 import requests
 from pathlib import Path
-from typing import List, Dict, Any, Optional
+from typing import List, Dict, Any, Optional, Tuple
 
 from compiler.workload_compiler import WorkloadCompiler
 from db.docker_manager import DockerManager
+from db.engine_profiles import EngineProfiles
 from report.report_generator import ReportGenerator
 from dataset.dataset_loader import DatasetLoader
 from progress_server import ProgressServer
@@ -37,6 +38,7 @@ class BenchmarkLauncher:
         self.docker_manager = DockerManager(self.database_config, args.rebuild)
         self.workload_compiler = WorkloadCompiler(self.database_config)
         self.dataset_loader = DatasetLoader(self.dataset_config)
+        self.engine_profiles = EngineProfiles(self.database_config, self.workload_config)
 
         # Store current container for timeout handling
         self.current_container = None
@@ -55,6 +57,24 @@ class BenchmarkLauncher:
         print("❌ Error: No dataset specified. Use --dataset-name to specify dataset(s)")
         sys.exit(1)
 
+    def _get_dataset_runs(self, datasets: List[str]) -> List[Tuple[str, str, Optional[int]]]:
+        """
+        (dataset, run name, scale) for every dataset run. The workload option "scales"
+        sweeps the scale of synthetic datasets; each scale runs as its own dataset
+        "<dataset>-s<scale>", so every database gets one report per graph size.
+        """
+        scales = self.workload_config.get('scales')
+        runs = []
+        for dataset_name in datasets:
+            if not self.dataset_loader.is_synthetic(dataset_name):
+                if scales:
+                    print(f"⚠️  Warning: 'scales' only applies to synthetic datasets, ignored for '{dataset_name}'")
+                runs.append((dataset_name, dataset_name, None))
+                continue
+            for scale in scales or [self.dataset_loader.get_synthetic_spec(dataset_name)['scale']]:
+                runs.append((dataset_name, f"{dataset_name}-s{scale}", scale))
+        return runs
+
     def _get_workloads_to_test(self) -> List[str]:
         """Get list of workload configs to test"""
         if self.args.workload_name:
@@ -76,6 +96,15 @@ class BenchmarkLauncher:
                 print(f"❌ Error: Database '{db_name}' not found in configuration")
                 sys.exit(1)
 
+        # One run (and report) per database and engine profile, named "<database>@<profile>" in a profile sweep
+        try:
+            database_runs = [(db_name, run_name, profile)
+                             for db_name in self.database_names
+                             for run_name, profile in self.engine_profiles.get_runs(db_name)]
+        except ValueError as e:
+            print(f"❌ Error: {e}")
+            sys.exit(1)
+
         # Get workload name and mode from config
         workload_name = self.workload_config.get('name', 'unnamed_workload')
         mode = self.workload_config.get('mode', 'structural')
@@ -101,51 +130,62 @@ class BenchmarkLauncher:
         callback_url = progress_server.get_callback_url()
 
         try:
-            # Get datasets to test
-            datasets = self._get_datasets_to_test()
+            # Get datasets to test (one run per scale of a swept synthetic dataset)
+            dataset_runs = self._get_dataset_runs(self._get_datasets_to_test())
 
             # Calculate total number of tasks
-            total_tasks = len(datasets) * len(self.database_names)
+            total_tasks = len(dataset_runs) * len(database_runs)
             current_task = 0
 
             # Outer loop: iterate over datasets
-            for dataset_name in datasets:
+            for source_dataset, dataset_name, scale in dataset_runs:
                 print(f"\n{'='*80}")
                 print(f"📊 Dataset: {dataset_name}")
                 print(f"{'='*80}")
 
                 # Get dataset path
-                dataset_path = self.dataset_loader.get_dataset_path(dataset_name)
+                dataset_path = self.dataset_loader.get_dataset_path(source_dataset, scale)
                 if not dataset_path:
                     print(f"⚠️  Warning: Dataset '{dataset_name}' not found, skipping...")
                     continue
+                synthetic = self.dataset_loader.is_synthetic(source_dataset)
 
-                # Compile workload ONCE per dataset (database-agnostic)
+                # Compile workload ONCE per dataset (database-agnostic); the runtimes that
+                # will read it pick the default parameter format
+                runtimes = {self.database_config[db_name].get('runtime') for db_name, _, _ in database_runs}
+                if synthetic:
+                    runtimes &= {'cpp'}
                 print(f"\n⚙️  Compiling workload for dataset '{dataset_name}'...")
                 compiled_dir = self.workload_compiler.compile_workload(
                     self.workload_config,
                     dataset_name,
                     self.args.seed,
-                    dataset_path
+                    dataset_path,
+                    runtimes
                 )
                 print(f"✓ Workload compiled to: {compiled_dir}")
 
-                # Inner loop: iterate over databases using the same compiled workload
-                for database_name in self.database_names:
+                # Inner loop: iterate over databases (and their engine profiles) using the same compiled workload
+                for database_name, run_name, engine_profile in database_runs:
                     current_task += 1
                     print(f"\n{'-'*80}")
-                    print(f"🗄️  Database: {database_name} ({current_task}/{total_tasks})")
+                    print(f"🗄️  Database: {run_name} ({current_task}/{total_tasks})")
                     print(f"{'-'*80}")
 
                     # Check if report already exists
-                    if not self.args.force_rerun and self._check_report_exists(database_name, dataset_name, workload_name):
-                        report_file = self.output_dir / f"bench_{database_name}_{dataset_name}_{workload_name}.json"
+                    if not self.args.force_rerun and self._check_report_exists(run_name, dataset_name, workload_name):
+                        report_file = self.output_dir / f"bench_{run_name}_{dataset_name}_{workload_name}.json"
                         print(f"⏭️  Skipping: Report already exists at {report_file}")
                         print(f"   Use --force-rerun to override")
                         continue
 
                     db_config = self.database_config[database_name]
 
+                    # Synthetic graphs are generated by the C++ loaders only
+                    if synthetic and db_config.get('runtime') != 'cpp':
+                        print(f"⏭️  Skipping: synthetic datasets are not supported by the {db_config.get('runtime')} backends")
+                        continue
+
                     # Build/rebuild Docker image if needed
                     print(f"📦 Preparing Docker image: {db_config['docker_image']}")
                     self.docker_manager.prepare_image(database_name, self.args.rebuild)
@@ -157,7 +197,8 @@ class BenchmarkLauncher:
                         dataset_path,
                         compiled_dir,
                         callback_url,
-                        mode=mode
+                        mode=mode,
+                        engine_profile=engine_profile
                     )
 
                     # Store container for timeout handling
@@ -178,9 +219,13 @@ class BenchmarkLauncher:
                         if 'metadata' not in results:
                             results['metadata'] = {}
                         results['metadata']['workload'] = workload_name
+                        if synthetic:
+                            results['metadata']['synthetic'] = self.dataset_loader.get_synthetic_spec(source_dataset, scale)
+                        if engine_profile is not None:
+                            results['metadata']['engine_profile'] = engine_profile
 
                         # Save results
-                        output_file = self.output_dir / f"bench_{database_name}_{dataset_name}_{workload_name}.json"
+                        output_file = self.output_dir / f"bench_{run_name}_{dataset_name}_{workload_name}.json"
                         with open(output_file, 'w') as f:
                             json.dump(results, f, indent=2)
 
@@ -190,6 +235,17 @@ class BenchmarkLauncher:
                         # Handle timeout or other errors
                         error_type = type(e).__name__
                         print(f"❌ Benchmark execution failed: {error_type}")
+                        partial = getattr(e, 'results', None)
+                        if partial and partial.get('results'):
+                            partial.setdefault('metadata', {})['workload'] = workload_name
+                            partial['metadata']['partial'] = True
+                            partial['metadata']['error'] = str(e)
+                            if engine_profile is not None:
+                                partial['metadata']['engine_profile'] = engine_profile
+                            partial_file = self.output_dir / f"bench_{run_name}_{dataset_name}_{workload_name}.partial.json"
+                            with open(partial_file, 'w') as f:
+                                json.dump(partial, f, indent=2)
+                            print(f"💾 Results of {len(partial['results'])} finished tasks saved to: {partial_file}")
                         if "timeout" in str(e).lower() or "timed out" in str(e).lower():
                             print(f"⚠️  This was likely caused by a subtask timeout.")
                             print(f"⚠️  Partial results may have been lost.")
@@ -4,14 +4,54 @@ WorkloadCompiler - Optimized for "Reset/Restore" Benchmark Model
 import csv
 import json
 import random
+import struct
+import sys
+from array import array
 from pathlib import Path
-from typing import Dict, Any, List, Optional, Tuple
+from typing import Dict, Any, List, Optional, Set, Tuple
 import pandas as pd
 
-STRUCTURAL_TASKS = {'load_graph', 'add_vertex', 'remove_vertex', 'add_edge', 'remove_edge', 'get_nbrs'}
+from dataset.synthetic_graph import SyntheticGraph
+
+STRUCTURAL_TASKS = {'load_graph', 'add_vertex', 'remove_vertex', 'add_edge', 'remove_edge', 'get_nbrs', 'mixed',
+                    'k_hop', 'bfs', 'shortest_path'}
 PROPERTY_TASKS = {'load_graph', 'update_vertex_property', 'update_edge_property',
                   'get_vertex_by_property', 'get_edge_by_property'}
 
+# Task names used by latency/throughput templates, mapped to the task they compile to
+TASK_ALIASES = {
+    'add_nodes_latency': 'add_vertex',
+    'add_edges_latency': 'add_edge',
+    'delete_nodes_latency': 'remove_vertex',
+    'delete_edges_latency': 'remove_edge',
+    'read_nbrs_latency': 'get_nbrs',
+    'read_nbrs_throughput': 'get_nbrs',
+    'read_nbrs_saturation': 'get_nbrs',
+    'mixed_workload_latency': 'mixed',
+}
+
+# Operation names accepted in a mixed task's "ratios", mapped to the operation they generate
+MIXED_RATIO_ALIASES = {
+    'add_node': 'add_vertex',
+    'delete_node': 'remove_vertex',
+    'delete_edge': 'remove_edge',
+    'read_nbrs': 'get_nbrs',
+}
+MIXED_OPS = ('add_vertex', 'add_edge', 'remove_vertex', 'remove_edge', 'get_nbrs')
+
+# Tasks whose "ids" the C++ backends can sample from a distribution (task option "distribution")
+SAMPLED_ID_TASKS = ('get_nbrs', 'remove_vertex', 'k_hop', 'bfs')
+SAMPLE_DISTRIBUTIONS = ('uniform', 'zipf', 'hotspot', 'degree')
+
+# Binary parameter sidecar (see common-cpp binary_parameters.hpp): magic, value count, little-endian int64 values
+PARAMETER_FILE_MAGIC = b'GBPARAM1'
+PARAMETER_FORMATS = ('binary', 'json')
+
+
+def resolve_task_name(name: str) -> str:
+    return TASK_ALIASES.get(name, name)
+
+
 class WorkloadCompiler:
     def __init__(self, database_config: Dict[str, Any]):
         self.database_config = database_config
@@ -38,17 +78,25 @@ class WorkloadCompiler:
         workload_config: Dict[str, Any],
         dataset_name: str,
         seed: Optional[int] = None,
-        dataset_path: Optional[Path] = None
+        dataset_path: Optional[Path] = None,
+        runtimes: Optional[Set[str]] = None
     ) -> Path:
         if seed is not None:
             random.seed(seed)
 
+        # Binary sidecars only pay off when every backend reading this workload is a C++ one:
+        # the Java backends expand them back into boxed lists
+        default_format = 'binary' if runtimes == {'cpp'} else 'json'
+        parameter_format = workload_config.get('parameter_format', default_format)
+        if parameter_format not in PARAMETER_FORMATS:
+            raise ValueError(f"Unknown parameter_format '{parameter_format}'. Valid formats: {PARAMETER_FORMATS}")
+
         # Validate mode
         mode = workload_config.get('mode', 'structural')
         valid_tasks = STRUCTURAL_TASKS if mode == 'structural' else PROPERTY_TASKS
         tasks = workload_config.get('tasks', [])
         for task in tasks:
-            if task['name'] not in valid_tasks:
+            if resolve_task_name(task['name']) not in valid_tasks:
                 raise ValueError(
                     f"Task '{task['name']}' is not valid for mode '{mode}'. "
                     f"Valid tasks: {valid_tasks}"
@@ -71,15 +119,56 @@ class WorkloadCompiler:
             workload_data = self._compile_task(task)
 
             output_file = output_dir / f"{idx:02d}_{task_name}.json"
+            if parameter_format == 'binary':
+                self._write_parameter_file(workload_data, output_file.with_suffix('.bin'))
             with open(output_file, 'w') as f:
                 json.dump(workload_data, f, indent=2)
 
         return output_dir
 
+    def _write_parameter_file(self, workload_data: Dict[str, Any], bin_file: Path):
+        """
+        Move the "ids" and "pairs" arrays of the parameters (including the pools of a mixed task)
+        into a binary sidecar and leave {"$binary": {offset, count, width}} references in their place.
+        Pairs are stored interleaved as src, dst. Nothing is written when there is nothing to move.
+        """
+        values = array('q')
+
+        def offload(parameters: Dict[str, Any]):
+            for key, value in parameters.items():
+                if isinstance(value, dict):
+                    offload(value)
+                elif key in ('ids', 'pairs') and isinstance(value, list) and value:
+                    width = 1 if key == 'ids' else 2
+                    offset = len(PARAMETER_FILE_MAGIC) + 8 + values.itemsize * len(values)
+                    if width == 1:
+                        values.extend(value)
+                    else:
+                        for pair in value:
+                            values.append(pair['src'])
+                            values.append(pair['dst'])
+                    parameters[key] = {"$binary": {"offset": offset, "count": len(value), "width": width}}
+
+        offload(workload_data.get('parameters', {}))
+        if not values:
+            return
+        if sys.byteorder != 'little':
+            values.byteswap()
+        with open(bin_file, 'wb') as f:
+            f.write(PARAMETER_FILE_MAGIC)
+            f.write(struct.pack('<Q', len(values)))
+            values.tofile(f)
+        workload_data['parameters_file'] = bin_file.name
+
     def _scan_dataset(self, dataset_path: Path):
         """Scan dataset directory containing nodes.csv and edges.csv using pandas for speed"""
         dataset_dir = Path(dataset_path)
 
+        synthetic = SyntheticGraph.open(dataset_dir)
+        if synthetic:
+            self._scan_synthetic(synthetic)
+            return
+
         # Scan nodes.csv with pandas
         nodes_file = dataset_dir / 'nodes.csv'
         print(f"Scanning nodes: {nodes_file}...")
@@ -156,15 +245,37 @@ class WorkloadCompiler:
         if self.edge_property_keys:
             print(f"  Edge properties: {self.edge_property_keys}")
 
+    def _scan_synthetic(self, graph: SyntheticGraph):
+        """Sample a synthetic dataset by generating the sampled edges the way the backends load them"""
+        print(f"Sampling synthetic {graph.generator} graph (scale {graph.scale}, edge factor {graph.edge_factor})...")
+        node_count = graph.node_count
+        edge_count = graph.edge_count
+        self.node_property_keys = []
+        self.edge_property_keys = []
+        self.sampled_node_props = {}
+        self.sampled_edge_props = {}
+        self.max_dataset_id = node_count - 1
+        self.sampled_nodes = random.sample(range(node_count), min(node_count, self.SAMPLE_SIZE))
+        self.sampled_edges = [graph.edge(i) for i in random.sample(range(edge_count), min(edge_count, self.SAMPLE_SIZE))]
+        print(f"Baseline Scanned. Nodes: {node_count}, Edges: {edge_count}, Max ID: {self.max_dataset_id}")
+
     def _compile_task(self, task: Dict[str, Any]) -> Dict[str, Any]:
-        task_name = task['name']
+        task_name = resolve_task_name(task['name'])
         ops = task.get('ops', 0)
         batch_sizes = task.get('batch_sizes', None)
+        client_threads = task.get('client_threads', None)
+        target_ops_per_sec = task.get('target_ops_per_sec', None)
+        distribution = task.get('distribution', None)
+        # Sampled IDs are drawn by the backend, so tasks with a distribution list none
+        listed_ops = 0 if distribution is not None and task_name in SAMPLED_ID_TASKS else ops
+        run_options = {key: task[key] for key in ('warmup_ops', 'trials', 'steady_state_window', 'steady_state_cv',
+                                                    'cache_mode')
+                         if key in task}
 
         if task_name == 'add_vertex':
             result = self._compile_add_vertex(ops)
         elif task_name == 'remove_vertex':
-            result = self._compile_remove_vertex(ops)
+            result = self._compile_remove_vertex(listed_ops)
         elif task_name == 'add_edge':
             result = self._compile_add_edge(ops)
         elif task_name == 'remove_edge':
@@ -176,12 +287,28 @@ class WorkloadCompiler:
             is_write = (task_name == 'update_edge_property')
             result = self._compile_property_task(ops, is_edge=True, is_write=is_write)
         elif task_name == 'get_nbrs':
-            result = self._compile_get_nbrs(ops, task.get('direction', 'OUT'))
+            result = self._compile_get_nbrs(listed_ops, task.get('direction', 'OUT'))
+        elif task_name == 'k_hop':
+            result = self._compile_traversal('K_HOP', listed_ops, task.get('direction', 'OUT'), 'depth', task.get('depth', 2))
+        elif task_name == 'bfs':
+            result = self._compile_traversal('BFS', listed_ops, task.get('direction', 'OUT'), 'max_depth', task.get('max_depth', 0))
+        elif task_name == 'shortest_path':
+            result = self._compile_shortest_path(ops, task.get('direction', 'OUT'), task.get('max_depth', 0))
+        elif task_name == 'mixed':
+            result = self._compile_mixed(ops, task.get('ratios', {}), task.get('direction', 'OUT'))
         else:
             return {"task_type": task_name.upper(), "ops_count": 0, "parameters": {}}
 
+        if distribution is not None:
+            self._apply_distribution(result, task_name, distribution, ops, task.get('direction', 'OUT'))
+
         if batch_sizes is not None:
             result['batch_sizes'] = batch_sizes
+        if client_threads is not None:
+            result['client_threads'] = client_threads
+        if target_ops_per_sec is not None:
+            result['target_ops_per_sec'] = target_ops_per_sec
+        result.update(run_options)
         return result
 
     # --- Logic implementation for Restore Mechanism ---
@@ -292,6 +419,86 @@ class WorkloadCompiler:
             "parameters": {"direction": direction, "ids": ids}
         }
 
+    def _compile_traversal(self, task_type: str, ops: int, direction: str, depth_key: str, depth: int) -> Dict[str, Any]:
+        ids = [self._sample_existing_node() for _ in range(ops)]
+        return {
+            "task_type": task_type,
+            "ops_count": ops,
+            "parameters": {"direction": direction, depth_key: depth, "ids": ids}
+        }
+
+    def _compile_shortest_path(self, ops: int, direction: str, max_depth: int) -> Dict[str, Any]:
+        pairs = [{"src": self._sample_existing_node(), "dst": self._sample_existing_node()} for _ in range(ops)]
+        return {
+            "task_type": "SHORTEST_PATH",
+            "ops_count": ops,
+            "parameters": {"direction": direction, "max_depth": max_depth, "pairs": pairs}
+        }
+
+    def _compile_mixed(self, ops: int, ratios: Dict[str, float], direction: str) -> Dict[str, Any]:
+        """
+        Split ops across operation types by ratio and emit one parameter pool per type.
+        The executor interleaves the pools into a single operation stream using the seed.
+        """
+        weights: Dict[str, float] = {}
+        for name, ratio in ratios.items():
+            op = MIXED_RATIO_ALIASES.get(name, name)
+            if op not in MIXED_OPS:
+                raise ValueError(f"Unknown mixed operation '{name}'. Valid operations: {MIXED_OPS}")
+            weights[op] = weights.get(op, 0.0) + float(ratio)
+        total_weight = sum(weights.values())
+        if total_weight <= 0:
+            raise ValueError("Mixed task requires at least one positive ratio")
+
+        counts = {op: int(round(ops * weight / total_weight)) for op, weight in weights.items()}
+        parameters: Dict[str, Any] = {
+            "label": "MyEdge",
+            "direction": direction,
+            "seed": random.randint(0, 2**31 - 1),
+            "ratios": {op: weight / total_weight for op, weight in weights.items()},
+        }
+        if counts.get('add_vertex'):
+            parameters['add_vertex'] = self._compile_add_vertex(counts['add_vertex'])['parameters']
+        if counts.get('add_edge'):
+            parameters['add_edge'] = {"pairs": self._compile_add_edge(counts['add_edge'])['parameters']['pairs']}
+        if counts.get('remove_vertex'):
+            parameters['remove_vertex'] = {"ids": self._compile_remove_vertex(counts['remove_vertex'])['parameters']['ids']}
+        if counts.get('remove_edge'):
+            parameters['remove_edge'] = {"pairs": self._compile_remove_edge(counts['remove_edge'])['parameters']['pairs']}
+        if counts.get('get_nbrs'):
+            parameters['get_nbrs'] = {"ids": self._compile_get_nbrs(counts['get_nbrs'], direction)['parameters']['ids']}
+
+        return {
+            "task_type": "MIXED",
+            "ops_count": sum(counts.values()),
+            "parameters": parameters
+        }
+
+    # --- Logic implementation for sampled IDs ---
+
+    def _apply_distribution(self, result: Dict[str, Any], task_name: str, distribution: Any, ops: int,
+                            direction: str):
+        """
+        Replace the sampled "ids" of a task with a {"$sample": ...} specification, so the C++
+        backends draw the IDs from the distribution at run time (see vertex_sampler.hpp).
+        distribution is a name ("zipf") or an object {"type": "zipf", "theta": 0.99, ...}.
+        """
+        if task_name not in SAMPLED_ID_TASKS:
+            raise ValueError(f"Task '{task_name}' does not support a distribution. "
+                             f"Supported tasks: {SAMPLED_ID_TASKS}")
+        spec = dict(distribution) if isinstance(distribution, dict) else {"type": distribution}
+        spec['distribution'] = spec.pop('type', 'uniform')
+        if spec['distribution'] not in SAMPLE_DISTRIBUTIONS:
+            raise ValueError(f"Unknown distribution '{spec['distribution']}'. Valid distributions: {SAMPLE_DISTRIBUTIONS}")
+        if spec['distribution'] == 'degree' and 'degree' not in spec:
+            spec['degree'] = {'IN': 'in', 'BOTH': 'both'}.get(direction.upper(), 'out')
+        if task_name == 'remove_vertex':
+            spec['unique'] = True
+        spec['count'] = ops
+        spec.setdefault('seed', random.randint(0, 2**31 - 1))
+        result['ops_count'] = ops
+        result['parameters']['ids'] = {"$sample": spec}
+
     # --- Helpers ---
 
     def _sample_existing_node(self) -> int:
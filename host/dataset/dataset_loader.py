@@ -1,19 +1,48 @@
 """
 DatasetLoader - Handles dataset path resolution
 """
+import json
 import os
 from pathlib import Path
 from typing import Optional, Dict, Any
 
+from dataset.synthetic_graph import SyntheticGraph, SPEC_FILE
+
 
 class DatasetLoader:
     def __init__(self, dataset_config: Dict[str, Any]):
         self.config = dataset_config
         self.root_dir = Path(dataset_config['root_dir'])
         self.datasets = dataset_config['datasets']
+        # Generated datasets: name -> synthetic.json specification (see common-cpp synthetic_graph.hpp)
+        self.synthetic = dataset_config.get('synthetic', {})
+
+    def is_synthetic(self, dataset_name: str) -> bool:
+        return dataset_name in self.synthetic
+
+    def get_synthetic_spec(self, dataset_name: str, scale: Optional[int] = None) -> Dict[str, Any]:
+        """Generator specification of a synthetic dataset, with its scale replaced by scale if given"""
+        spec = dict(self.synthetic[dataset_name])
+        if scale is not None:
+            spec['scale'] = scale
+        spec.setdefault('seed', 1)
+        SyntheticGraph(spec)  # Validate before a container is started
+        return spec
+
+    def get_dataset_path(self, dataset_name: str, scale: Optional[int] = None) -> Optional[Path]:
+        """
+        Get absolute path to dataset directory containing nodes.csv and edges.csv.
+        A synthetic dataset gets a directory holding only its synthetic.json, which
+        the backends generate the graph from; scale overrides the configured scale.
+        """
+        if self.is_synthetic(dataset_name):
+            spec = self.get_synthetic_spec(dataset_name, scale)
+            synthetic_dir = self.root_dir / 'synthetic' / f"{dataset_name}-s{spec['scale']}"
+            synthetic_dir.mkdir(parents=True, exist_ok=True)
+            with open(synthetic_dir / SPEC_FILE, 'w') as f:
+                json.dump(spec, f, indent=2)
+            return synthetic_dir.resolve()
 
-    def get_dataset_path(self, dataset_name: str) -> Optional[Path]:
-        """Get absolute path to dataset directory containing nodes.csv and edges.csv"""
         if dataset_name not in self.datasets:
             return None
 
@@ -31,4 +60,4 @@ class DatasetLoader:
 
     def list_datasets(self):
         """List all available datasets"""
-        return list(self.datasets.keys())
+        return list(self.datasets.keys()) + list(self.synthetic.keys())
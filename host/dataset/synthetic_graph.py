@@ -0,0 +1,107 @@
+"""
+SyntheticGraph - Python mirror of the C++ synthetic graph generator (common-cpp synthetic_graph.hpp)
+
+The C++ backends generate the edges of a synthetic dataset while loading it. The workload
+compiler uses this port to sample the same vertices and edges, so the two must stay in sync:
+every edge is a function of (seed, edge index) only.
+"""
+import json
+from pathlib import Path
+from typing import Any, Dict, Tuple
+
+SPEC_FILE = 'synthetic.json'
+GENERATORS = ('rmat', 'ba')
+MAX_SCALE = 40
+
+MASK64 = (1 << 64) - 1
+
+
+def _mix(x: int) -> int:
+    """splitmix64 finalizer"""
+    x = (x + 0x9E3779B97F4A7C15) & MASK64
+    x = ((x ^ (x >> 30)) * 0xBF58476D1CE4E5B9) & MASK64
+    x = ((x ^ (x >> 27)) * 0x94D049BB133111EB) & MASK64
+    return x ^ (x >> 31)
+
+
+class SyntheticGraph:
+    def __init__(self, spec: Dict[str, Any]):
+        self.generator = spec.get('generator', 'rmat')
+        if self.generator not in GENERATORS:
+            raise ValueError(f"Unknown synthetic generator '{self.generator}'. Valid generators: {GENERATORS}")
+        self.scale = int(spec['scale'])
+        self.edge_factor = int(spec.get('edge_factor', 16))
+        if not 1 <= self.scale <= MAX_SCALE:
+            raise ValueError(f"Synthetic graph scale must be between 1 and {MAX_SCALE}")
+        if not 1 <= self.edge_factor <= 1 << (62 - self.scale):
+            raise ValueError("Synthetic graph edge_factor must be at least 1 and at most 2^(62 - scale)")
+        self.seed = int(spec.get('seed', 1))
+        self.key = _mix(self.seed & MASK64)
+
+        self.a = float(spec.get('a', 0.57))
+        b = float(spec.get('b', 0.19))
+        c = float(spec.get('c', 0.19))
+        if self.a < 0 or b < 0 or c < 0 or self.a + b + c > 1:
+            raise ValueError("rmat needs a, b, c >= 0 and a + b + c <= 1")
+        self.ab = self.a + b
+        self.abc = self.ab + c
+        self.scramble_ids = bool(spec.get('scramble', True))
+        self.mask = (1 << self.scale) - 1
+        self.scramble_rounds = [(self._random(MASK64, 2 * r) | 1, self._random(MASK64, 2 * r + 1)) for r in range(2)]
+
+    @classmethod
+    def open(cls, dataset_dir: Path):
+        """The synthetic graph of a dataset directory, or None for a CSV dataset"""
+        spec_file = Path(dataset_dir) / SPEC_FILE
+        if not spec_file.exists():
+            return None
+        with open(spec_file, 'r') as f:
+            return cls(json.load(f))
+
+    @property
+    def node_count(self) -> int:
+        return 1 << self.scale
+
+    @property
+    def edge_count(self) -> int:
+        return self.edge_factor << self.scale
+
+    def edge(self, index: int) -> Tuple[int, int]:
+        """Endpoints of edge index, identical to SyntheticGraph::edge() in C++"""
+        if self.generator == 'ba':
+            return index // self.edge_factor, self._attachment_target(index)
+        src = dst = 0
+        for level in range(self.scale):
+            u = (self._random(index, level) >> 11) * 2.0 ** -53
+            src <<= 1
+            dst <<= 1
+            if u < self.a:
+                pass
+            elif u < self.ab:
+                dst |= 1
+            elif u < self.abc:
+                src |= 1
+            else:
+                src |= 1
+                dst |= 1
+        if self.scramble_ids:
+            src = self._scramble(src)
+            dst = self._scramble(dst)
+        return src, dst
+
+    def _random(self, index: int, draw: int) -> int:
+        return _mix((_mix((self.key + index) & MASK64) + draw) & MASK64)
+
+    def _scramble(self, vertex: int) -> int:
+        shift = (self.scale + 1) // 2
+        for multiplier, offset in self.scramble_rounds:
+            vertex = (vertex * multiplier + offset) & self.mask
+            vertex ^= vertex >> shift
+        return vertex
+
+    def _attachment_target(self, index: int) -> int:
+        while True:
+            position = self._random(index, 0) % (2 * index + 1)
+            if position % 2 == 0:
+                return (position // 2) // self.edge_factor
+            index = position // 2
@@ -9,6 +9,14 @@ from pathlib import Path
 from typing import Dict, Any, Optional
 
 
+class PartialResultsError(RuntimeError):
+    """A benchmark run that did not complete; results holds the tasks that did"""
+
+    def __init__(self, message: str, results: Dict[str, Any]):
+        super().__init__(message)
+        self.results = results
+
+
 class DockerManager:
     def __init__(self, database_config: Dict[str, Any], rebuild: bool = False):
         self.database_config = database_config
@@ -50,9 +58,10 @@ class DockerManager:
         dataset_path: Path,
         compiled_workload_dir: Path,
         progress_callback_url: str = None,
-        mode: str = 'structural'
+        mode: str = 'structural',
+        engine_profile: Optional[Dict[str, Any]] = None
     ):
-        """Start Docker container with mounted volumes"""
+        """Start Docker container with mounted volumes, under engine_profile if given (see EngineProfiles)"""
         db_config = self.database_config[database_name]
         image_name = db_config['docker_image']
         container_name = db_config['container_name']
@@ -81,10 +90,65 @@ class DockerManager:
             'DB_TYPE': db_type
         }
 
+        # Snapshot/restore strategy for C++ backends (auto, copy, reflink, hardlink, checkpoint)
+        if 'restore_strategy' in db_config['config']:
+            env_vars['RESTORE_STRATEGY'] = db_config['config']['restore_strategy']
+
+        # ArangoDB client transport: Unix domain socket instead of TCP (arangod listens on both)
+        if db_config['config'].get('unix_socket'):
+            env_vars['ARANGODB_UNIX_SOCKET'] = '/tmp/arangodb.sock'
+        if 'response_format' in db_config['config']:
+            env_vars['ARANGODB_RESPONSE_FORMAT'] = db_config['config']['response_format']
+
+        # Concurrent /_api/import requests of the ArangoDB loader
+        if 'import_connections' in db_config['config']:
+            env_vars['IMPORT_CONNECTIONS'] = str(db_config['config']['import_connections'])
+
+        # ArangoDB node key mapping: computed from the node ID (default) or pooled strings
+        if 'id_mapping' in db_config['config']:
+            env_vars['ID_MAPPING'] = db_config['config']['id_mapping']
+
+        # Render ArangoDB request bodies before the timed region, so only database time is measured
+        if db_config['config'].get('pre_serialize'):
+            env_vars['PRE_SERIALIZE'] = 'on'
+
+        # Aster secondary property index for property-mode runs
+        if db_config['config'].get('property_index'):
+            env_vars['PROPERTY_INDEX'] = 'on'
+
+        # Hardware performance counters per batch size in the C++ benchmark servers
+        if db_config['config'].get('perf_counters'):
+            env_vars['PERF_COUNTERS'] = 'on'
+
+        # Engine statistics (RocksDB tickers, ArangoDB server metrics) per batch size
+        if db_config['config'].get('engine_stats'):
+            env_vars['ENGINE_STATS'] = 'on'
+
+        # Thread budget of the C++ benchmark servers: HTTP handler threads and CPUs reserved for them
+        if 'http_threads' in db_config['config']:
+            env_vars['HTTP_THREADS'] = str(db_config['config']['http_threads'])
+        if 'http_cpus' in db_config['config']:
+            env_vars['HTTP_CPUS'] = str(db_config['config']['http_cpus'])
+
+        # Engine tuning profile (Aster RocksDB and RocksGraph settings)
+        if engine_profile is not None:
+            env_vars['ENGINE_PROFILE'] = json.dumps(engine_profile)
+
+        # Binary graph cache of the C++ backends, built before the first (untimed part of) LOAD_GRAPH
+        graph_cache_dir = project_root / '.graph-cache'
+        graph_cache_dir.mkdir(exist_ok=True)
+        env_vars['GRAPH_CACHE_DIR'] = '/data/graph-cache'
+        env_vars['GRAPH_CACHE'] = db_config['config'].get('graph_cache', 'build')
+
         # Add progress callback URL if provided
         if progress_callback_url:
             env_vars['PROGRESS_CALLBACK_URL'] = progress_callback_url
 
+        # Workload cache_mode "cold" drops the host page cache, which needs a privileged container
+        run_options = {}
+        if db_config['config'].get('privileged'):
+            run_options['privileged'] = True
+
         # Start new container with host network mode
         # Using host network allows container to access localhost:8888 directly
         container = self.client.containers.run(
@@ -94,9 +158,11 @@ class DockerManager:
             network_mode='host',  # Use host network to access progress server
             volumes={
                 str(project_root): {'bind': '/workspace', 'mode': 'ro'},
-                str(compiled_workload_dir.absolute()): {'bind': '/data/workloads', 'mode': 'ro'}
+                str(compiled_workload_dir.absolute()): {'bind': '/data/workloads', 'mode': 'ro'},
+                str(graph_cache_dir): {'bind': '/data/graph-cache', 'mode': 'rw'}
             },
-            environment=env_vars
+            environment=env_vars,
+            **run_options
         )
 
         # Wait for container to be ready
@@ -148,9 +214,23 @@ class DockerManager:
         if callback_url:
             payload['callback_url'] = callback_url
 
-        # Trigger benchmark execution
+        base_url = f'http://localhost:{api_port}'
+
+        # C++ servers run benchmarks as jobs and stream results; the Java servers only have /execute
+        response = requests.post(f'{base_url}/jobs', json=payload, timeout=30)
+        if response.status_code == 404:
+            return self._execute_blocking(base_url, payload)
+        if response.status_code != 202:
+            raise RuntimeError(f"Benchmark job submission failed: {response.text}")
+
+        job_id = response.json()['job_id']
+        print(f"  Job {job_id} queued, streaming results")
+        return self._stream_job(base_url, job_id)
+
+    def _execute_blocking(self, base_url: str, payload: Dict[str, Any]) -> Dict[str, Any]:
+        """Run the benchmark in one request and return its results at the end"""
         response = requests.post(
-            f'http://localhost:{api_port}/execute',
+            f'{base_url}/execute',
             json=payload,
             timeout=3600  # 1 hour timeout
         )
@@ -161,6 +241,52 @@ class DockerManager:
         results = response.json()
         return results
 
+    def _stream_job(self, base_url: str, job_id: str) -> Dict[str, Any]:
+        """
+        Follow a job's NDJSON result stream until its "done" line. A dropped connection
+        is resumed from the last line received. If the job fails or the server goes away,
+        PartialResultsError carries the results of the tasks that did finish.
+        """
+        tasks: Dict[int, Dict[str, Any]] = {}
+        metadata: Dict[str, Any] = {}
+        received = 0
+
+        def partial() -> Dict[str, Any]:
+            return {'metadata': metadata, 'results': [tasks[i] for i in sorted(tasks)]}
+
+        while True:
+            try:
+                with requests.get(f'{base_url}/jobs/{job_id}/stream', params={'from': received},
+                                  stream=True, timeout=(10, None)) as response:
+                    if response.status_code != 200:
+                        raise PartialResultsError(f"Job stream failed: {response.text}", partial())
+                    for raw in response.iter_lines():
+                        if not raw:
+                            continue
+                        line = json.loads(raw)
+                        received += 1
+                        kind = line.get('type')
+                        if kind == 'subtask':
+                            batch = line['batch_result']
+                            print(f"    ✓ {line.get('task_type')} batch_size={batch.get('batch_size')}: "
+                                  f"p50 {batch.get('latency', {}).get('p50_us', 0):.1f} us")
+                        elif kind == 'task':
+                            tasks[line['task_index']] = line['result']
+                        elif kind == 'metadata':
+                            metadata = line['metadata']
+                        elif kind == 'done':
+                            if line.get('status') != 'completed':
+                                raise PartialResultsError(
+                                    f"Benchmark job {job_id} failed: {line.get('error', 'unknown error')}", partial())
+                            return partial()
+            except requests.exceptions.RequestException as e:
+                # Resume the stream while the server is still up
+                try:
+                    requests.get(f'{base_url}/jobs/{job_id}', timeout=10).raise_for_status()
+                except requests.exceptions.RequestException:
+                    raise PartialResultsError(f"Lost benchmark server during job {job_id}: {e}", partial())
+                print(f"  ⚠️  Result stream interrupted ({e}), resuming from line {received}")
+
     def stop_container(self, container):
         """Stop and remove container"""
         try:
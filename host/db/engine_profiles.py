@@ -0,0 +1,87 @@
+"""
+EngineProfiles - Resolves the engine tuning profiles a database is benchmarked under
+
+A profile is a JSON object of engine settings that the container receives as
+ENGINE_PROFILE (see docker/aster/src/aster_options.hpp for the Aster fields).
+Named profiles come from the database config:
+
+    "aster": {"config": {"profile": "default", "profiles": {"big-cache": {"block_cache_mb": 1024}}}}
+
+and from the workload file, which can add profiles, pick the ones to run and
+sweep settings:
+
+    "engine_profiles": {
+      "aster": {
+        "profiles": {"write-heavy": {"write_buffer_mb": 64, "background_jobs": 8}},
+        "run": ["default", "write-heavy"],
+        "sweep": {"block_cache_mb": [8, 1024], "bloom_bits_per_key": [0, 10]}
+      }
+    }
+
+A sweep benchmarks the cartesian product of its values on top of every profile
+in "run". Each profile run gets its own report, under the database name
+"<database>@<profile>", so the plot scripts compare profiles like databases.
+"""
+import itertools
+from typing import Any, Dict, List, Optional, Tuple
+
+DEFAULT_PROFILE = 'default'
+
+
+class EngineProfiles:
+    def __init__(self, database_config: Dict[str, Any], workload_config: Dict[str, Any]):
+        self.database_config = database_config
+        self.workload_profiles = workload_config.get('engine_profiles', {})
+
+    def supports_profiles(self, database_name: str) -> bool:
+        """Databases take profiles when their config defines any (or the workload does)"""
+        return ('profiles' in self.database_config[database_name].get('config', {})
+                or database_name in self.workload_profiles)
+
+    def get_runs(self, database_name: str) -> List[Tuple[str, Optional[Dict[str, Any]]]]:
+        """
+        (report database name, profile) for every run of a database. Databases
+        without profiles run once with no profile. Without an "engine_profiles"
+        entry in the workload the config's "profile" (default: "default") runs
+        under the plain database name.
+        """
+        if not self.supports_profiles(database_name):
+            return [(database_name, None)]
+
+        config = self.database_config[database_name].get('config', {})
+        named = {DEFAULT_PROFILE: {}}
+        named.update(config.get('profiles', {}))
+        workload = self.workload_profiles.get(database_name)
+        if workload is None:
+            selected = config.get('profile', DEFAULT_PROFILE)
+            return [(database_name, self._named_profile(database_name, named, selected))]
+
+        named.update(workload.get('profiles', {}))
+        run = workload.get('run', [config.get('profile', DEFAULT_PROFILE)])
+        if isinstance(run, str):
+            run = [run]
+        sweep = workload.get('sweep', {})
+        for setting, values in sweep.items():
+            if not isinstance(values, list) or not values:
+                raise ValueError(f"Profile sweep of '{setting}' for {database_name} must be a non-empty list")
+
+        runs = []
+        settings = sorted(sweep)
+        for base_name in run:
+            base = self._named_profile(database_name, named, base_name)
+            for point in itertools.product(*(sweep[setting] for setting in settings)):
+                profile = dict(base)
+                profile.update(zip(settings, point))
+                if settings:
+                    profile['name'] = '+'.join([base_name] + [f"{s}={v}" for s, v in zip(settings, point)])
+                runs.append((f"{database_name}@{profile['name']}", profile))
+        return runs
+
+    @staticmethod
+    def _named_profile(database_name: str, named: Dict[str, Dict[str, Any]], name: str) -> Dict[str, Any]:
+        if name not in named:
+            raise ValueError(f"Unknown engine profile '{name}' for {database_name}. "
+                             f"Valid profiles: {sorted(named)}")
+        profile = dict(named[name])
+        profile['name'] = name
+        return profile
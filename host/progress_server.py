@@ -32,32 +32,10 @@ class ProgressHandler(BaseHTTPRequestHandler):
             body = self.rfile.read(content_length)
             data = json.loads(body.decode('utf-8'))
 
-            # Process progress update
-            event = data.get('event')
-            if event == 'task_start':
-                self._handle_task_start(data)
-            elif event == 'task_complete':
-                self._handle_task_complete(data)
-            elif event == 'subtask_start':
-                self._handle_subtask_start(data)
-            elif event == 'subtask_complete':
-                self._handle_subtask_complete(data)
-            elif event == 'snapshot_start':
-                self._handle_snapshot_start(data)
-            elif event == 'snapshot_complete':
-                self._handle_snapshot_complete(data)
-            elif event == 'restore_start':
-                self._handle_restore_start(data)
-            elif event == 'restore_complete':
-                self._handle_restore_complete(data)
-            elif event == 'cleanup_start':
-                self._handle_cleanup_start(data)
-            elif event == 'cleanup_complete':
-                self._handle_cleanup_complete(data)
-            elif event == 'log_message':
-                self._handle_log_message(data)
-            elif event == 'error_message':
-                self._handle_error_message(data)
+            # C++ backends coalesce queued events into one JSON array per request
+            events = data if isinstance(data, list) else [data]
+            for item in events:
+                self._dispatch_event(item)
 
             # Send response
             self.send_response(200)
@@ -71,6 +49,34 @@ class ProgressHandler(BaseHTTPRequestHandler):
             self.send_response(500)
             self.end_headers()
 
+    def _dispatch_event(self, data):
+        """Route one progress event to its handler"""
+        event = data.get('event')
+        if event == 'task_start':
+            self._handle_task_start(data)
+        elif event == 'task_complete':
+            self._handle_task_complete(data)
+        elif event == 'subtask_start':
+            self._handle_subtask_start(data)
+        elif event == 'subtask_complete':
+            self._handle_subtask_complete(data)
+        elif event == 'snapshot_start':
+            self._handle_snapshot_start(data)
+        elif event == 'snapshot_complete':
+            self._handle_snapshot_complete(data)
+        elif event == 'restore_start':
+            self._handle_restore_start(data)
+        elif event == 'restore_complete':
+            self._handle_restore_complete(data)
+        elif event == 'cleanup_start':
+            self._handle_cleanup_start(data)
+        elif event == 'cleanup_complete':
+            self._handle_cleanup_complete(data)
+        elif event == 'log_message':
+            self._handle_log_message(data)
+        elif event == 'error_message':
+            self._handle_error_message(data)
+
     def _handle_task_start(self, data):
         """Handle task start event"""
         task_name = data.get('task_name')
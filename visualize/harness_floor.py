@@ -0,0 +1,51 @@
+"""
+Harness Floor
+
+Per-operation cost of the harness itself (timer reads, batch loop, latency recording),
+taken from a report of the null reference backend (database "null", see common-cpp
+null_benchmark_executor.hpp) on the same dataset and workload. Subtracting it from
+another report leaves the latency spent in that database.
+"""
+
+import copy
+import json
+from pathlib import Path
+from typing import Any, Dict, Optional, Tuple
+
+
+def floor_latencies(floor_report: Dict[str, Any]) -> Dict[Tuple[int, str, int], float]:
+    """Latency (μs) of the floor report by (task index, task type, batch size)."""
+    floor = {}
+    for idx, result in enumerate(floor_report.get('results', [])):
+        for batch_result in result.get('batch_results', []):
+            floor[(idx, result.get('task_type'), batch_result['batch_size'])] = batch_result['latency_us']
+    return floor
+
+
+def subtract_floor(report: Dict[str, Any], floor_report: Dict[str, Any]) -> Dict[str, Any]:
+    """
+    Copy of report with the floor latency of the same task and batch size subtracted
+    from every latency_us (clamped at 0) and kept as harness_floor_us. Tasks are matched
+    by position, since both reports ran the same compiled workload; LOAD_GRAPH and
+    tasks without a counterpart are left as they are.
+    """
+    floor = floor_latencies(floor_report)
+    adjusted = copy.deepcopy(report)
+    for idx, result in enumerate(adjusted.get('results', [])):
+        for batch_result in result.get('batch_results', []):
+            floor_us = floor.get((idx, result.get('task_type'), batch_result['batch_size']))
+            if floor_us is None:
+                continue
+            batch_result['harness_floor_us'] = floor_us
+            batch_result['latency_us'] = max(batch_result['latency_us'] - floor_us, 0.0)
+    return adjusted
+
+
+def load_floor_report(reports_dir: Path, floor_db: str, dataset: str, workload: str) -> Optional[Dict[str, Any]]:
+    """The floor database's report for dataset and workload, or None if it was not run."""
+    filepath = reports_dir / f"bench_{floor_db}_{dataset}_{workload}.json"
+    if not filepath.exists():
+        print(f"⚠️  Warning: Harness floor report not found: {filepath}")
+        return None
+    with open(filepath, 'r') as f:
+        return json.load(f)
@@ -16,6 +16,8 @@ from plotly.subplots import make_subplots
 from rich.console import Console
 from rich.table import Table
 
+from harness_floor import load_floor_report, subtract_floor
+
 
 def load_report(filepath: Path) -> Dict[str, Any]:
     """Load a benchmark report JSON file."""
@@ -157,6 +159,10 @@ def main():
     parser.add_argument('--output-dir', default='plots',
                         help='Output directory for plots')
 
+    parser.add_argument('--subtract-floor', default=None, metavar='FLOOR_DB',
+                        help='Subtract the latencies of this reference run (e.g., null) on the same dataset '
+                             'and workload from the other databases')
+
     args = parser.parse_args()
 
     # Parse comma-separated database values
@@ -183,6 +189,15 @@ def main():
     print(f"✓ Found {len(reports)} report(s)")
     print()
 
+    # Subtract the harness floor
+    if args.subtract_floor:
+        floor_report = load_floor_report(reports_dir, args.subtract_floor, args.dataset, args.workload)
+        if floor_report:
+            reports = {db: report if db == args.subtract_floor else subtract_floor(report, floor_report)
+                       for db, report in reports.items()}
+            print(f"✓ Subtracted the {args.subtract_floor} harness floor")
+            print()
+
     # Display reports table
     console = Console()
     table = Table(title="📋 Found Reports", show_header=True, header_style="bold magenta")
@@ -4,7 +4,8 @@ Performance Comparison Visualization
 
 Plots performance comparison across databases for each dataset.
 Generates one interactive grouped bar chart per dataset, with tasks grouped
-and databases compared within each group.
+and databases compared within each group. Engine statistics recorded by the
+C++ backends (engine_stats) can be overlaid per operation on a second axis.
 """
 
 import argparse
@@ -17,6 +18,8 @@ from plotly.subplots import make_subplots
 from rich.console import Console
 from rich.table import Table
 
+from harness_floor import load_floor_report, subtract_floor
+
 
 def load_report(filepath: Path) -> Dict[str, Any]:
     """Load a benchmark report JSON file."""
@@ -48,12 +51,9 @@ def find_matching_reports(reports_dir: Path, databases: List[str],
     return matching_reports
 
 
-def extract_average_latency(report: Dict[str, Any]) -> Dict[str, float]:
-    """Extract best (minimum) latency for each task type.
-
-    For tasks with batch_results, select the batch size with the lowest latency.
-    """
-    task_latencies = {}
+def extract_best_batches(report: Dict[str, Any]) -> Dict[str, Dict[str, Any]]:
+    """Select the batch result with the lowest latency for each task type."""
+    best_batches = {}
 
     for result in report.get('results', []):
         task_type = result.get('task_type')
@@ -66,20 +66,59 @@ def extract_average_latency(report: Dict[str, Any]) -> Dict[str, float]:
 
         if batch_results:
             # Select the minimum latency across all batch sizes (best performance)
-            min_latency = min(br['latency_us'] for br in batch_results)
-            task_latencies[task_type] = min_latency
+            best_batches[task_type] = min(batch_results, key=lambda br: br['latency_us'])
+
+    return best_batches
+
+
+def extract_average_latency(report: Dict[str, Any]) -> Dict[str, float]:
+    """Extract best (minimum) latency for each task type.
+
+    For tasks with batch_results, select the batch size with the lowest latency.
+    """
+    return {task: br['latency_us'] for task, br in extract_best_batches(report).items()}
 
-    return task_latencies
+
+def engine_stat_per_op(batch_result: Dict[str, Any], stat: str):
+    """Per-operation change of an engine statistic in one batch result, or None.
+
+    Labelled server metrics (name{labels}) are summed over their labels.
+    """
+    engine_stats = batch_result.get('engine_stats')
+    ops = batch_result.get('measured_ops', batch_result.get('validOpsCount', 0))
+    if engine_stats is None or ops <= 0:
+        return None
+    total = sum(value for name, value in engine_stats.items()
+                if name == stat or name.startswith(stat + '{'))
+    return total / ops
+
+
+def extract_engine_stats(report: Dict[str, Any], stats: List[str]) -> Dict[str, Dict[str, float]]:
+    """Per-operation engine statistics of the best batch size of each task.
+
+    Returns:
+        {stat: {task_type: value}}
+    """
+    values = {stat: {} for stat in stats}
+    for task, br in extract_best_batches(report).items():
+        for stat in stats:
+            value = engine_stat_per_op(br, stat)
+            if value is not None:
+                values[stat][task] = value
+    return values
 
 
 def create_performance_comparison_plot(dataset: str, db_data: Dict[str, Dict[str, float]],
-                                       workload: str) -> go.Figure:
+                                       workload: str,
+                                       db_engine_stats: Dict[str, Dict[str, Dict[str, float]]] = None) -> go.Figure:
     """Create an interactive grouped bar chart for a single dataset.
 
     Args:
         dataset: Dataset name
         db_data: {database: {task_type: avg_latency}}
         workload: Workload name
+        db_engine_stats: Optional {database: {stat: {task_type: value_per_op}}}, drawn as
+            markers on a secondary axis
     """
     # Get all unique task types across all databases
     all_tasks = set()
@@ -91,7 +130,9 @@ def create_performance_comparison_plot(dataset: str, db_data: Dict[str, Dict[str
     colors = ['#1f77b4', '#ff7f0e', '#2ca02c', '#d62728', '#9467bd',
               '#8c564b', '#e377c2', '#7f7f7f', '#bcbd22', '#17becf']
 
-    fig = go.Figure()
+    overlay = bool(db_engine_stats) and any(
+        task_values for stats in db_engine_stats.values() for task_values in stats.values())
+    fig = make_subplots(specs=[[{'secondary_y': True}]]) if overlay else go.Figure()
 
     # Add a bar trace for each database
     for idx, (db_name, task_latencies) in enumerate(db_data.items()):
@@ -113,6 +154,31 @@ def create_performance_comparison_plot(dataset: str, db_data: Dict[str, Dict[str
             )
         ))
 
+    # Overlay engine statistics: one marker series per (database, statistic)
+    if overlay:
+        symbols = ['diamond', 'circle', 'square', 'triangle-up', 'x', 'star']
+        for idx, (db_name, stats) in enumerate(db_engine_stats.items()):
+            for stat_idx, (stat, task_values) in enumerate(stats.items()):
+                if not task_values:
+                    continue
+                fig.add_trace(go.Scatter(
+                    name=f'{db_name}: {stat}',
+                    x=[task for task in all_tasks if task in task_values],
+                    y=[task_values[task] for task in all_tasks if task in task_values],
+                    mode='markers',
+                    marker=dict(color=colors[idx % len(colors)], size=10,
+                                symbol=symbols[stat_idx % len(symbols)],
+                                line=dict(color='black', width=1)),
+                    hovertemplate=(
+                        f'<b>{db_name}</b><br>' +
+                        'Task: %{x}<br>' +
+                        f'{stat}: ' + '%{y:.3g} per op<br>' +
+                        '<extra></extra>'
+                    )
+                ), secondary_y=True)
+        fig.update_yaxes(title_text='<b>Engine statistic per op</b>', type='log', showgrid=False,
+                         secondary_y=True)
+
     # Update layout
     fig.update_layout(
         title=dict(
@@ -179,11 +245,20 @@ def main():
     parser.add_argument('--output-dir', default='plots',
                         help='Output directory for plots')
 
+    parser.add_argument('--engine-stat', default='',
+                        help='Engine statistic(s) to overlay per operation (comma-separated, e.g., '
+                             'rocksdb.block.cache.miss,rocksdb.stall.micros); needs runs with engine_stats')
+
+    parser.add_argument('--subtract-floor', default=None, metavar='FLOOR_DB',
+                        help='Subtract the latencies of this reference run (e.g., null) on the same dataset '
+                             'and workload from the other databases')
+
     args = parser.parse_args()
 
     # Parse comma-separated values
     args.database = [db.strip() for db in args.database.split(',')]
     args.dataset = [ds.strip() for ds in args.dataset.split(',')]
+    args.engine_stat = [stat.strip() for stat in args.engine_stat.split(',') if stat.strip()]
 
     # Setup paths
     reports_dir = Path(args.reports_dir)
@@ -199,6 +274,14 @@ def main():
     # Find matching reports
     reports = find_matching_reports(reports_dir, args.database, args.workload, args.dataset)
 
+    # Subtract the harness floor of each dataset
+    if args.subtract_floor:
+        for dataset, db_reports in reports.items():
+            floor_report = load_floor_report(reports_dir, args.subtract_floor, dataset, args.workload)
+            if floor_report:
+                reports[dataset] = {db: report if db == args.subtract_floor else subtract_floor(report, floor_report)
+                                    for db, report in db_reports.items()}
+
     # Count total reports and display table
     total_reports = sum(len(db_reports) for db_reports in reports.values())
 
@@ -238,17 +321,20 @@ def main():
 
         # Extract best latencies for each database (minimum across all batch sizes)
         db_data = {}
+        db_engine_stats = {}
         for db_name, report in db_reports.items():
             task_latencies = extract_average_latency(report)
             if task_latencies:
                 db_data[db_name] = task_latencies
+                if args.engine_stat:
+                    db_engine_stats[db_name] = extract_engine_stats(report, args.engine_stat)
 
         if not db_data:
             print(f"     ⚠️  No valid data for dataset: {dataset}")
             continue
 
         # Create plot
-        fig = create_performance_comparison_plot(dataset, db_data, args.workload)
+        fig = create_performance_comparison_plot(dataset, db_data, args.workload, db_engine_stats)
 
         # Save as HTML
         output_file = output_dir / f"performance_{dataset}_{args.workload}.html"
@@ -0,0 +1,260 @@
+#!/usr/bin/env python3
+"""
+Scale Sweep Visualization
+
+Plots performance vs graph size for multiple databases on a synthetic dataset swept
+over several scales (workload option "scales"). Generates one interactive plot per task
+showing how latency (or load time) changes with the number of edges.
+"""
+
+import argparse
+import json
+import sys
+from pathlib import Path
+from typing import List, Dict, Any, Optional, Tuple
+import plotly.graph_objects as go
+from rich.console import Console
+from rich.table import Table
+
+from harness_floor import subtract_floor
+
+
+def load_report(filepath: Path) -> Dict[str, Any]:
+    """Load a benchmark report JSON file."""
+    with open(filepath, 'r') as f:
+        return json.load(f)
+
+
+def find_sweep_reports(reports_dir: Path, databases: List[str],
+                       workload: str, dataset: str) -> Dict[str, Dict[int, Dict[str, Any]]]:
+    """Find the reports of every scale of a swept dataset: database -> scale -> report."""
+    matching_reports = {}
+
+    for db in databases:
+        for filepath in sorted(reports_dir.glob(f"bench_{db}_{dataset}-s*_{workload}.json")):
+            report = load_report(filepath)
+            synthetic = report.get('metadata', {}).get('synthetic')
+            if not synthetic:
+                continue
+            matching_reports.setdefault(db, {})[synthetic['scale']] = report
+        if db not in matching_reports:
+            print(f"⚠️  Warning: No scale sweep reports found for {db}")
+
+    return matching_reports
+
+
+def edge_count(report: Dict[str, Any]) -> int:
+    """Edges of the generated graph of a report."""
+    synthetic = report['metadata']['synthetic']
+    return synthetic.get('edge_factor', 16) << synthetic['scale']
+
+
+def task_value(result: Dict[str, Any], batch_size: Optional[int]) -> Optional[float]:
+    """Load time (s) of LOAD_GRAPH, else the latency (μs) at batch_size (default: the smallest batch size)."""
+    if result.get('task_type') == 'LOAD_GRAPH':
+        return result.get('durationSeconds')
+    batch_results = result.get('batch_results', [])
+    if not batch_results:
+        return None
+    if batch_size is None:
+        return min(batch_results, key=lambda b: b['batch_size'])['latency_us']
+    for batch_result in batch_results:
+        if batch_result['batch_size'] == batch_size:
+            return batch_result['latency_us']
+    return None
+
+
+def extract_sweep_data(reports: Dict[int, Dict[str, Any]],
+                       batch_size: Optional[int]) -> Dict[str, List[Tuple[int, float]]]:
+    """Per task ("<index>_<task type>", as the compiled workload files), the (edges, value) points in scale order."""
+    task_data = {}
+
+    for scale in sorted(reports):
+        report = reports[scale]
+        for idx, result in enumerate(report.get('results', [])):
+            value = task_value(result, batch_size)
+            if value is None:
+                continue
+            task_key = f"{idx:02d}_{result.get('task_type')}"
+            task_data.setdefault(task_key, []).append((edge_count(report), value))
+
+    return task_data
+
+
+def create_scale_sweep_plot(task_key: str, db_data: Dict[str, List[Tuple[int, float]]],
+                            dataset: str, workload: str, batch_size: Optional[int]) -> go.Figure:
+    """Create an interactive plot for a single task comparing databases over graph sizes."""
+    fig = go.Figure()
+    is_load = task_key.endswith('LOAD_GRAPH')
+    y_title = 'Load Time (s)' if is_load else 'Latency (μs)'
+    y_format = '%{y:.2f} s' if is_load else '%{y:.2f} μs'
+
+    # Color palette for databases
+    colors = ['#1f77b4', '#ff7f0e', '#2ca02c', '#d62728', '#9467bd',
+              '#8c564b', '#e377c2', '#7f7f7f', '#bcbd22', '#17becf']
+
+    for idx, (db_name, points) in enumerate(db_data.items()):
+        fig.add_trace(go.Scatter(
+            x=[edges for edges, _ in points],
+            y=[value for _, value in points],
+            mode='lines+markers',
+            name=db_name,
+            line=dict(width=2, color=colors[idx % len(colors)]),
+            marker=dict(size=10, symbol='circle'),
+            hovertemplate=(
+                f'<b>{db_name}</b><br>' +
+                'Edges: %{x:,}<br>' +
+                f'{y_title.split(" (")[0]}: {y_format}<br>' +
+                '<extra></extra>'
+            )
+        ))
+
+    batch_label = '' if is_load else f" | Batch size: {batch_size if batch_size is not None else 'smallest'}"
+    fig.update_layout(
+        title=dict(
+            text=f'<b>{task_key}</b><br><sub>Dataset: {dataset} | Workload: {workload}{batch_label}</sub>',
+            x=0.5,
+            xanchor='center',
+            font=dict(size=20)
+        ),
+        xaxis=dict(
+            title='<b>Edges</b>',
+            type='log',
+            gridcolor='lightgray',
+            showgrid=True,
+            zeroline=False
+        ),
+        yaxis=dict(
+            title=f'<b>{y_title}</b>',
+            type='log',
+            gridcolor='lightgray',
+            showgrid=True,
+            zeroline=False
+        ),
+        hovermode='closest',
+        plot_bgcolor='white',
+        paper_bgcolor='white',
+        font=dict(family='Arial, sans-serif', size=12),
+        legend=dict(
+            title='<b>Database</b>',
+            orientation='v',
+            yanchor='top',
+            y=1,
+            xanchor='left',
+            x=1.02,
+            bgcolor='rgba(255, 255, 255, 0.8)',
+            bordercolor='lightgray',
+            borderwidth=1
+        ),
+        margin=dict(l=80, r=150, t=100, b=80),
+        width=1000,
+        height=600
+    )
+
+    return fig
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Plot performance vs graph size across databases for a swept synthetic dataset',
+        formatter_class=argparse.RawDescriptionHelpFormatter
+    )
+
+    parser.add_argument('--database', required=True,
+                        help='Database name(s) to compare (comma-separated, e.g., aster,arangodb)')
+
+    parser.add_argument('--workload', required=True,
+                        help='Workload configuration name (e.g., scale_sweep)')
+
+    parser.add_argument('--dataset', required=True,
+                        help='Synthetic dataset name without the scale suffix (e.g., rmat)')
+
+    parser.add_argument('--batch-size', type=int, default=None,
+                        help='Batch size whose latency is plotted (default: the smallest batch size of each task)')
+
+    parser.add_argument('--reports-dir', default='reports',
+                        help='Directory containing benchmark reports')
+
+    parser.add_argument('--output-dir', default='plots',
+                        help='Output directory for plots')
+
+    parser.add_argument('--subtract-floor', default=None, metavar='FLOOR_DB',
+                        help='Subtract the latencies of this reference sweep (e.g., null) at the same scale '
+                             'from the other databases')
+
+    args = parser.parse_args()
+
+    # Parse comma-separated database values
+    args.database = [db.strip() for db in args.database.split(',')]
+
+    # Setup paths
+    reports_dir = Path(args.reports_dir)
+    output_dir = Path(args.output_dir)
+    output_dir.mkdir(parents=True, exist_ok=True)
+
+    print(f"📊 Generating scale sweep plots...")
+    print(f"   Databases: {', '.join(args.database)}")
+    print(f"   Dataset: {args.dataset}")
+    print(f"   Workload: {args.workload}")
+    print()
+
+    # Find matching reports
+    reports = find_sweep_reports(reports_dir, args.database, args.workload, args.dataset)
+
+    if not reports:
+        print("❌ No matching reports found!")
+        sys.exit(1)
+
+    # Subtract the harness floor at each scale
+    if args.subtract_floor:
+        floor_reports = find_sweep_reports(reports_dir, [args.subtract_floor], args.workload,
+                                           args.dataset).get(args.subtract_floor, {})
+        for db_name, db_reports in reports.items():
+            if db_name == args.subtract_floor:
+                continue
+            for scale, report in db_reports.items():
+                if scale in floor_reports:
+                    db_reports[scale] = subtract_floor(report, floor_reports[scale])
+
+    # Display reports table
+    console = Console()
+    table = Table(title="📋 Found Reports", show_header=True, header_style="bold magenta")
+    table.add_column("Database", style="yellow")
+    table.add_column("Scales", style="cyan")
+    table.add_column("Edges", style="green")
+
+    for db_name in sorted(reports.keys()):
+        scales = sorted(reports[db_name])
+        edges = [edge_count(reports[db_name][scale]) for scale in scales]
+        table.add_row(db_name, ', '.join(str(s) for s in scales), ', '.join(f"{e:,}" for e in edges))
+
+    console.print(table)
+    print()
+
+    # Extract the sweep of each task for each database
+    all_task_data = {}
+    for db_name, db_reports in reports.items():
+        for task_key, points in extract_sweep_data(db_reports, args.batch_size).items():
+            all_task_data.setdefault(task_key, {})[db_name] = points
+
+    # Generate one plot per task
+    plot_count = 0
+    for task_key, db_data in all_task_data.items():
+        print(f"  📈 Generating plot for {task_key}...")
+
+        fig = create_scale_sweep_plot(task_key, db_data, args.dataset, args.workload, args.batch_size)
+
+        # Save as HTML
+        output_file = output_dir / f"scalesweep_{args.dataset}_{task_key}.html"
+        fig.write_html(str(output_file))
+        print(f"     ✓ Saved to {output_file}")
+
+        plot_count += 1
+
+    print()
+    print(f"🎉 Generated {plot_count} plot(s) in {output_dir}/")
+    print(f"   Open the HTML files in a browser to view interactive plots")
+
+
+if __name__ == '__main__':
+    main()
@@ -18,13 +18,17 @@ Usage: $0 [COMMAND] [OPTIONS]
 Commands:
   batchsize       Generate batch size comparison plots
   performance     Generate performance comparison plots
+  scalesweep      Generate performance vs graph size plots of a swept synthetic dataset
   help            Show this help message
 
 Batch Size Comparison:
-  bash $0 batchsize --database DB1,DB2,... --workload WORKLOAD --dataset DATASET [--output-dir DIR]
+  bash $0 batchsize --database DB1,DB2,... --workload WORKLOAD --dataset DATASET [--subtract-floor null] [--output-dir DIR]
 
 Performance Comparison:
-  bash $0 performance --database DB1,DB2,... --workload WORKLOAD --dataset DS1,DS2,... [--output-dir DIR]
+  bash $0 performance --database DB1,DB2,... --workload WORKLOAD --dataset DS1,DS2,... [--subtract-floor null] [--output-dir DIR]
+
+Scale Sweep:
+  bash $0 scalesweep --database DB1,DB2,... --workload WORKLOAD --dataset SYNTHETIC [--batch-size N] [--subtract-floor null] [--output-dir DIR]
 
 Examples:
   # Batch size comparison for a single dataset
@@ -33,6 +37,9 @@ Examples:
   # Performance comparison across multiple datasets
   bash $0 performance --database neo4j,janusgraph --workload example_workload --dataset delaunay_n13,movielens-small
 
+  # Latency above the harness floor, with the in-memory CSR speed-of-light baseline
+  bash $0 performance --database aster,arangodb,csr --workload example_workload --dataset delaunay_n13 --subtract-floor null
+
 Examples:
   # Batch size comparison for a single dataset
   bash $0 batchsize \\
@@ -73,6 +80,9 @@ case "$COMMAND" in
     performance)
         python3 "$VISUALIZE_DIR/plot_performance_comparison.py" "$@"
         ;;
+    scalesweep)
+        python3 "$VISUALIZE_DIR/plot_scale_sweep.py" "$@"
+        ;;
     help|--help|-h)
         usage
         ;;